@@ -64,7 +64,8 @@ CC_PROFILE  = $(CC_DEBUG)
 CC = $(CC_$(BUILD))
 BCC = $(CC_$(BUILD))
 
-CFLAGS_RELEASE = -O2 -Wall -DNDEBUG -DHTML_MACROS -DTKHTML_ENABLE_PROFILE
+CFLAGS_RELEASE = -O2 -Wall -DNDEBUG -DHTML_MACROS -DTKHTML_ENABLE_PROFILE \
+                 -DTKHTML_COMPILED_DEFAULTSTYLE
 CFLAGS_DEBUG    = -g -Wall -DHTML_DEBUG -DTKHTML_ENABLE_PROFILE
 CFLAGS_PROFILE  = -g -pg -Wall -DNDEBUG -DTKHTML_ENABLE_PROFILE
 CFLAGS_MEMDEBUG = -g -Wall -DRES_DEBUG -DHTML_DEBUG -DTCL_MEM_DEBUG=1
@@ -63,6 +63,14 @@ htmltcl.o: $(TOP)/src/htmltcl.c $(HDR) htmldefaultstyle.c
 	@echo '$$(COMPILE) -c $< htmldefaultstyle.c -o $@'
 	@$(COMPILE) -c $(TOP)/src/htmltcl.c -o $@
 
+css.o: $(TOP)/src/css.c $(HDR) htmldefaultstyle.c
+	@echo '$$(COMPILE) -c $< htmldefaultstyle.c -o $@'
+	@$(COMPILE) -c $(TOP)/src/css.c -o $@
+
+htmltext.o: $(TOP)/src/htmltext.c $(HDR) htmlentities.c
+	@echo '$$(COMPILE) -c $< htmlentities.c -o $@'
+	@$(COMPILE) -c $(TOP)/src/htmltext.c -o $@
+
 %.o: %.c $(HDR)
 	@echo '$$(COMPILE) -c $< -o $@'
 	@$(COMPILE) -c $< -o $@
@@ -71,14 +79,20 @@ cssprop.h: $(TOP)/src/cssprop.tcl
 	@echo '$$(TCLSH) $<'
 	@$(TCLSH) $<
 
-htmldefaultstyle.c: $(TOP)/src/tkhtml.tcl  $(TOP)/src/html.css $(TOP)/src/mkdefaultstyle.tcl 
+htmldefaultstyle.c: $(TOP)/src/tkhtml.tcl  $(TOP)/src/html.css \
+                    $(TOP)/src/quirks.css $(TOP)/src/mkdefaultstyle.tcl 
 	@echo '$$(TCLSH) $(TOP)/src/mkdefaultstyle.tcl > htmldefaultstyle.c'
 	@$(TCLSH) $(TOP)/src/mkdefaultstyle.tcl > htmldefaultstyle.c
 
-htmltokens.h:	$(TOP)/src/tokenlist.txt
+htmltokens.h:	$(TOP)/src/tokenlist.txt $(TOP)/src/mkhash.tcl
 	@echo '$$(TCLSH) $<'
 	@$(TCLSH) $<
 
+htmlentities.c: $(TOP)/src/entities.txt $(TOP)/src/mkentities.tcl \
+                $(TOP)/src/mkhash.tcl
+	@echo '$$(TCLSH) $(TOP)/src/mkentities.tcl > htmlentities.c'
+	@$(TCLSH) $(TOP)/src/mkentities.tcl > htmlentities.c
+
 cssprop.c: cssprop.h
 
 htmltokens.c: htmltokens.h
@@ -72,6 +72,7 @@ static const char rcsid[] = "$Id: css.c,v 1.139 2007/12/16 11:57:43 danielk1977
 #include <stdio.h>
 #include <errno.h>
 #include <ctype.h>
+#include <time.h>
 
 #include "cssInt.h"
 #include "html.h"
@@ -82,7 +83,10 @@ static const char rcsid[] = "$Id: css.c,v 1.139 2007/12/16 11:57:43 danielk1977
  */
 #define TRACE_PARSER_CALLS 0
 
-static int cssParse(HtmlTree*,int,CONST char*,int,int,Tcl_Obj*,Tcl_Obj*,Tcl_Obj*,Tcl_Obj*,CssStyleSheet**);
+static int cssParse(HtmlTree*,int,CONST char*,const CssParseOp*,int,int,Tcl_Obj*,Tcl_Obj*,Tcl_Obj*,Tcl_Obj*,CssStyleSheet**);
+static void sortDirtyLists(CssParse *);
+static void selectorCompile(HtmlTree *, CssSelector *);
+static const char *selectorAtom(HtmlTree *, const char *);
 
 /*
  *---------------------------------------------------------------------------
@@ -1979,6 +1983,7 @@ selectorFree (CssSelector *pSelector)
 {
     if( !pSelector ) return;
     selectorFree(pSelector->pNext);
+    HtmlFree(pSelector->aOp);
     HtmlFree(pSelector->zValue);
     HtmlFree(pSelector->zAttr);
     HtmlFree(pSelector);
@@ -2107,6 +2112,35 @@ newCssPriority(CssStyleSheet *pStyle, int origin, Tcl_Obj *pIdTail, int importan
     return pNew;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * styleSheetNew --
+ *
+ *     Allocate a new, empty, CssStyleSheet object. If isHash is true,
+ *     initialise the hash-tables (this is not required for the 
+ *     stylesheet used to parse a style attribute).
+ *
+ * Results:
+ *     New stylesheet object. Free with HtmlCssStyleSheetFree().
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static CssStyleSheet *
+styleSheetNew (int isHash)
+{
+    CssStyleSheet *pStyle = HtmlNew(CssStyleSheet);
+    if (isHash) {
+        Tcl_InitHashTable(&pStyle->aByTag, TCL_STRING_KEYS);
+        Tcl_InitHashTable(&pStyle->aByClass, TCL_ONE_WORD_KEYS);
+        Tcl_InitHashTable(&pStyle->aById, TCL_ONE_WORD_KEYS);
+    }
+    return pStyle;
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -2125,6 +2159,11 @@ newCssPriority(CssStyleSheet *pStyle, int origin, Tcl_Obj *pIdTail, int importan
  *     The stylesheet produced when parsing a style is the same as 
  *     "* {<style text>}".
  *
+ *     If argument aOp is not NULL, then it is an array of CssParseOp 
+ *     structures generated from a stylesheet document. The array is 
+ *     replayed (see HtmlCssRunParseOps()) and arguments n and z are 
+ *     ignored.
+ *
  * Results:
  *     None.
  *
@@ -2138,6 +2177,7 @@ cssParse(
     HtmlTree *pTree,
     int n,                       /* Size of z in bytes */
     CONST char *z,               /* Text of attribute/document */
+    const CssParseOp *aOp,       /* Pre-parsed document, or NULL */
     int isStyle,                 /* True if this is a style attribute */
     int origin,                  /* CSS_ORIGIN_* value */
     Tcl_Obj *pStyleId,           /* Second and later parts of stylesheet id */
@@ -2162,7 +2202,7 @@ cssParse(
         Tcl_IncrRefCount(sParse.pErrorLog);
     }
 
-    if( n<0 ){
+    if( n<0 && !aOp ){
         n = strlen(z);
     }
 
@@ -2171,14 +2211,7 @@ cssParse(
      * to the existing object.
      */
     if (0==*ppStyle) {
-        sParse.pStyle = HtmlNew(CssStyleSheet);
-        
-        /* If pStyleId is not NULL, then initialise the hash-tables */
-        if (pStyleId) {
-            Tcl_InitHashTable(&sParse.pStyle->aByTag, TCL_STRING_KEYS);
-            Tcl_InitHashTable(&sParse.pStyle->aByClass, TCL_STRING_KEYS);
-            Tcl_InitHashTable(&sParse.pStyle->aById, TCL_STRING_KEYS);
-        }
+        sParse.pStyle = styleSheetNew(pStyleId ? 1 : 0);
     } else {
         sParse.pStyle = *ppStyle;
     }
@@ -2196,12 +2229,22 @@ cssParse(
         sParse.pPriority2 = newCssPriority(sParse.pStyle, origin, pStyleId, 1);
     }
 
-    if (isStyle) {
+    if (aOp) {
+        assert(!isStyle);
+        HtmlCssRunParseOps(aOp, &sParse);
+    } else if (isStyle) {
         HtmlCssRunStyleParser(z, n, &sParse);
     } else {
         HtmlCssRunParser(z, n, &sParse);
     }
 
+    /* Rules were added to the stylesheet lists unsorted by pushRule().
+     * Sort each modified list now, once, instead of inserting each rule
+     * in priority order as it was parsed (which is O(N^2) for a large 
+     * stylesheet).
+     */
+    sortDirtyLists(&sParse);
+
     *ppStyle = sParse.pStyle;
 
     /* Clean up anything left in sParse */
@@ -2223,7 +2266,7 @@ cssParse(
 int 
 HtmlCssSelectorParse (HtmlTree *pTree, int n, const char *z, CssStyleSheet **ppStyle)
 {
-    return cssParse(pTree, n, z, 0, 0, 0, 0, 0, 0, ppStyle);
+    return cssParse(pTree, n, z, 0, 0, 0, 0, 0, 0, 0, ppStyle);
 }
 
 /*
@@ -2256,6 +2299,7 @@ HtmlStyleParse(
     CONST char *zId;
     CONST char *zStyleText;
     int nStyleText;
+    clock_t styleClock;
 
     /* Parse up the stylesheet id. It must begin with one of the strings
      * "agent", "user" or "author". After that it may contain any text.
@@ -2287,9 +2331,11 @@ HtmlStyleParse(
      * documents.
      */
     zStyleText = Tcl_GetStringFromObj(pStyleText, &nStyleText);
+    styleClock = clock();
     cssParse(
         pTree,
         nStyleText, zStyleText,            /* Stylesheet text */
+        0,                                 /* No pre-parsed document */
         0,                                 /* This is not a style attribute */
         origin,                            /* Origin - CSS_ORIGIN_XXX */
         pStyleId,                          /* Rest of -id option */
@@ -2298,6 +2344,10 @@ HtmlStyleParse(
         pErrorVar,                         /* Variable to store errors in */
         &pTree->pStyle                     /* CssStylesheet to update/create */
     );
+    styleClock = clock() - styleClock;
+    HtmlTimer(pTree, "STYLE", "Parse \"%s\": bytes=%d clicks=%d", 
+        zId, nStyleText, (int)styleClock
+    );
 
     Tcl_DecrRefCount(pStyleId);
     return TCL_OK;
@@ -2327,7 +2377,7 @@ HtmlCssInlineParse(
 ){
     CssStyleSheet *pStyle = 0;
     assert(ppPropertySet && !(*ppPropertySet));
-    cssParse(pTree, n, z, 1, 0, 0, 0, 0, 0, &pStyle);
+    cssParse(pTree, n, z, 0, 1, 0, 0, 0, 0, 0, &pStyle);
 
     if (pStyle) {
         if (pStyle->pUniversalRules) {
@@ -2405,6 +2455,8 @@ freeRulesHash(Tcl_HashTable *pHash)
  * HtmlCssStyleSheetFree --
  *
  *     Delete the internal representation of the stylesheet configuration.
+ *     If the object is shared (CssStyleSheet.nRef is non-zero), drop one
+ *     reference instead.
  *
  * Results:
  *     None.
@@ -2417,13 +2469,21 @@ freeRulesHash(Tcl_HashTable *pHash)
 void 
 HtmlCssStyleSheetFree (CssStyleSheet *pStyle)
 {
-    if (pStyle) {
+    if (pStyle && pStyle->nRef > 0) {
+        pStyle->nRef--;
+    } else if (pStyle) {
         CssPriority *pPriority;
+        int ii;
+
+        HtmlCssStyleSheetFree(pStyle->pShared);
 
         /* Free the universal rules list */
         freeRulesList(&pStyle->pUniversalRules); 
         freeRulesList(&pStyle->pAfterRules); 
         freeRulesList(&pStyle->pBeforeRules); 
+        for (ii = 0; ii < Html_TypeCount; ii++) {
+            freeRulesList(&pStyle->apByTagType[ii]);
+        }
         freeRulesHash(&pStyle->aByTag); 
         freeRulesHash(&pStyle->aByClass); 
         freeRulesHash(&pStyle->aById); 
@@ -2446,7 +2506,161 @@ HtmlCssStyleSheetFree (CssStyleSheet *pStyle)
 ** style-sheet.
 */
 int HtmlCssStyleSheetSyntaxErrs(CssStyleSheet *pStyle){
-    return pStyle->nSyntaxErr;
+    int nSyntaxErr = pStyle->nSyntaxErr;
+    if (pStyle->pShared) {
+        nSyntaxErr += pStyle->pShared->nSyntaxErr;
+    }
+    return nSyntaxErr;
+}
+
+#ifdef TKHTML_COMPILED_DEFAULTSTYLE
+/*
+ * The default stylesheets, pre-parsed by mkdefaultstyle.tcl. See 
+ * defaultStyleOps() below.
+ */
+#include "htmldefaultstyle.c"
+static const CssParseOp aDefaultOps[] = {
+    HTML_DEFAULT_CSS_OPS
+    {0, 0, 0, 0}
+};
+static const CssParseOp aQuirksOps[] = {
+    HTML_DEFAULT_CSS_OPS
+    HTML_DEFAULT_QUIRKS_OPS
+    {0, 0, 0, 0}
+};
+#endif
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * defaultStyleOps --
+ *
+ *     If the library was built with TKHTML_COMPILED_DEFAULTSTYLE defined
+ *     and the stylesheet text zText (nText bytes) is either the built-in
+ *     default stylesheet or the built-in default stylesheet followed by 
+ *     the quirks-mode stylesheet (the value returned by 
+ *     [::tkhtml::htmlstyle -quirks]), return the pre-parsed version of 
+ *     the text.
+ *
+ * Results:
+ *     CssParseOp array to pass to cssParse(), or NULL.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static const CssParseOp *
+defaultStyleOps (const char *zText, int nText)
+{
+#ifdef TKHTML_COMPILED_DEFAULTSTYLE
+    static const char zDefault[] = HTML_DEFAULT_CSS;
+    static const char zQuirks[] = HTML_DEFAULT_QUIRKS;
+    const int nDefault = sizeof(zDefault) - 1;
+    const int nQuirks = sizeof(zQuirks) - 1;
+
+    if (nText >= nDefault && 0 == memcmp(zText, zDefault, nDefault)) {
+        if (nText == nDefault) {
+            return aDefaultOps;
+        }
+        if (nText == nDefault + nQuirks && 
+            0 == memcmp(&zText[nDefault], zQuirks, nQuirks)
+        ) {
+            return aQuirksOps;
+        }
+    }
+#endif
+    return 0;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssLoadDefaultStyle --
+ *
+ *     Load the default stylesheet, text pText, into the stylesheet 
+ *     configuration of widget pTree (creating an empty configuration if
+ *     there is none). 
+ *
+ *     The default stylesheet is parsed once per interpreter and cached in
+ *     the HtmlSharedData structure. If the cached copy was parsed from the
+ *     same text in the same mode (the mode affects how some lengths are 
+ *     parsed), it is linked to the widget stylesheet via the 
+ *     CssStyleSheet.pShared pointer instead of parsing pText again.
+ *     Otherwise pText is parsed into a new object, which is cached if 
+ *     there is no cached copy yet. If pText is one of the stylesheets 
+ *     compiled into the library (see defaultStyleOps()), the pre-parsed
+ *     rules are loaded instead of parsing the text.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May parse a stylesheet. Logs the time taken to the "STYLE" timer.
+ *
+ *---------------------------------------------------------------------------
+ */
+void
+HtmlCssLoadDefaultStyle (HtmlTree *pTree, Tcl_Obj *pText)
+{
+    HtmlSharedData *pShared = pTree->pShared;
+    CssStyleSheet *pAgent = 0;
+    const CssParseOp *aOp = 0;
+    CONST char *zText;
+    int nText;
+    clock_t styleClock = clock();
+
+    zText = Tcl_GetStringFromObj(pText, &nText);
+
+    if (pShared->pAgentStyle && pShared->eAgentMode == pTree->options.mode) {
+        int nCached;
+        CONST char *zCached;
+        zCached = Tcl_GetStringFromObj(pShared->pAgentText, &nCached);
+        if (nCached == nText && 0 == memcmp(zCached, zText, nText)) {
+            pAgent = pShared->pAgentStyle;
+            pAgent->nRef++;
+        }
+    }
+
+    if (!pAgent) {
+        Tcl_Obj *pStyleId = Tcl_NewObj();
+
+        /* If there is no shared stylesheet yet, this one becomes it. Its
+         * atoms must then be created in the shared table. This is only 
+         * possible if the widget has no atoms of its own yet (otherwise
+         * they might be duplicated in the shared table). In practice 
+         * this is always the first widget created in the interpreter.
+         */
+        int isShare = (!pShared->pAgentStyle && !pTree->aAtom.numEntries);
+
+        Tcl_IncrRefCount(pStyleId);
+        aOp = defaultStyleOps(zText, nText);
+        pTree->isSharedAtom = isShare;
+        cssParse(pTree, nText, zText, aOp, 0, 
+            CSS_ORIGIN_AGENT, pStyleId, 0, 0, 0, &pAgent
+        );
+        pTree->isSharedAtom = 0;
+        Tcl_DecrRefCount(pStyleId);
+
+        if (isShare) {
+            pShared->pAgentStyle = pAgent;
+            pShared->pAgentText = pText;
+            pShared->eAgentMode = pTree->options.mode;
+            Tcl_IncrRefCount(pText);
+            pAgent->nRef++;
+        }
+    }
+
+    if (!pTree->pStyle) {
+        pTree->pStyle = styleSheetNew(1);
+    }
+    HtmlCssStyleSheetFree(pTree->pStyle->pShared);
+    pTree->pStyle->pShared = pAgent;
+
+    HtmlTimer(pTree, "STYLE", "Default stylesheet: %s%s bytes=%d clicks=%d", 
+        (pAgent == pShared->pAgentStyle) ? "shared" : "private", 
+        (aOp ? " compiled" : ""), nText, (int)(clock() - styleClock)
+    );
 }
 
 /*--------------------------------------------------------------------------
@@ -2684,30 +2898,354 @@ ruleCompare(CssRule *pLeft, CssRule *pRight) {
     return res;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * pushRule --
+ *
+ *     Add rule pRule to the head of a rule list. The list is identified
+ *     either by a pointer to the list head (ppList) or by the hash table 
+ *     entry that stores the list head (pEntry). Exactly one of ppList and
+ *     pEntry should be non-NULL.
+ *
+ *     The rule is not inserted in priority order here. Instead, if this is
+ *     the first rule added to the list by the current parse, the list is 
+ *     recorded in CssParse.aDirty so that sortDirtyLists() can restore 
+ *     the ordering once the parse is finished.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May grow the CssParse.aDirty array.
+ *
+ *---------------------------------------------------------------------------
+ */
 static void 
-insertRule (CssRule **ppList, CssRule *pRule)
+pushRule (
+    CssParse *pParse, 
+    CssRule **ppList, 
+    Tcl_HashEntry *pEntry, 
+    CssRule *pRule
+)
 {
-    if (!*ppList || ruleCompare(*ppList, pRule) <= 0) {
-        /* If the default list is currently empty, or the rule being
-         * added has higher priority than the first rule in the list,
-         * our rule becomes the new head of the list.
-         */
-        pRule->pNext = *ppList;
+    CssRule *pHead;
+
+    assert((ppList && !pEntry) || (!ppList && pEntry));
+    pHead = (ppList ? *ppList : (CssRule *)Tcl_GetHashValue(pEntry));
+
+    /* If the list is empty, or the rule at the head of the list was not
+     * added by this parse, then this list has not yet been recorded in 
+     * the aDirty array. Rules added by this parse are identified by their
+     * CssRule.pPriority pointers.
+     */
+    if (!pHead || (
+        pHead->pPriority != pParse->pPriority1 && 
+        pHead->pPriority != pParse->pPriority2
+    )) {
+        CssDirtyList *pDirty;
+        if (pParse->nDirty == pParse->nDirtyAlloc) {
+            int nNew = pParse->nDirtyAlloc * 2 + 16;
+            pParse->aDirty = (CssDirtyList *)HtmlRealloc("CssParse.aDirty", 
+                pParse->aDirty, nNew * sizeof(CssDirtyList)
+            );
+            pParse->nDirtyAlloc = nNew;
+        }
+        pDirty = &pParse->aDirty[pParse->nDirty++];
+        pDirty->ppList = ppList;
+        pDirty->pEntry = pEntry;
+    }
+
+    pRule->pNext = pHead;
+    if (ppList) {
         *ppList = pRule;
     } else {
-        /* Otherwise insert the new rule into the list, ordered by
-         * priority. If there exists another rule with the same
-         * priority, then this rule is inserted into the list *before*
-         * it. This is because when rules are of equal priority, the
-         * latter specified wins.
-         */
-        CssRule *pR = *ppList;
-        while (pR->pNext && ruleCompare(pR->pNext, pRule)>0 ) {
-            pR = pR->pNext;
+        Tcl_SetHashValue(pEntry, pRule);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * ruleListMerge --
+ * ruleListSort --
+ *
+ *     Sort a linked list of CssRule objects so that the highest priority
+ *     rule (according to ruleCompare()) is at the head of the list.
+ *
+ *     The sort is stable. Where two rules are of equal priority, the rule
+ *     that appeared first in the input list appears first in the output.
+ *     Since pushRule() adds new rules to the head of a list, this means
+ *     that when two rules are of equal priority the one added most 
+ *     recently wins, just as it would if each rule had been inserted in 
+ *     priority order as it was parsed.
+ *
+ * Results:
+ *     Pointer to the head of the sorted list.
+ *
+ * Side effects:
+ *     Modifies CssRule.pNext pointers.
+ *
+ *---------------------------------------------------------------------------
+ */
+static CssRule *
+ruleListMerge (CssRule *pLeft, CssRule *pRight)
+{
+    CssRule *pRet = 0;
+    CssRule **ppTail = &pRet;
+
+    while (pLeft && pRight) {
+        if (ruleCompare(pLeft, pRight) >= 0) {
+            *ppTail = pLeft;
+            ppTail = &pLeft->pNext;
+            pLeft = pLeft->pNext;
+        } else {
+            *ppTail = pRight;
+            ppTail = &pRight->pNext;
+            pRight = pRight->pNext;
+        }
+    }
+    *ppTail = (pLeft ? pLeft : pRight);
+
+    return pRet;
+}
+static CssRule *
+ruleListSort (CssRule *pList)
+{
+    /* Bottom-up merge sort. aBin[i] is either NULL or a sorted list of
+     * 2^i rules. Lists in higher numbered bins contain rules that occured
+     * earlier in the input list.
+     */
+    CssRule *aBin[32];
+    CssRule *p;
+    int i;
+
+    memset(aBin, 0, sizeof(aBin));
+    while (pList) {
+        p = pList;
+        pList = p->pNext;
+        p->pNext = 0;
+        for (i = 0; i < 31 && aBin[i]; i++) {
+            p = ruleListMerge(aBin[i], p);
+            aBin[i] = 0;
+        }
+        aBin[i] = ruleListMerge(aBin[i], p);
+    }
+
+    p = 0;
+    for (i = 0; i < 32; i++) {
+        p = ruleListMerge(aBin[i], p);
+    }
+    return p;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * sortDirtyLists --
+ *
+ *     This is called at the end of a parse to sort each rule list that
+ *     was added to by pushRule() during the parse. See also the comments
+ *     above the CssDirtyList structure in cssInt.h.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Sorts rule lists and frees the CssParse.aDirty array.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+sortDirtyLists (CssParse *pParse)
+{
+    int ii;
+    for (ii = 0; ii < pParse->nDirty; ii++) {
+        CssDirtyList *pDirty = &pParse->aDirty[ii];
+        if (pDirty->ppList) {
+            *pDirty->ppList = ruleListSort(*pDirty->ppList);
+        } else {
+            CssRule *pList = (CssRule *)Tcl_GetHashValue(pDirty->pEntry);
+            Tcl_SetHashValue(pDirty->pEntry, ruleListSort(pList));
+        }
+    }
+
+    HtmlFree(pParse->aDirty);
+    pParse->aDirty = 0;
+    pParse->nDirty = 0;
+    pParse->nDirtyAlloc = 0;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * filterHash --
+ *
+ *     Return the hash value used by CssAncestorFilter objects for a tag 
+ *     name, class or id (eType is CSS_SELECTOR_TYPE, CSS_SELECTOR_CLASS or
+ *     CSS_SELECTOR_ID). Case is ignored. The returned value is never zero.
+ *
+ *     Since HtmlCssSelectorTest() compares class and id values without
+ *     regard to case, the hash must too. Folding the case of tag names as
+ *     well is harmless, as the filter only ever reports "may match".
+ *
+ * Results:
+ *     Non-zero hash value.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+#define FILTER_SLOT1(h) ((h) & (CSS_FILTER_SIZE - 1))
+#define FILTER_SLOT2(h) (((h) >> 16) & (CSS_FILTER_SIZE - 1))
+static unsigned int
+filterHash (int eType, const char *z, int n)
+{
+    unsigned int h = 2166136261U ^ (unsigned int)eType;
+    int ii;
+    if (n < 0) n = strlen(z);
+    for (ii = 0; ii < n; ii++) {
+        h = (h ^ (unsigned char)tolower((unsigned char)z[ii])) * 16777619U;
+    }
+    return (h ? h : 1);
+}
+
+static void
+filterAddHash (CssAncestorFilter *pFilter, unsigned int h)
+{
+    unsigned char *a = pFilter->aCount;
+    if (pFilter->nStack == pFilter->nStackAlloc) {
+        int nNew = pFilter->nStackAlloc * 2 + 64;
+        pFilter->aStack = (unsigned int *)HtmlRealloc(
+            "CssAncestorFilter.aStack", pFilter->aStack, nNew * sizeof(int)
+        );
+        pFilter->nStackAlloc = nNew;
+    }
+    pFilter->aStack[pFilter->nStack++] = h;
+
+    /* A counter that reaches 255 sticks there. It is never decremented
+     * again, so the filter never reports a false negative. */
+    if (h) {
+        if (a[FILTER_SLOT1(h)] < 255) a[FILTER_SLOT1(h)]++;
+        if (a[FILTER_SLOT2(h)] < 255) a[FILTER_SLOT2(h)]++;
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssFilterPush --
+ * HtmlCssFilterPop --
+ * HtmlCssFilterClear --
+ *
+ *     HtmlCssFilterPush() adds the tag name, id and classes of element
+ *     pNode to the filter. HtmlCssFilterPop() removes the values added
+ *     by the most recent Push() that has not already been popped.
+ *
+ *     HtmlCssFilterClear() frees the memory allocated by the filter
+ *     (but not the CssAncestorFilter structure itself).
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Modifies the filter.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlCssFilterPush (CssAncestorFilter *pFilter, HtmlNode *pNode)
+{
+    const char *zId;
+    const char *zClass;
+    int nHash = 0;
+
+    if (pNode->zTag) {
+        filterAddHash(pFilter, filterHash(CSS_SELECTOR_TYPE, pNode->zTag, -1));
+        nHash++;
+    }
+
+    zId = HtmlNodeAttr(pNode, "id");
+    if (zId) {
+        filterAddHash(pFilter, filterHash(CSS_SELECTOR_ID, zId, -1));
+        nHash++;
+    }
+
+    zClass = HtmlNodeAttr(pNode, "class");
+    if (zClass) {
+        int nClass;
+        while ((zClass = HtmlCssGetNextListItem(zClass,strlen(zClass),&nClass))){
+            filterAddHash(pFilter, filterHash(CSS_SELECTOR_CLASS,zClass,nClass));
+            zClass += nClass;
+            nHash++;
+        }
+    }
+
+    /* The last entry on the stack is the number of hashes for this node.
+     * Bypass the counters by pushing it as if it were a zero hash. */
+    filterAddHash(pFilter, 0);
+    pFilter->aStack[pFilter->nStack - 1] = nHash;
+}
+
+void 
+HtmlCssFilterPop (CssAncestorFilter *pFilter)
+{
+    unsigned char *a = pFilter->aCount;
+    int nHash;
+
+    assert(pFilter->nStack > 0);
+    nHash = pFilter->aStack[--pFilter->nStack];
+    assert(nHash <= pFilter->nStack);
+    while (nHash-- > 0) {
+        unsigned int h = pFilter->aStack[--pFilter->nStack];
+        if (a[FILTER_SLOT1(h)] < 255) a[FILTER_SLOT1(h)]--;
+        if (a[FILTER_SLOT2(h)] < 255) a[FILTER_SLOT2(h)]--;
+    }
+}
+
+void 
+HtmlCssFilterClear (CssAncestorFilter *pFilter)
+{
+    HtmlFree(pFilter->aStack);
+    pFilter->aStack = 0;
+    pFilter->nStack = 0;
+    pFilter->nStackAlloc = 0;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * filterMayMatch --
+ *
+ *     Check the CssRule.aAncestorHash values of rule pRule against the
+ *     ancestor filter.
+ *
+ * Results:
+ *     Zero if the rule cannot match the node whose ancestors are stored in
+ *     the filter, or non-zero if it may.
+ *
+ * Side effects:
+ *     Updates CssAncestorFilter.nTest and nReject.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+filterMayMatch (CssAncestorFilter *pFilter, CssRule *pRule)
+{
+    unsigned char *a = pFilter->aCount;
+    int ii;
+
+    if (!pRule->aAncestorHash[0]) return 1;
+    pFilter->nTest++;
+    for (ii = 0; ii < CSS_MAX_ANCESTOR_HASH && pRule->aAncestorHash[ii]; ii++){
+        unsigned int h = pRule->aAncestorHash[ii];
+        if (!a[FILTER_SLOT1(h)] || !a[FILTER_SLOT2(h)]) {
+            pFilter->nReject++;
+            return 0;
         }
-        pRule->pNext = pR->pNext;
-        pR->pNext = pRule;
     }
+    return 1;
 }
 
 /*
@@ -2800,18 +3338,62 @@ cssSelectorPropertySetPair (CssParse *pParse, CssSelector *pSelector, CssPropert
          }
     }
     pRule->specificity = spec;
-    assert(
-        pPropertySet == pParse->pPropertySet || 
-        pPropertySet == pParse->pImportant
-    );
-    if (pParse->pPropertySet == pPropertySet) {
-        pRule->pPriority = pParse->pPriority1;
-    } else {
-        pRule->pPriority = pParse->pPriority2;
+    selectorCompile(pParse->pTree, pSelector);
+
+    /* Count rules that depend on the siblings of a node. */
+    for (pS = pSelector; pS; pS = pS->pNext) {
+        if (pS->eSelector == CSS_SELECTORCHAIN_ADJACENT ||
+            pS->eSelector == CSS_PSEUDOCLASS_FIRSTCHILD ||
+            pS->eSelector == CSS_PSEUDOCLASS_LASTCHILD
+        ) {
+            pStyle->nSiblingRule++;
+            pRule->isSibling = 1;
+            break;
+        }
     }
-    pRule->iRule = pParse->iNextRule++;
 
-    /* Insert the rule into it's list. */
+    /* Calculate the CssRule.aAncestorHash values. A simple selector must
+     * match an ancestor of the node if the combinator immediately to the
+     * right of it (i.e. before it in the linked list) is a descendant or 
+     * child combinator. If it is an adjacent-sibling combinator, the simple
+     * selector must match a sibling of either the node or an ancestor. 
+     */
+    if (1) {
+        int isAncestor = 0;
+        int nHash = 0;
+        for (pS=pSelector; pS && nHash<CSS_MAX_ANCESTOR_HASH; pS=pS->pNext) {
+            switch (pS->eSelector) {
+                case CSS_SELECTORCHAIN_DESCENDANT:
+                case CSS_SELECTORCHAIN_CHILD:
+                    isAncestor = 1;
+                    break;
+                case CSS_SELECTORCHAIN_ADJACENT:
+                    isAncestor = 0;
+                    break;
+                case CSS_SELECTOR_TYPE:
+                case CSS_SELECTOR_CLASS:
+                case CSS_SELECTOR_ID:
+                    if (isAncestor && pS->zValue) {
+                        unsigned int h = filterHash(pS->eSelector,pS->zValue,-1);
+                        pRule->aAncestorHash[nHash++] = h;
+                    }
+                    break;
+            }
+        }
+    }
+
+    assert(
+        pPropertySet == pParse->pPropertySet || 
+        pPropertySet == pParse->pImportant
+    );
+    if (pParse->pPropertySet == pPropertySet) {
+        pRule->pPriority = pParse->pPriority1;
+    } else {
+        pRule->pPriority = pParse->pPriority2;
+    }
+    pRule->iRule = pParse->iNextRule++;
+
+    /* Insert the rule into it's list. */
     if (pParse->pStyleId) {
         pS = pSelector;
 
@@ -2833,43 +3415,64 @@ cssSelectorPropertySetPair (CssParse *pParse, CssSelector *pSelector, CssPropert
         switch (pS->eSelector) {
 
             case CSS_PSEUDOELEMENT_AFTER:
-                insertRule(&pStyle->pAfterRules, pRule);
+                pushRule(pParse, &pStyle->pAfterRules, 0, pRule);
                 break;
 
             case CSS_PSEUDOELEMENT_BEFORE:
-                insertRule(&pStyle->pBeforeRules, pRule);
+                pushRule(pParse, &pStyle->pBeforeRules, 0, pRule);
                 break;
     
-            case CSS_SELECTOR_ID:
-            case CSS_SELECTOR_CLASS:
             case CSS_SELECTOR_TYPE: {
+                /* Rules for known tags are stored in an array indexed by
+                 * tag type. Unknown tags use the aByTag hash table. 
+                 */
+                HtmlTokenMap *pMap = HtmlHashLookup(0, pS->zValue);
+                if (pMap) {
+                    pushRule(pParse, &pStyle->apByTagType[pMap->type], 0, pRule);
+                } else {
+                    int newentry;
+                    Tcl_HashEntry *p;
+                    p = Tcl_CreateHashEntry(
+                        &pStyle->aByTag, pS->zValue, &newentry
+                    );
+                    if (newentry) { 
+                        Tcl_SetHashValue(p, 0);
+                    }
+                    pushRule(pParse, 0, p, pRule);
+                }
+                break;
+            }
+
+            case CSS_SELECTOR_ID:
+            case CSS_SELECTOR_CLASS: {
+                /* The aById and aByClass tables are keyed by the atom for
+                 * the id or class name (see HtmlNodeGetAtoms()).
+                 */
                 int newentry;
                 Tcl_HashTable *pTab;
                 Tcl_HashEntry *p;
-                CssRule *pList = 0;
+                const char *zAtom;
 
-                pTab = &pStyle->aByTag;
-                switch (pS->eSelector) {
-                    case CSS_SELECTOR_ID:    pTab = &pStyle->aById; break;
-                    case CSS_SELECTOR_CLASS: pTab = &pStyle->aByClass; break;
-                    case CSS_SELECTOR_TYPE:  pTab = &pStyle->aByTag; break;
+                pTab = &pStyle->aByClass;
+                if (pS->eSelector == CSS_SELECTOR_ID) {
+                    pTab = &pStyle->aById;
                 }
 
-                p = Tcl_CreateHashEntry(pTab, pS->zValue, &newentry);
-                if (!newentry) { 
-                    pList = (CssRule *)Tcl_GetHashValue(p); 
+                zAtom = selectorAtom(pParse->pTree, pS->zValue);
+                p = Tcl_CreateHashEntry(pTab, zAtom, &newentry);
+                if (newentry) { 
+                    Tcl_SetHashValue(p, 0);
                 }
-                insertRule(&pList, pRule);
-                Tcl_SetHashValue(p, pList);
+                pushRule(pParse, 0, p, pRule);
                 break;
             }
     
             default:
-                insertRule(&pStyle->pUniversalRules, pRule);
+                pushRule(pParse, &pStyle->pUniversalRules, 0, pRule);
                 break;
         }
     } else {
-        insertRule(&pStyle->pUniversalRules, pRule);
+        pushRule(pParse, &pStyle->pUniversalRules, 0, pRule);
     }
 
     pRule->pSelector = pSelector;
@@ -3031,11 +3634,142 @@ attrTest (int eType, const char *zString, const char *zAttr)
     return 0;
 }
 
+#define N_TYPE(x)        HtmlNodeTagName(x)
+#define N_ATTR(x,y)      HtmlNodeAttr(x,y)
+#define N_PARENT(x)      HtmlNodeParent(x)
+#define N_NUMCHILDREN(x) HtmlNodeNumChildren(x)
+#define N_CHILD(x,y)     HtmlNodeChild(x,y)
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorAdjacent --
+ *
+ *     Return the nearest left-hand sibling of node x that is not 
+ *     white-space, or NULL if there is no such sibling (or x is generated
+ *     content). Used to test the "+" combinator.
+ *
+ * Results:
+ *     See above.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+static HtmlNode *
+selectorAdjacent (HtmlNode *x)
+{
+    HtmlNode *pParent = N_PARENT(x);
+    int i;
+
+    if (
+        !pParent || 
+        ((HtmlElementNode *)pParent)->pBefore == x ||
+        ((HtmlElementNode *)pParent)->pAfter == x 
+    ) {
+        return 0;
+    }
+
+    for (i = 0; N_CHILD(pParent, i) != x; i++);
+    i--;
+    do {
+        x = N_CHILD(pParent, i);
+        i--;
+    } while (i >= 0 && HtmlNodeIsWhitespace(x));
+    if (i < 0) return 0;
+
+    return x;
+}
+
 /*--------------------------------------------------------------------------
  *
- * HtmlCssSelectorTest --
+ * selectorIsFirstChild --
+ * selectorIsLastChild --
  *
- *     Test if a selector matches a document node.
+ *     Return true if node x is the left-most (right-most) child of its
+ *     parent, not including white-space nodes. Used to test the 
+ *     :first-child and :last-child pseudo-classes.
+ *
+ * Results:
+ *     See above.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+static int
+selectorIsFirstChild (HtmlNode *x)
+{
+    HtmlNode *pParent = N_PARENT(x);
+    int i;
+    if (!pParent) return 0;
+    for (i = 0; i < N_NUMCHILDREN(pParent); i++) {
+        HtmlNode *pChild = N_CHILD(pParent, i);
+        if (pChild == x) break;
+        if (!HtmlNodeIsWhitespace(pChild)) return 0;
+    }
+    assert(i < N_NUMCHILDREN(pParent));
+    return 1;
+}
+static int
+selectorIsLastChild (HtmlNode *x)
+{
+    HtmlNode *pParent = N_PARENT(x);
+    int i;
+    if (!pParent) return 0;
+    for (i = N_NUMCHILDREN(pParent) - 1; i >= 0; i--) {
+        HtmlNode *pChild = N_CHILD(pParent, i);
+        if (pChild == x) break;
+        if (!HtmlNodeIsWhitespace(pChild)) return 0;
+    }
+    assert(i >= 0);
+    return 1;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorDynamicTest --
+ *
+ *     Test the dynamic pseudo-class eSelector (one of CSS_PSEUDOCLASS_LINK,
+ *     VISITED, ACTIVE, HOVER or FOCUS) against element pElem. If 
+ *     dynamic_true is non-zero, :active, :hover and :focus always match.
+ *
+ * Results:
+ *     Non-zero if the pseudo-class matches.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+static int
+selectorDynamicTest (int eSelector, HtmlElementNode *pElem, int dynamic_true)
+{
+    switch (eSelector) {
+        case CSS_PSEUDOCLASS_ACTIVE:
+            return (dynamic_true || (pElem->flags & HTML_DYNAMIC_ACTIVE));
+        case CSS_PSEUDOCLASS_HOVER:
+            return (dynamic_true || (pElem->flags & HTML_DYNAMIC_HOVER));
+        case CSS_PSEUDOCLASS_FOCUS:
+            return (dynamic_true || (pElem->flags & HTML_DYNAMIC_FOCUS));
+        case CSS_PSEUDOCLASS_LINK:
+            return (pElem->flags & HTML_DYNAMIC_LINK);
+        case CSS_PSEUDOCLASS_VISITED:
+            return (pElem->flags & HTML_DYNAMIC_VISITED);
+    }
+    assert(!"Impossible");
+    return 0;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorInterpret --
+ *
+ *     Test if a selector matches a document node by walking the linked
+ *     list of CssSelector structures. This is used for selectors that
+ *     have not been compiled (see selectorCompile()), and as a reference 
+ *     by the [widget _selectorbench] command.
  *
  * Results:
  *     Non-zero is returned if the Selector does match the node.
@@ -3045,13 +3779,8 @@ attrTest (int eType, const char *zString, const char *zAttr)
  *
  *--------------------------------------------------------------------------
  */
-#define N_TYPE(x)        HtmlNodeTagName(x)
-#define N_ATTR(x,y)      HtmlNodeAttr(x,y)
-#define N_PARENT(x)      HtmlNodeParent(x)
-#define N_NUMCHILDREN(x) HtmlNodeNumChildren(x)
-#define N_CHILD(x,y)     HtmlNodeChild(x,y)
-int 
-HtmlCssSelectorTest (CssSelector *pSelector, HtmlNode *pNode, int dynamic_true)
+static int 
+selectorInterpret (CssSelector *pSelector, HtmlNode *pNode, int dynamic_true)
 {
     CssSelector *p = pSelector;
     HtmlNode *x = pNode;
@@ -3102,7 +3831,7 @@ HtmlCssSelectorTest (CssSelector *pSelector, HtmlNode *pNode, int dynamic_true)
                 HtmlNode *pParent = N_PARENT(x);
                 CssSelector *pNext = p->pNext;
                 while (pParent) {
-                    if (HtmlCssSelectorTest(pNext, pParent, dynamic_true)) {
+                    if (selectorInterpret(pNext, pParent, dynamic_true)) {
                         return 1;
                     }
                     pParent = N_PARENT(pParent);
@@ -3112,101 +3841,299 @@ HtmlCssSelectorTest (CssSelector *pSelector, HtmlNode *pNode, int dynamic_true)
             case CSS_SELECTORCHAIN_CHILD:
                 x = N_PARENT(x);
                 break;
-            case CSS_SELECTORCHAIN_ADJACENT: {
-                HtmlNode *pParent = N_PARENT(x);
-                int i;
+            case CSS_SELECTORCHAIN_ADJACENT:
+                x = selectorAdjacent(x);
+                if (!x) return 0;
+                break;
+
+            case CSS_PSEUDOCLASS_FIRSTCHILD:
+                if (!selectorIsFirstChild(x)) return 0;
+                break;
+            case CSS_PSEUDOCLASS_LASTCHILD:
+                if (!selectorIsLastChild(x)) return 0;
+                break;
+                
+            case CSS_PSEUDOCLASS_LANG:
+                return 0;
+
+
+            case CSS_PSEUDOELEMENT_FIRSTLINE:
+            case CSS_PSEUDOELEMENT_FIRSTLETTER:
+                return 0;
 
-                if (
-                    !pParent || 
-                    ((HtmlElementNode *)pParent)->pBefore == x ||
-                    ((HtmlElementNode *)pParent)->pAfter == x 
-                ) {
+            case CSS_PSEUDOELEMENT_BEFORE:
+            case CSS_PSEUDOELEMENT_AFTER:
+                break;
+
+            case CSS_PSEUDOCLASS_ACTIVE:
+            case CSS_PSEUDOCLASS_HOVER:
+            case CSS_PSEUDOCLASS_FOCUS:
+            case CSS_PSEUDOCLASS_LINK:
+            case CSS_PSEUDOCLASS_VISITED:
+                if (!selectorDynamicTest(p->eSelector, pElem, dynamic_true)) {
                     return 0;
                 }
+                break;
 
-                /* Search for the nearest left-hand sibling that is not
-                 * white-space. If no such sibling exists, set x==0 (this
-                 * will cause the selector-match to fail). If the sibling
-                 * does exist, set x to point at it.
-                 */
-                for (i = 0; N_CHILD(pParent, i) != x; i++);
-                i--;
-                do {
-                    x = N_CHILD(pParent, i);
-                    i--;
-                } while (i >= 0 && HtmlNodeIsWhitespace(x));
-                if (i < 0) return 0;
+            case CSS_SELECTOR_NEVERMATCH:
+                return 0;
+
+            default:
+                assert(!"Impossible");
+        }
+        p = p->pNext;
+    }
+
+    return (x && !p)?1:0;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorAtom --
+ *
+ *     Return the atom for string zString (see HtmlAtom()), creating it
+ *     if required. Since atoms are case-insensitive, this may return a 
+ *     string that differs from zString in case.
+ *
+ * Results:
+ *     Atom string. Valid for the lifetime of the widget.
+ *
+ * Side effects:
+ *     May add an atom.
+ *
+ *--------------------------------------------------------------------------
+ */
+static const char *
+selectorAtom (HtmlTree *pTree, const char *zString)
+{
+    return HtmlAtom(pTree, zString);
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorCompile --
+ *
+ *     Compile the selector pSelector into a program - an array of 
+ *     CssSelectorOp structures stored in pSelector->aOp - that can be
+ *     run by selectorProgramTest(). Type selectors are resolved to
+ *     HtmlNode.eTag values (or to an atom for unknown tags), class and id
+ *     names are interned (see HtmlAtom()) and attribute names are 
+ *     replaced by their atoms (see HtmlAttrAtom()).
+ *
+ *     Nothing is done if pSelector has already been compiled (the same
+ *     selector may be paired with more than one property set), or if 
+ *     there is no widget to provide an atom table.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May set pSelector->aOp.
+ *
+ *--------------------------------------------------------------------------
+ */
+static void
+selectorCompile (HtmlTree *pTree, CssSelector *pSelector)
+{
+    CssSelector *pS;
+    CssSelectorOp *aOp;
+    int nOp = 0;
+
+    if (!pTree || pSelector->aOp) return;
 
+    for (pS = pSelector; pS; pS = pS->pNext) nOp++;
+    aOp = (CssSelectorOp *)HtmlClearAlloc(
+        "CssSelectorOp", sizeof(CssSelectorOp) * (nOp + 1)
+    );
+
+    for (nOp = 0, pS = pSelector; pS; pS = pS->pNext, nOp++) {
+        CssSelectorOp *pOp = &aOp[nOp];
+        pOp->eOp = pS->eSelector;
+        pOp->zValue = pS->zValue;
+        switch (pS->eSelector) {
+            case CSS_SELECTOR_TYPE: {
+                HtmlTokenMap *pMap = HtmlHashLookup(0, pS->zValue);
+                if (pMap) {
+                    pOp->eTag = pMap->type;
+                    pOp->zValue = pMap->zName;
+                } else {
+                    pOp->zValue = selectorAtom(pTree, pS->zValue);
+                }
                 break;
             }
+            case CSS_SELECTOR_CLASS:
+            case CSS_SELECTOR_ID:
+                pOp->zValue = selectorAtom(pTree, pS->zValue);
+                break;
+            case CSS_SELECTOR_ATTR:
+            case CSS_SELECTOR_ATTRVALUE:
+            case CSS_SELECTOR_ATTRLISTVALUE:
+            case CSS_SELECTOR_ATTRHYPHEN:
+                pOp->zAttr = HtmlAttrAtom(pS->zAttr, 1);
+                break;
+        }
+    }
+    assert(aOp[nOp].eOp == 0);
 
-            case CSS_PSEUDOCLASS_FIRSTCHILD: {
-                /* :first-child selector matches if x is the left-most child
-                 * of it's parent, not including white-space nodes. */
-                HtmlNode *pParent = N_PARENT(x);
-                int i;
-                if (!pParent) return 0;
-                for (i = 0; i < N_NUMCHILDREN(pParent); i++) {
-                    HtmlNode *pChild = N_CHILD(pParent, i);
-                    if (pChild == x) break;
-                    if (!HtmlNodeIsWhitespace(pChild)) return 0;
+    pSelector->aOp = aOp;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * selectorProgramTest --
+ *
+ *     Run a selector program compiled by selectorCompile() against
+ *     document node pNode. 
+ *
+ * Results:
+ *     Non-zero is returned if the selector does match the node.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+static int 
+selectorProgramTest (CssSelectorOp *aOp, HtmlNode *pNode, int dynamic_true)
+{
+    CssSelectorOp *pOp;
+    HtmlNode *x = pNode;
+
+    for (pOp = aOp; pOp->eOp && x; pOp++) {
+        HtmlElementNode *pElem = HtmlNodeAsElement(x);
+
+        switch (pOp->eOp) {
+            case CSS_SELECTOR_UNIVERSAL:
+                break;
+
+            case CSS_SELECTOR_TYPE:
+                /* Known tags are compared by type. Unknown tags (eTag==0)
+                 * are compared by atom, falling back to a string compare
+                 * in case the node tag was not interned. 
+                 */
+                if (!pElem || x->eTag != pOp->eTag) return 0;
+                if (pOp->eTag == 0 && x->zTag != pOp->zValue && (
+                    !x->zTag || stricmp(x->zTag, pOp->zValue)
+                )) {
+                    return 0;
                 }
-                assert(i < N_NUMCHILDREN(pParent));
                 break;
-            }
-            case CSS_PSEUDOCLASS_LASTCHILD: {
-                /* :last-child selector matches if x is the right-most child
-                 * of it's parent, not including white-space nodes. */
-                HtmlNode *pParent = N_PARENT(x);
-                int i;
-                if (!pParent) return 0;
-                for (i = N_NUMCHILDREN(pParent) - 1; i >= 0; i--) {
-                    HtmlNode *pChild = N_CHILD(pParent, i);
-                    if (pChild == x) break;
-                    if (!HtmlNodeIsWhitespace(pChild)) return 0;
+
+            /* Class and id names are compared by atom if the atoms for
+             * node x have been cached by HtmlNodeGetAtoms(). 
+             */
+            case CSS_SELECTOR_CLASS:
+                if (pElem && pElem->pAtoms) {
+                    HtmlNodeAtoms *pAtoms = pElem->pAtoms;
+                    int ii;
+                    for (ii = 0; ii < pAtoms->nClass; ii++) {
+                        if (pAtoms->azClass[ii] == pOp->zValue) break;
+                    }
+                    if (ii == pAtoms->nClass) return 0;
+                } else if (!attrTest(
+                    CSS_SELECTOR_ATTRLISTVALUE, pOp->zValue, N_ATTR(x,"class")
+                )) {
+                    return 0;
                 }
-                assert(i >= 0);
                 break;
-            }
-                
-            case CSS_PSEUDOCLASS_LANG:
-                return 0;
 
+            case CSS_SELECTOR_ID:
+                if (pElem && pElem->pAtoms) {
+                    if (pElem->pAtoms->zId != pOp->zValue) return 0;
+                } else if (!attrTest(
+                    CSS_SELECTOR_ATTRVALUE, pOp->zValue, N_ATTR(x, "id")
+                )) {
+                    return 0;
+                }
+                break;
 
-            case CSS_PSEUDOELEMENT_FIRSTLINE:
-            case CSS_PSEUDOELEMENT_FIRSTLETTER:
+            case CSS_SELECTOR_ATTR:
+            case CSS_SELECTOR_ATTRVALUE:
+            case CSS_SELECTOR_ATTRLISTVALUE:
+            case CSS_SELECTOR_ATTRHYPHEN:
+                if (!attrTest(pOp->eOp, pOp->zValue, HtmlMarkupArgAtom(
+                    pElem ? pElem->pAttributes : 0, pOp->zAttr, 0
+                ))) {
+                    return 0;
+                }
+                break;
+
+            case CSS_SELECTORCHAIN_DESCENDANT: {
+                HtmlNode *pParent;
+                for (pParent = N_PARENT(x); pParent; pParent=N_PARENT(pParent)){
+                    if (selectorProgramTest(&pOp[1], pParent, dynamic_true)) {
+                        return 1;
+                    }
+                }
                 return 0;
+            }
+            case CSS_SELECTORCHAIN_CHILD:
+                x = N_PARENT(x);
+                break;
+            case CSS_SELECTORCHAIN_ADJACENT:
+                x = selectorAdjacent(x);
+                if (!x) return 0;
+                break;
+
+            case CSS_PSEUDOCLASS_FIRSTCHILD:
+                if (!selectorIsFirstChild(x)) return 0;
+                break;
+            case CSS_PSEUDOCLASS_LASTCHILD:
+                if (!selectorIsLastChild(x)) return 0;
+                break;
 
             case CSS_PSEUDOELEMENT_BEFORE:
             case CSS_PSEUDOELEMENT_AFTER:
                 break;
 
             case CSS_PSEUDOCLASS_ACTIVE:
-                if (dynamic_true || (pElem->flags & HTML_DYNAMIC_ACTIVE)) break;
-                return 0;
             case CSS_PSEUDOCLASS_HOVER:
-                if (dynamic_true || (pElem->flags & HTML_DYNAMIC_HOVER)) break;
-                return 0;
             case CSS_PSEUDOCLASS_FOCUS:
-                if (dynamic_true || (pElem->flags & HTML_DYNAMIC_FOCUS)) break;
-                return 0;
             case CSS_PSEUDOCLASS_LINK:
-                if (pElem->flags & HTML_DYNAMIC_LINK) break;
-                return 0;
             case CSS_PSEUDOCLASS_VISITED:
-                if (pElem->flags & HTML_DYNAMIC_VISITED) break;
-                return 0;
+                if (!selectorDynamicTest(pOp->eOp, pElem, dynamic_true)) {
+                    return 0;
+                }
+                break;
 
+            case CSS_PSEUDOCLASS_LANG:
+            case CSS_PSEUDOELEMENT_FIRSTLINE:
+            case CSS_PSEUDOELEMENT_FIRSTLETTER:
             case CSS_SELECTOR_NEVERMATCH:
                 return 0;
 
             default:
                 assert(!"Impossible");
         }
-        p = p->pNext;
     }
-
-    return (x && !p)?1:0;
+
+    return (x && !pOp->eOp) ? 1 : 0;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * HtmlCssSelectorTest --
+ *
+ *     Test if a selector matches a document node. If the selector has
+ *     been compiled, run the compiled program. Otherwise interpret the 
+ *     linked list of CssSelector structures.
+ *
+ * Results:
+ *     Non-zero is returned if the Selector does match the node.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+int 
+HtmlCssSelectorTest (CssSelector *pSelector, HtmlNode *pNode, int dynamic_true)
+{
+    assert(HtmlNodeAsElement(pNode));
+    if (pSelector->aOp) {
+        return selectorProgramTest(pSelector->aOp, pNode, dynamic_true);
+    }
+    return selectorInterpret(pSelector, pNode, dynamic_true);
 }
 
 /*
@@ -3378,35 +4305,251 @@ applyRule (HtmlTree *pTree, HtmlNode *pNode, CssRule *pRule, int *aPropDone, cha
     return isMatch;
 }
 
+/*
+ * The following hard-coded constant is used by HtmlCssStyleSheetApply(). 
+ * See the comments above that function. MAX_RULE_LISTS is the maximum 
+ * number of rules lists that may apply to a single node - the universal,
+ * by-tag, by-id and by-class lists of both the widget stylesheet and the
+ * shared default stylesheet.
+ */
+#define MAX_CLASSES    126
+#define MAX_RULE_LISTS (2 * (MAX_CLASSES + 2))
+
+/*
+ * A RuleQueue is used by HtmlCssStyleSheetApply() to merge the rule lists
+ * that may apply to a single node (the universal list, the by-tag list, the
+ * by-id list and one list for each class) into a single sequence in
+ * priority order. It is a binary heap of list indexes, ordered by the
+ * priority of the rule currently at the head of each list. This makes
+ * extracting each rule O(log(N)) in the number of lists, instead of O(N).
+ *
+ * RuleQueue.nStep counts the number of rule comparisons made while merging.
+ * It is reported in the "STYLEENGINE" log output.
+ */
+typedef struct RuleQueue RuleQueue;
+struct RuleQueue {
+    CssRule **apList;              /* Array of list heads */
+    int n;                         /* Number of valid entries in aHeap */
+    int nStep;                     /* Number of merge comparisons made */
+    int aHeap[MAX_RULE_LISTS];     /* Heap of indexes into apList */
+};
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * ruleQueueBefore --
+ *
+ *     Return true if the rule at the head of list iLeft should be returned
+ *     before the rule at the head of list iRight. If the two rules are of
+ *     equal priority, the list with the lower index wins.
+ *
+ * Results:
+ *     See above.
+ *
+ * Side effects:
+ *     Increments RuleQueue.nStep.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+ruleQueueBefore (RuleQueue *pQueue, int iLeft, int iRight)
+{
+    int res;
+    pQueue->nStep++;
+    res = ruleCompare(pQueue->apList[iLeft], pQueue->apList[iRight]);
+    return (res > 0 || (res == 0 && iLeft < iRight));
+}
+
+static void
+ruleQueueSiftDown (RuleQueue *pQueue, int iPos)
+{
+    int *aHeap = pQueue->aHeap;
+    for (;;) {
+        int iBest = iPos;
+        int iChild = iPos * 2 + 1;
+        int tmp;
+
+        if (iChild < pQueue->n && 
+            ruleQueueBefore(pQueue, aHeap[iChild], aHeap[iBest])
+        ) {
+            iBest = iChild;
+        }
+        iChild++;
+        if (iChild < pQueue->n && 
+            ruleQueueBefore(pQueue, aHeap[iChild], aHeap[iBest])
+        ) {
+            iBest = iChild;
+        }
+        if (iBest == iPos) break;
+
+        tmp = aHeap[iPos];
+        aHeap[iPos] = aHeap[iBest];
+        aHeap[iBest] = tmp;
+        iPos = iBest;
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * ruleQueueInit --
+ *
+ *     Initialise a RuleQueue structure to merge the n rule lists in array
+ *     apRule. The RuleQueue modifies the entries of apRule as rules are
+ *     extracted, so the array must remain valid while the queue is in use.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+ruleQueueInit (RuleQueue *pQueue, CssRule **apRule, int n)
+{
+    int i;
+
+    assert(n <= MAX_RULE_LISTS);
+    pQueue->apList = apRule;
+    pQueue->n = 0;
+    pQueue->nStep = 0;
+    for (i = 0; i < n; i++) {
+        if (apRule[i]) {
+            pQueue->aHeap[pQueue->n++] = i;
+        }
+    }
+    for (i = pQueue->n / 2 - 1; i >= 0; i--) {
+        ruleQueueSiftDown(pQueue, i);
+    }
+}
+
 /*--------------------------------------------------------------------------
  *
  * nextRule --
  *
+ *     Extract the next rule, in priority order, from the RuleQueue.
+ *
  * Results:
+ *     Pointer to the highest priority rule not yet returned, or NULL if
+ *     all lists have been exhausted.
  *
  * Side effects:
+ *     Advances one of the lists being merged.
  *
  *--------------------------------------------------------------------------
  */
 static CssRule *
-nextRule (CssRule **apRule, int n)
+nextRule (RuleQueue *pQueue)
 {
-    CssRule **ppRule = 0;
-    CssRule *pRet = 0;
-    int i;
+    CssRule *pRet;
+    int iList;
 
-    for (i = 0; i < n; i++) {
-        if (apRule[i] && (ppRule == 0 || ruleCompare(apRule[i], *ppRule) > 0)) {
-            ppRule = &apRule[i];
+    if (pQueue->n == 0) return 0;
+
+    iList = pQueue->aHeap[0];
+    pRet = pQueue->apList[iList];
+    pQueue->apList[iList] = pRet->pNext;
+    if (!pRet->pNext) {
+        pQueue->aHeap[0] = pQueue->aHeap[--pQueue->n];
+    }
+    ruleQueueSiftDown(pQueue, 0);
+
+    return pRet;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * ruleListsForNode --
+ *
+ *     Append the rules lists from stylesheet pStyle that may apply to
+ *     node pNode to array apRule, starting at index nRule. These are the
+ *     universal list, the by-tag list, the by-id list and one list for
+ *     each class the node belongs to (up to MAX_CLASSES). The aById and 
+ *     aByClass tables are keyed by atom, and the node atoms (argument 
+ *     pAtoms) are those cached by HtmlNodeGetAtoms().
+ *
+ * Results:
+ *     The new number of entries in apRule.
+ *
+ * Side effects:
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+static int
+ruleListsForNode (
+    CssStyleSheet *pStyle, 
+    HtmlNode *pNode, 
+    HtmlNodeAtoms *pAtoms, 
+    CssRule **apRule,
+    int nRule
+)
+{
+    Tcl_HashEntry *pEntry;
+    int nMax = nRule + MAX_CLASSES + 2;
+    int ii;
+
+    assert(nMax <= MAX_RULE_LISTS);
+
+    if (pStyle->pUniversalRules) {
+        apRule[nRule++] = pStyle->pUniversalRules;
+    }
+
+    if (pNode->eTag) {
+        if (pStyle->apByTagType[pNode->eTag]) {
+            apRule[nRule++] = pStyle->apByTagType[pNode->eTag];
+        }
+    } else {
+        pEntry = Tcl_FindHashEntry(&pStyle->aByTag, pNode->zTag);
+        if (pEntry) {
+            apRule[nRule++] = (CssRule *)Tcl_GetHashValue(pEntry);
         }
     }
 
-    if (ppRule) {
-        pRet = *ppRule;
-        *ppRule = (*ppRule)->pNext;
+    if (pAtoms->zId) {
+        pEntry = Tcl_FindHashEntry(&pStyle->aById, pAtoms->zId);
+        if (pEntry) {
+            apRule[nRule++] = (CssRule *)Tcl_GetHashValue(pEntry);
+        }
+    }
+    for (ii = 0; ii < pAtoms->nClass && nRule < nMax; ii++) {
+        pEntry = Tcl_FindHashEntry(&pStyle->aByClass, pAtoms->azClass[ii]);
+        if (pEntry) {
+            apRule[nRule++] = (CssRule *)Tcl_GetHashValue(pEntry);
+        }
     }
 
-    return pRet;
+    return nRule;
+}
+
+/*--------------------------------------------------------------------------
+ *
+ * HtmlCssHasSiblingRules --
+ *
+ *     Return true if the widget stylesheet or the shared default 
+ *     stylesheet contains at least one rule whose selector depends on 
+ *     the siblings of a node ("+", ":first-child" or ":last-child").
+ *
+ * Results:
+ *
+ *     Boolean.
+ *
+ * Side effects:
+ *
+ *     None.
+ *
+ *--------------------------------------------------------------------------
+ */
+int 
+HtmlCssHasSiblingRules (HtmlTree *pTree)
+{
+    CssStyleSheet *pS;
+    for (pS = pTree->pStyle; pS; pS = pS->pShared) {
+        if (pS->nSiblingRule > 0) return 1;
+    }
+    return 0;
 }
 
 /*--------------------------------------------------------------------------
@@ -3418,26 +4561,35 @@ nextRule (CssRule **apRule, int n)
  *     returns, the HtmlNode.pPropertyValues variable points to the
  *     structure containing the computed values applied to the node.
  *
- *     NOTE: There are two hard-coded limits in this function:
- *         1) No element may be a member of more than 126 classes.  
- *         2) No class name may be longer than 128 bytes (includes null term).
+ *     If argument pFilter is not NULL, it must contain the tag names, ids
+ *     and classes of the ancestors of pNode (see HtmlCssFilterPush()). It
+ *     is used to skip rules that cannot match without testing them.
+ *
+ *     The return value indicates whether or not the computed values may 
+ *     be shared with a sibling of pNode that has the same tag, attributes,
+ *     dynamic flags and no override properties. This is true unless a 
+ *     rule keyed on the tag, id or classes of pNode and not rejected by 
+ *     the ancestor filter has a sibling-dependent selector, or a tcl() 
+ *     property value was evaluated for pNode.
+ *
+ *     NOTE: There is a hard-coded limit in this function: rules keyed by
+ *     class are only considered for the first 126 classes of an element.
  *
  * Results:
  *
- *     None.
+ *     True if the computed values may be shared, as described above.
  *
  * Side effects:
  *
  *--------------------------------------------------------------------------
  */
-void 
-HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode) 
+int 
+HtmlCssStyleSheetApply (
+    HtmlTree *pTree, 
+    HtmlNode *pNode, 
+    CssAncestorFilter *pFilter         /* Ancestors of pNode, or NULL */
+) 
 {
-
-    /* The two hard coded constants mentioned above */
-    #define MAX_CLASSES    126
-    #define MAX_CLASS_NAME 128
-
     CssStyleSheet *pStyle = pTree->pStyle;    /* Stylesheet config */
     CssRule *pRule;                           /* Iterator variable */
 
@@ -3453,60 +4605,30 @@ HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode)
      */
     int aPropDone[CSS_PROPERTY_MAX_PROPERTY + 1];
 
-    Tcl_HashEntry *pEntry;
-    char const *zClassAttr;            /* Value of node "class" attribute */
-    char const *zIdAttr;               /* Value of node "id" attribute */
+    CssStyleSheet *pS;
+    HtmlNodeAtoms *pAtoms;             /* Interned node class and id names */
+    int nSiblingRule = 0;              /* Sibling rules tested for pNode */
 
-    CssRule *apRule[MAX_CLASSES + 2];  /* Array of applicable rules lists. */
+    CssRule *apRule[MAX_RULE_LISTS];   /* Array of applicable rules lists. */
     int npRule;
+    RuleQueue sQueue;                  /* Used to merge the apRule[] lists */
 
     int nSelectorMatch = 0;
     int nSelectorTest = 0;
+    int nFilterReject = 0;
+    int isShareable;
 
     HtmlElementNode *pElem = HtmlNodeAsElement(pNode);
     assert(pElem);
 
-    /* The universal rules list applies to all nodes */
-    apRule[0] = pStyle->pUniversalRules;
-    npRule = 1;
-
-    /* Find the applicable "by-tag" rules list, if any. */
-    pEntry = Tcl_FindHashEntry(&pStyle->aByTag, pNode->zTag);
-    if (pEntry) {
-        apRule[npRule++] = Tcl_GetHashValue(pEntry);
-    }
-
-    /* Find a rules list for the element id, if any */
-    zIdAttr = HtmlNodeAttr(pNode, "id");
-    if (zIdAttr) {
-        pEntry = Tcl_FindHashEntry(&pStyle->aById, zIdAttr);
-        if (pEntry) {
-            apRule[npRule++] = (CssRule *)Tcl_GetHashValue(pEntry);
-        }
-    }
-
-    /* Find a rules list for each class the element belongs to */
-    zClassAttr = HtmlNodeAttr(pNode, "class");
-    if (zClassAttr) {
-        int nClass;
-        char const *zClass = zClassAttr;
-        char zTerm[MAX_CLASS_NAME];
-
-        while (
-            npRule < (MAX_CLASSES + 2) &&
-            (zClass = HtmlCssGetNextListItem(zClass, strlen(zClass), &nClass))
-        ) {
-            strncpy(zTerm, zClass, MIN(MAX_CLASS_NAME, nClass));
-            zTerm[MIN(MAX_CLASS_NAME - 1, nClass)] = '\0';
-            zClass += nClass;
-
-            pEntry = Tcl_FindHashEntry(&pStyle->aByClass, zTerm);
-            if (pEntry) {
-                apRule[npRule++] = (CssRule *)Tcl_GetHashValue(pEntry);
-            }
-        }
+    /* Find the rules lists that may apply to this node, in both the 
+     * widget stylesheet and the shared default stylesheet. 
+     */
+    pAtoms = HtmlNodeGetAtoms(pTree, pNode);
+    npRule = 0;
+    for (pS = pStyle; pS; pS = pS->pShared) {
+        npRule = ruleListsForNode(pS, pNode, pAtoms, apRule, npRule);
     }
-    
 
     /* Initialise aPropDone and sCreator */
     HtmlComputedValuesInit(pTree, pNode, 0, &sCreator);
@@ -3523,11 +4645,8 @@ HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode)
     /* Loop through the list of CSS rules in the stylesheet. Rules that occur
      * earlier in the list have a higher priority than those that occur later.
      */
-    for (
-        pRule = nextRule(apRule, npRule); 
-        pRule; 
-        pRule = nextRule(apRule, npRule)
-    ) {
+    ruleQueueInit(&sQueue, apRule, npRule);
+    for (pRule = nextRule(&sQueue); pRule; pRule = nextRule(&sQueue)) {
         CssPriority *pPriority = pRule->pPriority;
         CssSelector *pSelector = pRule->pSelector;
 
@@ -3549,6 +4668,23 @@ HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode)
             }
         }
 
+        /* If the ancestor filter shows that the rule cannot match, skip it.
+         * If the rule does not match, then the dynamic test (below) cannot
+         * succeed either, as that only differs in how dynamic pseudo-classes
+         * are treated.
+         */
+        if (pFilter && !filterMayMatch(pFilter, pRule)) {
+            nFilterReject++;
+            continue;
+        }
+
+        /* A rule that depends on the siblings of the node may match this
+         * node but not a sibling with the same tag and attributes, so the
+         * computed values cannot be shared. Rules rejected by the ancestor
+         * filter above are not counted, as siblings share ancestors.
+         */
+        nSiblingRule += pRule->isSibling;
+
         /* If the selector is a match for our node, apply the rule properties */
         nSelectorMatch += 
                 applyRule(pTree, pNode, pRule, aPropDone, (char **)0, &sCreator);
@@ -3557,7 +4693,7 @@ HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode)
             pSelector->isDynamic &&
             HtmlCssSelectorTest(pSelector, pNode, 1)
         ) {
-            HtmlCssAddDynamic(pElem, pSelector, 0);
+            HtmlCssAddDynamic(pTree, pElem, pSelector, 0);
         }
     }
 
@@ -3566,16 +4702,20 @@ HtmlCssStyleSheetApply (HtmlTree *pTree, HtmlNode *pNode)
     }
 
     LOG {
-       HtmlLog(pTree, "STYLEENGINE", "%s matched %d/%d selectors",
+       HtmlLog(pTree, "STYLEENGINE", 
+           "%s matched %d/%d selectors (%d rejected by ancestor filter) "
+           "(%d lists, %d merge steps)",
            Tcl_GetString(HtmlNodeCommand(pTree, pNode)),
-           nSelectorMatch, nSelectorTest
+           nSelectorMatch, nSelectorTest, nFilterReject, npRule, sQueue.nStep
        );
     }
 
     /* Call HtmlComputedValuesFinish() to finish creating the
      * HtmlComputedValues structure.
      */
+    isShareable = (!sCreator.isTclScript && !nSiblingRule);
     pElem->pPropertyValues = HtmlComputedValuesFinish(&sCreator);
+    return isShareable;
 }
 
 /*--------------------------------------------------------------------------
@@ -3618,11 +4758,13 @@ static void
 generatedContent (
     HtmlTree *pTree,
     HtmlNode *pNode,
-    CssRule *pCssRule,        /* List of rules including :after or :before */
+    CssRule **apList,         /* Lists of rules including :after or :before */
+    int nList,                /* Number of entries in apList */
     HtmlNode **ppNode
 )
 {
     CssRule *pRule;                                 /* Iterator variable */
+    RuleQueue sQueue;                               /* Merges apList[] */
     int have = 0;
 
     int aPropDone[CSS_PROPERTY_MAX_PROPERTY + 1];
@@ -3634,7 +4776,8 @@ generatedContent (
     memset(aPropDone, 0, sizeof(aPropDone));
 
     sCreator.pzContent = &zContent;
-    for (pRule = pCssRule; pRule; pRule = pRule->pNext) {
+    ruleQueueInit(&sQueue, apList, nList);
+    for (pRule = nextRule(&sQueue); pRule; pRule = nextRule(&sQueue)) {
         char **pz = (have ? 0 : (&zContent));
         int isMatch = applyRule(pTree, pNode, pRule, aPropDone, pz, &sCreator);
         if (isMatch) have = 1;
@@ -3646,7 +4789,7 @@ generatedContent (
         return;
     }
 
-    *ppNode = (HtmlNode *)HtmlNew(HtmlElementNode);
+    *ppNode = (HtmlNode *)HtmlElementNew(pTree);
     ((HtmlElementNode *)(*ppNode))->pPropertyValues = pValues;
 
     if (zContent) {
@@ -3654,7 +4797,7 @@ generatedContent (
          * a text node also.
          */
         HtmlTextNode *pTextNode = generateContentText(pTree, zContent);
-        int idx = HtmlNodeAddTextChild(*ppNode, pTextNode);
+        int idx = HtmlNodeAddTextChild(pTree, *ppNode, pTextNode);
         HtmlNodeChild(*ppNode, idx)->iNode = HTML_NODE_GENERATED;
         HtmlFree(zContent);
     }
@@ -3676,12 +4819,21 @@ generatedContent (
 void 
 HtmlCssStyleGenerateContent (HtmlTree *pTree, HtmlElementNode *pElem, int isBefore)
 {
-    CssStyleSheet *pStyle = pTree->pStyle;    /* Stylesheet config */
+    CssStyleSheet *pStyle;                    /* Stylesheet config */
     HtmlNode *pNode = (HtmlNode *)pElem;
+    CssRule *apList[2];
+    int nList = 0;
+
+    /* Merge the :before or :after rules of the widget stylesheet with 
+     * those of the shared default stylesheet.
+     */
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        apList[nList++] = (isBefore?pStyle->pBeforeRules:pStyle->pAfterRules);
+    }
     if (isBefore) {
-        generatedContent(pTree, pNode, pStyle->pBeforeRules, &pElem->pBefore);
+        generatedContent(pTree, pNode, apList, nList, &pElem->pBefore);
     } else {
-        generatedContent(pTree, pNode, pStyle->pAfterRules, &pElem->pAfter);
+        generatedContent(pTree, pNode, apList, nList, &pElem->pAfter);
     }
 }
 
@@ -3949,7 +5101,8 @@ HtmlCssStyleReport(
     )
 {
     HtmlTree *pTree = (HtmlTree *)clientData;
-    CssStyleSheet *pStyle = pTree->pStyle;
+    CssStyleSheet *pStyle;
+    int ii;
 
     int nUniversal = 0;
     int nByTag = 0;
@@ -3978,7 +5131,9 @@ HtmlCssStyleReport(
         "<h1>Universal Rules</h1>",
         "<table border=1>", NULL
     );
-    rulelistReport(pStyle->pUniversalRules, pUniversal, &nUniversal);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        rulelistReport(pStyle->pUniversalRules, pUniversal, &nUniversal);
+    }
     Tcl_AppendStringsToObj(pUniversal, "</table>", NULL);
 
     pAfter = Tcl_NewObj();
@@ -3987,7 +5142,9 @@ HtmlCssStyleReport(
         "<h1>After Rules</h1>",
         "<table border=1>", NULL
     );
-    rulelistReport(pStyle->pAfterRules, pAfter, &nAfter);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        rulelistReport(pStyle->pAfterRules, pAfter, &nAfter);
+    }
     Tcl_AppendStringsToObj(pAfter, "</table>", NULL);
 
     pBefore = Tcl_NewObj();
@@ -3996,7 +5153,9 @@ HtmlCssStyleReport(
         "<h1>Before Rules</h1>",
         "<table border=1>", NULL
     );
-    rulelistReport(pStyle->pBeforeRules, pBefore, &nBefore);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        rulelistReport(pStyle->pBeforeRules, pBefore, &nBefore);
+    }
     Tcl_AppendStringsToObj(pBefore, "</table>", NULL);
 
     pByTag = Tcl_NewObj();
@@ -4005,13 +5164,18 @@ HtmlCssStyleReport(
         "<h1>By Tag Rules</h1>",
         "<table border=1>", NULL
     );
-    for (
-        pEntry = Tcl_FirstHashEntry(&pStyle->aByTag, &search);
-        pEntry;
-        pEntry = Tcl_NextHashEntry(&search)
-    ) {
-        pRule = (CssRule *)Tcl_GetHashValue(pEntry);
-        rulelistReport(pRule, pByTag, &nByTag);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        for (ii = 0; ii < Html_TypeCount; ii++) {
+            rulelistReport(pStyle->apByTagType[ii], pByTag, &nByTag);
+        }
+        for (
+            pEntry = Tcl_FirstHashEntry(&pStyle->aByTag, &search);
+            pEntry;
+            pEntry = Tcl_NextHashEntry(&search)
+        ) {
+            pRule = (CssRule *)Tcl_GetHashValue(pEntry);
+            rulelistReport(pRule, pByTag, &nByTag);
+        }
     }
     Tcl_AppendStringsToObj(pByTag, "</table>", NULL);
 
@@ -4021,13 +5185,15 @@ HtmlCssStyleReport(
         "<h1>By Class Rules</h1>",
         "<table border=1>", NULL
     );
-    for (
-        pEntry = Tcl_FirstHashEntry(&pStyle->aByClass, &search);
-        pEntry;
-        pEntry = Tcl_NextHashEntry(&search)
-    ) {
-        pRule = (CssRule *)Tcl_GetHashValue(pEntry);
-        rulelistReport(pRule, pByClass, &nByClass);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        for (
+            pEntry = Tcl_FirstHashEntry(&pStyle->aByClass, &search);
+            pEntry;
+            pEntry = Tcl_NextHashEntry(&search)
+        ) {
+            pRule = (CssRule *)Tcl_GetHashValue(pEntry);
+            rulelistReport(pRule, pByClass, &nByClass);
+        }
     }
     Tcl_AppendStringsToObj(pByClass, "</table>", NULL);
 
@@ -4037,13 +5203,15 @@ HtmlCssStyleReport(
         "<h1>By Id Rules</h1>",
         "<table border=1>", NULL
     );
-    for (
-        pEntry = Tcl_FirstHashEntry(&pStyle->aById, &search);
-        pEntry;
-        pEntry = Tcl_NextHashEntry(&search)
-    ) {
-        pRule = (CssRule *)Tcl_GetHashValue(pEntry);
-        rulelistReport(pRule, pById, &nById);
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        for (
+            pEntry = Tcl_FirstHashEntry(&pStyle->aById, &search);
+            pEntry;
+            pEntry = Tcl_NextHashEntry(&search)
+        ) {
+            pRule = (CssRule *)Tcl_GetHashValue(pEntry);
+            rulelistReport(pRule, pById, &nById);
+        }
     }
     Tcl_AppendStringsToObj(pById, "</table>", NULL);
 
@@ -4140,7 +5308,7 @@ HtmlCssStyleConfigDump(
 {
 #define MAX_RULES 8096
     HtmlTree *pTree = (HtmlTree *)clientData;
-    CssStyleSheet *pStyle = pTree->pStyle;
+    CssStyleSheet *pStyle;
     Tcl_HashTable *apTable[3];
 
     CssRule *pRule;
@@ -4149,29 +5317,40 @@ HtmlCssStyleConfigDump(
     int nRule = 0;
     int jj = 0;
 
-    for (pRule = pStyle->pUniversalRules; pRule; pRule = pRule->pNext) {
-        if (nRule < MAX_RULES) {
-            apRule[nRule++] = pRule;
+    /* Rules from the widget stylesheet and the shared default stylesheet */
+    for (pStyle = pTree->pStyle; pStyle; pStyle = pStyle->pShared) {
+        for (pRule = pStyle->pUniversalRules; pRule; pRule = pRule->pNext) {
+            if (nRule < MAX_RULES) {
+                apRule[nRule++] = pRule;
+            }
         }
-    }
 
-    apTable[0] = &pStyle->aByTag;
-    apTable[1] = &pStyle->aById;
-    apTable[2] = &pStyle->aByClass;
-    for (jj = 0; jj < 3; jj++) {
-        Tcl_HashEntry *pEntry;
-        Tcl_HashSearch search;
-        for (pEntry = Tcl_FirstHashEntry(apTable[jj], &search);
-             pEntry;
-             pEntry = Tcl_NextHashEntry(&search)
-        ) {
-            pRule = (CssRule *)Tcl_GetHashValue(pEntry);
-            for ( ; pRule; pRule = pRule->pNext) {
+        for (jj = 0; jj < Html_TypeCount; jj++) {
+            for (pRule = pStyle->apByTagType[jj]; pRule; pRule = pRule->pNext) {
                 if (nRule < MAX_RULES) {
                     apRule[nRule++] = pRule;
                 }
             }
         }
+
+        apTable[0] = &pStyle->aByTag;
+        apTable[1] = &pStyle->aById;
+        apTable[2] = &pStyle->aByClass;
+        for (jj = 0; jj < 3; jj++) {
+            Tcl_HashEntry *pEntry;
+            Tcl_HashSearch search;
+            for (pEntry = Tcl_FirstHashEntry(apTable[jj], &search);
+                 pEntry;
+                 pEntry = Tcl_NextHashEntry(&search)
+            ) {
+                pRule = (CssRule *)Tcl_GetHashValue(pEntry);
+                for ( ; pRule; pRule = pRule->pNext) {
+                    if (nRule < MAX_RULES) {
+                        apRule[nRule++] = pRule;
+                    }
+                }
+            }
+        }
     }
 
     qsort(apRule, nRule, sizeof(CssRule *), ruleQsortCompare);
@@ -4296,4 +5475,152 @@ HtmlCssInlineQuery(Tcl_Interp *interp, CssPropertySet *pPropertySet, Tcl_Obj *pA
     return TCL_OK;
 }
 
+#ifndef NDEBUG
+/*
+ * Context for the [widget _selectorbench] command. See 
+ * HtmlCssSelectorBench() for details.
+ */
+typedef struct SelectorBench SelectorBench;
+struct SelectorBench {
+    CssStyleSheet *pStyle;
+    int isProgram;        /* True to run compiled programs */
+    int nTest;            /* Number of selector tests run */
+    int nMatch;           /* Number of tests that matched */
+};
+
+static void
+selectorBenchList (SelectorBench *p, CssRule *pList, HtmlNode *pNode)
+{
+    CssRule *pRule;
+    for (pRule = pList; pRule; pRule = pRule->pNext) {
+        CssSelector *pSelector = pRule->pSelector;
+        int isMatch;
+        if (!pSelector->aOp) continue;
+        if (p->isProgram) {
+            isMatch = selectorProgramTest(pSelector->aOp, pNode, 0);
+        } else {
+            isMatch = selectorInterpret(pSelector, pNode, 0);
+        }
+        p->nTest++;
+        p->nMatch += (isMatch ? 1 : 0);
+    }
+}
+
+static int
+selectorBenchCb (HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
+{
+    SelectorBench *p = (SelectorBench *)clientData;
+    CssStyleSheet *pStyle;
+    Tcl_HashTable *aHash[3];
+    int ii;
+
+    if (HtmlNodeIsText(pNode)) return HTML_WALK_DESCEND;
+
+    for (pStyle = p->pStyle; pStyle; pStyle = pStyle->pShared) {
+        aHash[0] = &pStyle->aByTag;
+        aHash[1] = &pStyle->aByClass;
+        aHash[2] = &pStyle->aById;
+
+        selectorBenchList(p, pStyle->pUniversalRules, pNode);
+        selectorBenchList(p, pStyle->pBeforeRules, pNode);
+        selectorBenchList(p, pStyle->pAfterRules, pNode);
+        for (ii = 0; ii < Html_TypeCount; ii++) {
+            selectorBenchList(p, pStyle->apByTagType[ii], pNode);
+        }
+        for (ii = 0; ii < 3; ii++) {
+            Tcl_HashSearch search;
+            Tcl_HashEntry *pEntry;
+            for (
+                pEntry = Tcl_FirstHashEntry(aHash[ii], &search); 
+                pEntry; 
+                pEntry = Tcl_NextHashEntry(&search)
+            ) {
+                selectorBenchList(p, (CssRule *)Tcl_GetHashValue(pEntry), pNode);
+            }
+        }
+    }
+    return HTML_WALK_DESCEND;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSelectorBench --
+ *
+ *     widget _selectorbench ?ITERATIONS?
+ *
+ *     Test every selector in the current stylesheet against every element
+ *     in the document ITERATIONS times (default 1), first by interpreting
+ *     the CssSelector lists and then by running the compiled programs.
+ *     The result is a list of the form:
+ *
+ *         {interpret CLICKS MATCHES program CLICKS MATCHES tests N}
+ *
+ *     where CLICKS is the processor time used (see clock()). The two
+ *     MATCHES values should always be identical.
+ *
+ * Results:
+ *     Tcl result.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+int
+HtmlCssSelectorBench(
+    ClientData clientData,             /* The HTML widget data structure */
+    Tcl_Interp *interp,                /* Current interpreter. */
+    int objc,                          /* Number of arguments. */
+    Tcl_Obj *CONST objv[]              /* Argument strings. */
+    )
+{
+    HtmlTree *pTree = (HtmlTree *)clientData;
+    SelectorBench sBench;
+    int nIter = 1;
+    int aClicks[2];
+    int aMatch[2];
+    int ii;
+    int jj;
+    Tcl_Obj *pRet;
+
+    if (objc != 2 && objc != 3) {
+        Tcl_WrongNumArgs(interp, 2, objv, "?ITERATIONS?");
+        return TCL_ERROR;
+    }
+    if (objc == 3 && Tcl_GetIntFromObj(interp, objv[2], &nIter)) {
+        return TCL_ERROR;
+    }
+    if (!pTree->pStyle || !pTree->pRoot) {
+        Tcl_SetResult(interp, "No document or stylesheet", TCL_STATIC);
+        return TCL_ERROR;
+    }
+
+    memset(&sBench, 0, sizeof(SelectorBench));
+    sBench.pStyle = pTree->pStyle;
+    for (ii = 0; ii < 2; ii++) {
+        clock_t t = clock();
+        sBench.isProgram = ii;
+        sBench.nTest = 0;
+        sBench.nMatch = 0;
+        for (jj = 0; jj < nIter; jj++) {
+            HtmlWalkTree(pTree, 0, selectorBenchCb, (ClientData)&sBench);
+        }
+        aClicks[ii] = (int)(clock() - t);
+        aMatch[ii] = sBench.nMatch;
+    }
+
+    pRet = Tcl_NewObj();
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewStringObj("interpret", -1));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewIntObj(aClicks[0]));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewIntObj(aMatch[0]));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewStringObj("program", -1));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewIntObj(aClicks[1]));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewIntObj(aMatch[1]));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewStringObj("tests", -1));
+    Tcl_ListObjAppendElement(0, pRet, Tcl_NewIntObj(sBench.nTest));
+    Tcl_SetObjResult(interp, pRet);
 
+    return TCL_OK;
+}
+#endif
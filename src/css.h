@@ -153,6 +153,7 @@ const char *HtmlCssGetNextCommaListItem(const char *z, int n, int *pN);
  */
 int HtmlCssParse(Tcl_Obj *, int, Tcl_Obj *, Tcl_Obj *, CssStyleSheet **);
 int HtmlCssStyleSheetSyntaxErrs(CssStyleSheet *);
+void HtmlCssLoadDefaultStyle(HtmlTree *, Tcl_Obj *);
 void HtmlCssStyleSheetFree(CssStyleSheet *);
 
 /* Values to pass as the second argument ("origin") of HtmlCssParse() */
@@ -161,9 +162,39 @@ void HtmlCssStyleSheetFree(CssStyleSheet *);
 #define CSS_ORIGIN_AUTHOR 3
 
 /*
- * Function to apply a stylesheet to a document node.
+ * A counting bloom filter containing the tag names, ids and classes of
+ * the ancestors of a node. The style engine (htmlstyle.c) maintains one
+ * of these as it walks the document tree, pushing each element before
+ * styling its children and popping it afterwards. HtmlCssStyleSheetApply()
+ * uses it to reject rules with descendant or child selectors that cannot 
+ * possibly match without walking up the tree.
+ *
+ * The CssAncestorFilter.aStack array records the hash values added for
+ * each element pushed, so that HtmlCssFilterPop() removes exactly what
+ * HtmlCssFilterPush() added even if the element attributes are modified
+ * in between.
  */
-void HtmlCssStyleSheetApply(HtmlTree *, HtmlNode *);
+typedef struct CssAncestorFilter CssAncestorFilter;
+#define CSS_FILTER_SIZE 4096
+struct CssAncestorFilter {
+    unsigned char aCount[CSS_FILTER_SIZE];
+    unsigned int *aStack;        /* Hash values pushed (see above) */
+    int nStack;                  /* Number of valid entries in aStack */
+    int nStackAlloc;             /* Allocated size of aStack */
+    int nTest;                   /* Number of rules tested against filter */
+    int nReject;                 /* Number of rules rejected by filter */
+};
+void HtmlCssFilterPush(CssAncestorFilter *, HtmlNode *);
+void HtmlCssFilterPop(CssAncestorFilter *);
+void HtmlCssFilterClear(CssAncestorFilter *);
+
+/*
+ * Function to apply a stylesheet to a document node. Returns true if the
+ * computed values may be shared with a sibling node that has the same tag
+ * and attributes.
+ */
+int HtmlCssStyleSheetApply(HtmlTree *, HtmlNode *, CssAncestorFilter *);
+int HtmlCssHasSiblingRules(HtmlTree *);
 void HtmlCssStyleSheetGenerated(HtmlTree *, HtmlElementNode *);
 void HtmlCssStyleGenerateContent(HtmlTree *, HtmlElementNode *, int);
 
@@ -180,9 +211,14 @@ int HtmlCssInlineQuery(Tcl_Interp *, CssPropertySet *, Tcl_Obj *);
 */
 
 Tcl_ObjCmdProc HtmlCssStyleReport;
+#ifndef NDEBUG
+Tcl_ObjCmdProc HtmlCssSelectorBench;
+#endif
 
 void HtmlCssCheckDynamic(HtmlTree *);
-void HtmlCssFreeDynamics(HtmlElementNode *);
+void HtmlCssFreeDynamics(HtmlTree *, HtmlElementNode *);
+void HtmlCssShareDynamics(HtmlTree *, HtmlElementNode *, HtmlElementNode *);
+void HtmlCssDynamicChanged(HtmlTree *, HtmlElementNode *, int);
 int  HtmlCssTclNodeDynamics(Tcl_Interp *, HtmlNode *);
 
 /* The interface to the csssearch.c module. This module is responsible
@@ -193,6 +229,13 @@ int HtmlCssSearchShutdown(HtmlTree *);
 int HtmlCssSearchInvalidateCache(HtmlTree *);
 Tcl_ObjCmdProc HtmlCssSearch;
 
+void HtmlCssSearchInsert(HtmlTree *, HtmlNode *);
+void HtmlCssSearchRemove(HtmlTree *, HtmlNode *);
+void HtmlCssSearchFreeNode(HtmlTree *, HtmlNode *);
+void HtmlCssSearchAttribute(
+    HtmlTree *, HtmlNode *, const char *, HtmlNodeAtoms *);
+void HtmlCssSearchDynamic(HtmlTree *);
+
 #if 0
 
 /* Future interface for :before and :after pseudo-elements. Need this to 
@@ -48,6 +48,8 @@ typedef struct CssParse CssParse;
 typedef struct CssToken CssToken;
 typedef struct CssPriority CssPriority;
 typedef struct CssProperties CssProperties;
+typedef struct CssDirtyList CssDirtyList;
+typedef struct CssSelectorOp CssSelectorOp;
 
 typedef unsigned char u8;
 typedef unsigned int u32;
@@ -135,6 +137,23 @@ struct CssSelector {
     char *zAttr;      /* The attribute queried, if any. */
     char *zValue;     /* The value tested for, if any. */
     CssSelector *pNext;  /* Next simple-selector in chain */
+    CssSelectorOp *aOp;  /* Compiled program (first in chain only), or NULL */
+};
+
+/*
+ * When a selector is added to a stylesheet, it is compiled into an array
+ * of the following structures (one for each CssSelector in the chain, in 
+ * the same order, followed by an entry with eOp set to 0) for faster 
+ * matching. The eOp field is a copy of CssSelector.eSelector. For type
+ * selectors, eTag is the tag type. Tag, class and id names are atoms (see
+ * HtmlAtom(), or the tag name table) and attribute names are attribute 
+ * name atoms (see HtmlAttrAtom()). See selectorCompile() in css.c.
+ */
+struct CssSelectorOp {
+    u8 eOp;              /* CSS_SELECTOR* or CSS_PSEUDO* value, or 0 */
+    u8 eTag;             /* For CSS_SELECTOR_TYPE, tag type (0 if unknown) */
+    const char *zAttr;   /* Atom for attribute name, if any */
+    const char *zValue;  /* Value tested for, if any */
 };
 
 /*
@@ -153,11 +172,22 @@ struct CssProperties {
     CssRule **apRule;
 };
 
+/*
+ * CssRule.aAncestorHash contains hash values for up to CSS_MAX_ANCESTOR_HASH
+ * type, class or id simple selectors that must match an ancestor of a
+ * node for the rule to apply (i.e. those to the left of a descendant or
+ * child combinator). Unused entries are set to zero. They are tested
+ * against a CssAncestorFilter before the selector itself is tested.
+ */
+#define CSS_MAX_ANCESTOR_HASH 4
+
 struct CssRule {
     CssPriority *pPriority;  /* Pointer to the priority of source stylesheet */
     int specificity;         /* Specificity of the selector */
     int iRule;               /* Rule-number within source style sheet */
     CssSelector *pSelector;  /* The selector-chain for this rule */
+    int isSibling;           /* True if pSelector depends on siblings */
+    unsigned int aAncestorHash[CSS_MAX_ANCESTOR_HASH];
     int freePropertySets;          /* True to delete pPropertySet */
     int freeSelector;              /* True to delete pSelector */
     CssPropertySet *pPropertySet;  /* Property values for the rule. */
@@ -212,9 +242,44 @@ struct CssStyleSheet {
     CssRule *pAfterRules;      /* Rules that end in :after */
     CssRule *pBeforeRules;     /* Rules that end in :before */
 
-    Tcl_HashTable aByTag;      /* Rule lists by tag (string keys) */
-    Tcl_HashTable aByClass;    /* Rule lists by class (string keys) */
-    Tcl_HashTable aById;       /* Rule lists by id (string keys) */
+    CssRule *apByTagType[Html_TypeCount];  /* Rule lists by tag type */
+    Tcl_HashTable aByTag;      /* Rule lists by unknown tag (string keys) */
+    Tcl_HashTable aByClass;    /* Rule lists by class (atom keys) */
+    Tcl_HashTable aById;       /* Rule lists by id (atom keys) */
+
+    /* The default stylesheet is parsed once per interpreter into a 
+     * separate CssStyleSheet object that is shared by the stylesheets of 
+     * all widgets (see HtmlCssLoadDefaultStyle()). pShared points to it. 
+     * Rules from both are considered when styling a node. The nRef field
+     * is the number of references to this object in addition to the 
+     * first. HtmlCssStyleSheetFree() decrements nRef if it is non-zero
+     * instead of freeing the object.
+     */
+    CssStyleSheet *pShared;
+    int nRef;
+
+    /* Number of rules with a selector that depends on the siblings of
+     * a node (those that use "+", ":first-child" or ":last-child"). If 
+     * this is non-zero, restyling a node may change the style of its
+     * right-siblings. See HtmlCssHasSiblingRules().
+     */
+    int nSiblingRule;
+};
+
+/*
+ * While a stylesheet is being parsed, new rules are pushed onto the head
+ * of the list they belong to instead of being inserted in priority order
+ * (which is O(N) per rule). Each list modified this way is recorded in the
+ * CssParse.aDirty array using an instance of the following structure. 
+ * When the parse is finished, each recorded list is sorted exactly once.
+ *
+ * Exactly one of CssDirtyList.ppList and CssDirtyList.pEntry is non-NULL.
+ * If pEntry is set, the list head is stored as the value of the hash entry
+ * (in one of CssStyleSheet.aByTag, aByClass or aById).
+ */
+struct CssDirtyList {
+    CssRule **ppList;               /* Pointer to list head */
+    Tcl_HashEntry *pEntry;          /* Hash entry holding list head */
 };
 
 /*
@@ -237,6 +302,10 @@ struct CssParse {
 
     int iNextRule;                  /* iRule value for next rule */
 
+    int nDirty;                     /* Number of valid entries in aDirty */
+    int nDirtyAlloc;                /* Allocated size of aDirty */
+    CssDirtyList *aDirty;           /* Rule lists requiring a sort */
+
     /* The parser sets the isIgnore flag to true when it enters an @media {}
      * block that does *not* apply, and sets it back to false when it exits the
      * @media block.
@@ -268,7 +337,7 @@ void HtmlCssImport(CssParse *pParse, CssToken *);
 /* Test if a selector matches a node */
 int HtmlCssSelectorTest(CssSelector *, HtmlNode *, int);
 
-void HtmlCssAddDynamic(HtmlElementNode *, CssSelector *, int);
+void HtmlCssAddDynamic(HtmlTree *, HtmlElementNode *, CssSelector *, int);
 
 /* Append the string representation of the supplied selector to the object. */
 void HtmlCssSelectorToString(CssSelector *, Tcl_Obj *);
@@ -288,8 +357,30 @@ enum CssTokenType {
 };
 typedef enum CssTokenType CssTokenType;
 
+/*
+ * A stylesheet may also be stored as an array of CssParseOp structures,
+ * each of which is one call to a parser callback in css.c. Replaying the
+ * array with HtmlCssRunParseOps() builds the same stylesheet as parsing
+ * the text it was generated from, without tokenizing anything. Arrays are
+ * generated from the default stylesheets by mkdefaultstyle.tcl and are
+ * terminated by an entry with eOp set to 0.
+ */
+#define CSS_PARSEOP_SELECTOR    1      /* HtmlCssSelector(iArg, z1, z2) */
+#define CSS_PARSEOP_COMMA       2      /* HtmlCssSelectorComma() */
+#define CSS_PARSEOP_DECLARATION 3      /* HtmlCssDeclaration(z1, z2, iArg) */
+#define CSS_PARSEOP_RULE        4      /* HtmlCssRule(iArg) */
+
+typedef struct CssParseOp CssParseOp;
+struct CssParseOp {
+    int eOp;                           /* One of the CSS_PARSEOP_XXX values */
+    int iArg;                          /* Integer argument */
+    const char *z1;                    /* First string argument, or NULL */
+    const char *z2;                    /* Second string argument, or NULL */
+};
+
 void HtmlCssRunParser(const char *, int, CssParse *);
 void HtmlCssRunStyleParser(const char *, int, CssParse *);
+void HtmlCssRunParseOps(const CssParseOp *, CssParse *);
 CssTokenType HtmlCssGetToken(const char *, int, int *);
 
 #endif /* __CSS_H__ */
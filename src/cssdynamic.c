@@ -9,21 +9,113 @@ static const char rcsid[] = "$Id: cssdynamic.c,v 1.12 2007/06/10 07:53:03 daniel
  *
  *     The implementation of dynamic CSS selectors serves two purposes.
  *     Firstly, they are a feature in and of themselves. Secondly, they
- *     exercise the same dynamic-update code that an external scripting 
+ *     exercise the same dynamic-update code that an external scripting
  *     implementation someday might.
  *
  *     A "dynamic selector", according to Tkhtml, is any selector that
  *     includes an :active, :focus, or :hover pseudo class.
+ *
+ *     When the style engine finds that a dynamic selector would match an
+ *     element if all dynamic pseudo-classes were true, it attaches a
+ *     CssDynamic structure (a "condition") to the element. When the
+ *     dynamic flags of an element are modified ([$node dynamic set]), the
+ *     element is added to the HtmlCallback.aDynamic table, along with a
+ *     mask of the modified flags. HtmlCssCheckDynamic() is then called
+ *     from the next idle callback to re-test the conditions that may be
+ *     affected and to restyle elements for which the result has changed.
+ *
+ *     To avoid re-testing every condition in the document, each
+ *     condition records which dynamic flags its selector tests
+ *     (CssDynamic.mask) and whose flags it depends on (CssDynamic.eDepend):
+ *
+ *         CSS_DYNAMIC_SELF      The dynamic pseudo-classes are all in the
+ *                               rightmost compound selector (i.e.
+ *                               "a:hover"). Only the flags of the element
+ *                               the condition is attached to matter.
+ *
+ *         CSS_DYNAMIC_ANCESTOR  Flags of the element or an ancestor
+ *                               (i.e. "li:hover > ul").
+ *
+ *         CSS_DYNAMIC_SIBLING   Flags of the element, an ancestor or a
+ *                               left-sibling of either (i.e.
+ *                               "h1:hover + p").
+ *
+ *     CSS_DYNAMIC_SELF conditions are found by looking at the modified
+ *     element itself. Elements with at least one condition of the other
+ *     two types are stored in the HtmlTree.aDynamicDep table, which is
+ *     scanned once per callback if required.
  */
 
+#define CSS_DYNAMIC_SELF     0
+#define CSS_DYNAMIC_ANCESTOR 1
+#define CSS_DYNAMIC_SIBLING  2
+
 struct CssDynamic {
     int isSet;                /* True when the condition is set */
     CssSelector *pSelector;   /* The selector for this condition */
+    Html_u8 mask;             /* HTML_DYNAMIC_XXX flags tested by selector */
+    Html_u8 eDepend;          /* One of the CSS_DYNAMIC_XXX values */
     CssDynamic *pNext;
 };
 
-void 
-HtmlCssAddDynamic (HtmlElementNode *pElem, CssSelector *pSelector, int isSet)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * dynamicAnalyze --
+ *
+ *     Set the mask and eDepend fields of condition pDynamic based on the
+ *     structure of its selector.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+dynamicAnalyze (CssDynamic *pDynamic)
+{
+    CssSelector *pS;
+    int isCombinator = 0;         /* True once a combinator has been seen */
+    int isAdjacent = 0;           /* True once a "+" combinator has been seen */
+
+    pDynamic->mask = 0;
+    pDynamic->eDepend = CSS_DYNAMIC_SELF;
+    for (pS = pDynamic->pSelector; pS; pS = pS->pNext) {
+        Html_u8 flag = 0;
+        switch (pS->eSelector) {
+            case CSS_SELECTORCHAIN_ADJACENT:
+                isAdjacent = 1;
+                /* fall through */
+            case CSS_SELECTORCHAIN_DESCENDANT:
+            case CSS_SELECTORCHAIN_CHILD:
+                isCombinator = 1;
+                break;
+
+            case CSS_PSEUDOCLASS_HOVER:  flag = HTML_DYNAMIC_HOVER;  break;
+            case CSS_PSEUDOCLASS_FOCUS:  flag = HTML_DYNAMIC_FOCUS;  break;
+            case CSS_PSEUDOCLASS_ACTIVE: flag = HTML_DYNAMIC_ACTIVE; break;
+        }
+        if (flag) {
+            pDynamic->mask |= flag;
+            if (isAdjacent) {
+                pDynamic->eDepend = CSS_DYNAMIC_SIBLING;
+            } else if (isCombinator) {
+                pDynamic->eDepend = MAX(pDynamic->eDepend,CSS_DYNAMIC_ANCESTOR);
+            }
+        }
+    }
+}
+
+void
+HtmlCssAddDynamic (
+    HtmlTree *pTree,
+    HtmlElementNode *pElem,
+    CssSelector *pSelector,
+    int isSet
+)
 {
     CssDynamic *pNew;
     for (pNew = pElem->pDynamic; pNew ; pNew = pNew->pNext) {
@@ -36,55 +128,240 @@ HtmlCssAddDynamic (HtmlElementNode *pElem, CssSelector *pSelector, int isSet)
     pNew->pSelector = pSelector;
     pNew->pNext = pElem->pDynamic;
     pElem->pDynamic = pNew;
+
+    dynamicAnalyze(pNew);
+    if (pNew->eDepend != CSS_DYNAMIC_SELF) {
+        int isNew;
+        Tcl_CreateHashEntry(&pTree->aDynamicDep, (char *)pElem, &isNew);
+    }
 }
 
-void 
-HtmlCssFreeDynamics (HtmlElementNode *pElem)
+/*
+ * Free the list of dynamic conditions attached to element pElem. Also
+ * remove pElem from the HtmlTree.aDynamicDep and HtmlCallback.aDynamic
+ * tables. This is called when the element is deleted, and when its style
+ * is discarded.
+ */
+void
+HtmlCssFreeDynamics (HtmlTree *pTree, HtmlElementNode *pElem)
 {
     CssDynamic *p = pElem->pDynamic;
+    Tcl_HashEntry *pEntry;
+
     while (p) {
         CssDynamic *pTmp = p;
         p = p->pNext;
         HtmlFree(pTmp);
     }
     pElem->pDynamic = 0;
+
+    pEntry = Tcl_FindHashEntry(&pTree->aDynamicDep, (char *)pElem);
+    if (pEntry) Tcl_DeleteHashEntry(pEntry);
+    pEntry = Tcl_FindHashEntry(&pTree->cb.aDynamic, (char *)pElem);
+    if (pEntry) Tcl_DeleteHashEntry(pEntry);
 }
 
+/*
+ * Add each dynamic condition attached to element pFrom to element pElem.
+ * This is used when pElem shares the computed values of sibling pFrom
+ * instead of having the stylesheet applied to it (see styleNode() in
+ * htmlstyle.c). The current state of each condition is copied too, as
+ * the computed values were built with it.
+ */
+void
+HtmlCssShareDynamics (
+    HtmlTree *pTree,
+    HtmlElementNode *pElem,
+    HtmlElementNode *pFrom
+)
+{
+    CssDynamic *p;
+    for (p = pFrom->pDynamic; p; p = p->pNext) {
+        HtmlCssAddDynamic(pTree, pElem, p->pSelector, p->isSet);
+    }
+}
 
-static int 
-checkDynamicCb(HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssDynamicChanged --
+ *
+ *     Record that the dynamic flags in mask have been modified for
+ *     element pElem. This is called by HtmlCallbackDynamic().
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Adds an entry to the HtmlCallback.aDynamic table.
+ *
+ *---------------------------------------------------------------------------
+ */
+void
+HtmlCssDynamicChanged (HtmlTree *pTree, HtmlElementNode *pElem, int mask)
 {
-    if (!HtmlNodeIsText(pNode)) {
-        HtmlElementNode *pElem = (HtmlElementNode *)pNode;
-        CssDynamic *p;
-        for (p = pElem->pDynamic; p; p = p->pNext) {
-            int res = HtmlCssSelectorTest(p->pSelector, pNode, 0) ? 1 : 0; 
+    int isNew;
+    Tcl_HashEntry *pEntry;
+    pEntry = Tcl_CreateHashEntry(&pTree->cb.aDynamic, (char *)pElem, &isNew);
+    if (!isNew) {
+        mask |= (int)(size_t)Tcl_GetHashValue(pEntry);
+    }
+    Tcl_SetHashValue(pEntry, (ClientData)(size_t)mask);
+}
+
+/*
+ * Return the mask of modified dynamic flags for element pNode, according
+ * to the HtmlCallback.aDynamic table.
+ */
+static int
+dynamicChangedMask (HtmlTree *pTree, HtmlNode *pNode)
+{
+    Tcl_HashEntry *pEntry;
+    pEntry = Tcl_FindHashEntry(&pTree->cb.aDynamic, (char *)pNode);
+    return (pEntry ? (int)(size_t)Tcl_GetHashValue(pEntry) : 0);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * dynamicIsAffected --
+ *
+ *     Return true if condition p, attached to element pNode, may be
+ *     affected by the dynamic flag changes in the HtmlCallback.aDynamic
+ *     table.
+ *
+ * Results:
+ *     Boolean.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+dynamicIsAffected (HtmlTree *pTree, HtmlNode *pNode, CssDynamic *p)
+{
+    HtmlNode *pA;
+    for (pA = pNode; pA; pA = HtmlNodeParent(pA)) {
+        if (dynamicChangedMask(pTree, pA) & p->mask) return 1;
+        if (p->eDepend == CSS_DYNAMIC_SELF) break;
+        if (p->eDepend == CSS_DYNAMIC_SIBLING) {
+            HtmlNode *pS;
+            for (pS = HtmlNodeLeftSibling(pA); pS; pS=HtmlNodeLeftSibling(pS)){
+                if (dynamicChangedMask(pTree, pS) & p->mask) return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * dynamicRetest --
+ *
+ *     Re-test each condition attached to element pElem for which
+ *     CssDynamic.eDepend is eDepend (or, if eDepend is -1, is not
+ *     CSS_DYNAMIC_SELF) and that may be affected by the changes in the
+ *     HtmlCallback.aDynamic table. If the result of any test has changed,
+ *     schedule a restyle of the element.
+ *
+ * Results:
+ *     Number of conditions re-tested.
+ *
+ * Side effects:
+ *     May call HtmlCallbackRestyle().
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+dynamicRetest (HtmlTree *pTree, HtmlElementNode *pElem, int eDepend)
+{
+    HtmlNode *pNode = (HtmlNode *)pElem;
+    CssDynamic *p;
+    int nTest = 0;
+
+    for (p = pElem->pDynamic; p; p = p->pNext) {
+        if (
+            (eDepend < 0 && p->eDepend == CSS_DYNAMIC_SELF) ||
+            (eDepend >= 0 && p->eDepend != eDepend) ||
+            !dynamicIsAffected(pTree, pNode, p)
+        ) {
+            continue;
+        }
+        {
+            int res = HtmlCssSelectorTest(p->pSelector, pNode, 0) ? 1 : 0;
             if (res != p->isSet) {
                 HtmlCallbackRestyle(pTree, pNode);
             }
             p->isSet = res;
+            nTest++;
         }
     }
-    return HTML_WALK_DESCEND;
+    return nTest;
 }
 
-void 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssCheckDynamic --
+ *
+ *     Re-test the dynamic conditions that may be affected by the dynamic
+ *     flag changes recorded in the HtmlCallback.aDynamic table, then
+ *     clear the table. Elements for which a condition result has changed
+ *     are restyled.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May call HtmlCallbackRestyle(). Logs the number of conditions
+ *     re-tested to the "STYLEENGINE" log.
+ *
+ *---------------------------------------------------------------------------
+ */
+void
 HtmlCssCheckDynamic (HtmlTree *pTree)
 {
-    if (pTree->cb.pDynamic) {
-        HtmlNode *pParent = HtmlNodeParent(pTree->cb.pDynamic);
-        if (pParent) {
-            int i;
-            int nChild = HtmlNodeNumChildren(pParent);
-            for (i = 0; HtmlNodeChild(pParent, i) != pTree->cb.pDynamic; i++);
-            for ( ; i < nChild; i++) {
-                HtmlWalkTree(pTree,HtmlNodeChild(pParent,i),checkDynamicCb,0);
-            }
-        } else {
-            HtmlWalkTree(pTree, pTree->cb.pDynamic, checkDynamicCb, 0);
-        }
-        pTree->cb.pDynamic = 0;
+    Tcl_HashEntry *pEntry;
+    Tcl_HashSearch search;
+    int nChanged = pTree->cb.aDynamic.numEntries;
+    int nDep = 0;
+    int nTest = 0;
+
+    if (nChanged == 0) return;
+
+    /* Conditions that depend only on the flags of their own element. */
+    for (
+        pEntry = Tcl_FirstHashEntry(&pTree->cb.aDynamic, &search);
+        pEntry;
+        pEntry = Tcl_NextHashEntry(&search)
+    ) {
+        HtmlElementNode *pElem;
+        pElem = (HtmlElementNode *)Tcl_GetHashKey(&pTree->cb.aDynamic, pEntry);
+        nTest += dynamicRetest(pTree, pElem, CSS_DYNAMIC_SELF);
     }
+
+    /* Conditions that depend on the flags of other elements. */
+    for (
+        pEntry = Tcl_FirstHashEntry(&pTree->aDynamicDep, &search);
+        pEntry;
+        pEntry = Tcl_NextHashEntry(&search)
+    ) {
+        HtmlElementNode *pElem;
+        pElem = (HtmlElementNode *)Tcl_GetHashKey(&pTree->aDynamicDep, pEntry);
+        nTest += dynamicRetest(pTree, pElem, -1);
+        nDep++;
+    }
+
+    Tcl_DeleteHashTable(&pTree->cb.aDynamic);
+    Tcl_InitHashTable(&pTree->cb.aDynamic, TCL_ONE_WORD_KEYS);
+
+    HtmlLog(pTree, "STYLEENGINE",
+        "Dynamic: %d modified elements, %d conditions re-tested "
+        "(%d elements with non-local conditions)",
+        nChanged, nTest, nDep
+    );
 }
 
 int
@@ -103,4 +380,3 @@ HtmlCssTclNodeDynamics(Tcl_Interp *interp, HtmlNode *pNode)
     Tcl_SetObjResult(interp, pRet);
     return TCL_OK;
 }
-
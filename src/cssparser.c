@@ -1049,6 +1049,59 @@ HtmlCssRunStyleParser (const char *zInput, int nInput, CssParse *pParse)
     HtmlCssRule(pParse, 1);
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssRunParseOps --
+ *
+ *     Replay an array of CssParseOp structures (see cssInt.h) generated 
+ *     from a stylesheet document by mkdefaultstyle.tcl. This makes the
+ *     same sequence of calls to the css.c callbacks as HtmlCssRunParser()
+ *     does when parsing the original document.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See HtmlCssRunParser().
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlCssRunParseOps (const CssParseOp *aOp, CssParse *pParse)
+{
+    const CssParseOp *pOp;
+
+    pParse->isBody = 1;
+    for (pOp = aOp; pOp->eOp; pOp++) {
+        CssToken t1;
+        CssToken t2;
+        t1.z = pOp->z1;
+        t1.n = pOp->z1 ? strlen(pOp->z1) : 0;
+        t2.z = pOp->z2;
+        t2.n = pOp->z2 ? strlen(pOp->z2) : 0;
+
+        switch (pOp->eOp) {
+            case CSS_PARSEOP_SELECTOR:
+                HtmlCssSelector(pParse, pOp->iArg, 
+                    (pOp->z1 ? &t1 : 0), (pOp->z2 ? &t2 : 0)
+                );
+                break;
+            case CSS_PARSEOP_COMMA:
+                HtmlCssSelectorComma(pParse);
+                break;
+            case CSS_PARSEOP_DECLARATION:
+                HtmlCssDeclaration(pParse, &t1, &t2, pOp->iArg);
+                break;
+            case CSS_PARSEOP_RULE:
+                HtmlCssRule(pParse, pOp->iArg);
+                break;
+            default:
+                assert(!"Bad CssParseOp.eOp value");
+        }
+    }
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -17,29 +17,95 @@ static const char rcsid[] = "$Id: csssearch.c,v 1.7 2007/10/27 08:37:50 hkoba Ex
  *
  *         HtmlCssSearch()
  *
+ *     Notification of document changes:
+ *
+ *         HtmlCssSearchInsert()
+ *         HtmlCssSearchRemove()
+ *         HtmlCssSearchFreeNode()
+ *         HtmlCssSearchAttribute()
+ *         HtmlCssSearchDynamic()
+ *
  *     Discard the contents of the cache:
  *
  *         HtmlCssSearchInvalidateCache()
  *
+ * Search results for the whole document are cached, keyed by the text
+ * of the selector. To avoid walking the whole tree for each new query,
+ * a document index is also maintained. Each element in the document
+ * (but not in orphan trees) is stored in the index under one key for 
+ * its tag name ("TAG"), one for its id ("#ID") and one for each of its
+ * class names (".CLASS"). A selector whose rightmost compound selector
+ * contains a type, class or id selector is only tested against the nodes
+ * in the corresponding index entry.
+ *
+ * Elements are indexed by id in the HtmlTree.aId table, which is always
+ * kept up to date, as it is used for the very common [$html search -id] 
+ * and "#ID" queries. The tag and class name index (HtmlSearchCache.aIndex)
+ * is built the first time it is required. Both are then maintained 
+ * by the notification functions, which are called by htmltree.c
+ * as nodes are added to and removed from the document, or have their
+ * attributes modified. The same functions discard only those cached 
+ * results that may be affected by the change:
+ *
+ *     * When an element is added to or removed from the document, cached
+ *       results with the same key as one of the keys of the element are
+ *       discarded. Also discarded are results for selectors that have
+ *       no key or that depend on sibling relationships (":first-child",
+ *       ":last-child" and "+"). These are cached with the empty key.
+ *
+ *     * When an attribute is modified, results for selectors that refer
+ *       to the attribute (including "class" and "id") are discarded.
+ *
+ *     * When dynamic flags (i.e. ":hover") are modified, results for 
+ *       selectors that use dynamic pseudo-classes are discarded.
  */
 
 #define SEARCH_MODE_ALL     1
 #define SEARCH_MODE_INDEX   2
 #define SEARCH_MODE_LENGTH  3
 
+typedef struct CssCachedSearch CssCachedSearch;
 struct CssCachedSearch {
     int nAlloc;
     int nNode;
     HtmlNode **apNode;
+
+    CssStyleSheet *pStyle;       /* Parsed selector (in pUniversalRules) */
+    int isDynamic;               /* True if selector has dynamic conditions */
+    Tcl_HashEntry *pEntry;       /* Entry in HtmlSearchCache.aCache */
+    Tcl_HashEntry *pKeyEntry;    /* Entry in HtmlSearchCache.aKey */
+    CssCachedSearch *pNextKey;   /* Next result with the same key */
+    CssCachedSearch *pPrevKey;   /* Previous result with the same key */
+};
+
+/*
+ * Value type of the HtmlTree.aId table. The list of element nodes in 
+ * the document with a given id (there is usually exactly one). The 
+ * nodes are not stored in any particular order.
+ */
+typedef struct HtmlIdList HtmlIdList;
+struct HtmlIdList {
+    int nNode;                   /* Number of entries in apNode[] */
+    int nAlloc;                  /* Allocated size of apNode[] */
+    HtmlNode **apNode;           /* Element nodes with the id */
 };
-typedef struct CssCachedSearch CssCachedSearch;
 
 struct HtmlSearchCache {
-    /* Map between CSS selector and search results. The contents
-     * are discarded each time HtmlCssSearchInvalidateCache() is
-     * called. 
-     */
+    /* Map between CSS selector and search results (CssCachedSearch). */
     Tcl_HashTable aCache;
+
+    /* Map between index key and the first of a linked list of the
+     * CssCachedSearch structures that have that key.
+     */
+    Tcl_HashTable aKey;
+
+    /* The document index. If isIndexed is true, then aIndex maps from
+     * each tag and class key to a hash table (with TCL_ONE_WORD_KEYS) 
+     * containing the set of element nodes with that key. Ids are indexed
+     * separately, by HtmlTree.aId.
+     */
+    int isIndexed;
+    Tcl_HashTable aIndex;
 };
 
 struct CssSearch {
@@ -47,9 +113,39 @@ struct CssSearch {
   HtmlTree *pTree;
   HtmlNode *pSearchRoot;     /* Root of sub-tree to search */
   CssCachedSearch *pCache;   /* Output */
+  const char *zId;           /* Id atom for [search -id] in orphan trees */
 };
 typedef struct CssSearch CssSearch;
 
+#define INDEX_ADD     0x01     /* Add node to index */
+#define INDEX_REMOVE  0x02     /* Remove node from index */
+#define INDEX_DISCARD 0x04     /* Discard cached results with node keys */
+
+static void 
+searchAppend (CssCachedSearch *pCache, HtmlNode *pNode)
+{
+    if (pCache->nNode == pCache->nAlloc){
+        pCache->nAlloc = (16 + (pCache->nAlloc * 2));
+        pCache->apNode = (HtmlNode **)HtmlRealloc("SearchCache", 
+            pCache->apNode, (pCache->nAlloc * sizeof(HtmlNode *))
+        );
+    }
+    pCache->apNode[pCache->nNode] = pNode;
+    pCache->nNode++;
+}
+
+static int 
+searchTest (CssRule *pRuleList, HtmlNode *pNode)
+{
+    CssRule *p;
+    for (
+        p = pRuleList; 
+        p && 0 == HtmlCssSelectorTest(p->pSelector, pNode, 0);
+        p = p->pNext
+    );
+    return (p ? 1 : 0);
+}
+
 static int 
 cssSearchCb(HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
 {
@@ -57,48 +153,501 @@ cssSearchCb(HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
     assert(pSearch->pRuleList);
 
     if (pNode != pSearch->pSearchRoot && 0 == HtmlNodeIsText(pNode)) {
-        CssRule *p;
-        for (
-            p = pSearch->pRuleList; 
-            p && 0 == HtmlCssSelectorTest(p->pSelector, pNode, 0);
-            p = p->pNext
-        );
-        if (p) {
-            CssCachedSearch *pCache = pSearch->pCache;
-            if (pCache->nNode == pCache->nAlloc){
-                pCache->nAlloc = (16 + (pCache->nAlloc * 2));
-                pCache->apNode = (HtmlNode **)HtmlRealloc("SearchCache", 
-                    pCache->apNode, (pCache->nAlloc * sizeof(HtmlNode *))
+        if (searchTest(pSearch->pRuleList, pNode)) {
+            searchAppend(pSearch->pCache, pNode);
+        }
+    }
+    return HTML_WALK_DESCEND;
+}
+
+/*
+ * HtmlWalkTree() callback used by [search -id] when the search root is 
+ * part of an orphan tree (and so its descendants are not in HtmlTree.aId).
+ */
+static int 
+searchIdCb (HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
+{
+    CssSearch *pSearch = (CssSearch *)clientData;
+    if (pNode != pSearch->pSearchRoot) {
+        HtmlNodeAtoms *pAtoms = HtmlNodeGetAtoms(pTree, pNode);
+        if (pAtoms && pAtoms->zId == pSearch->zId) {
+            searchAppend(pSearch->pCache, pNode);
+        }
+    }
+    return HTML_WALK_DESCEND;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * searchKey --
+ *
+ *     Set the contents of dynamic string pKey to the index key for 
+ *     the simple selector of type eType (CSS_SELECTOR_TYPE, ID or CLASS)
+ *     with value zValue. Tag names are folded to lower-case.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+searchKey (Tcl_DString *pKey, int eType, const char *zValue)
+{
+    Tcl_DStringSetLength(pKey, 0);
+    switch (eType) {
+        case CSS_SELECTOR_TYPE: {
+            char *z;
+            Tcl_DStringAppend(pKey, zValue, -1);
+            for (z = Tcl_DStringValue(pKey); *z; z++) {
+                if (*z >= 'A' && *z <= 'Z') *z += ('a' - 'A');
+            }
+            break;
+        }
+        case CSS_SELECTOR_ID:
+            Tcl_DStringAppend(pKey, "#", 1);
+            Tcl_DStringAppend(pKey, zValue, -1);
+            break;
+        case CSS_SELECTOR_CLASS:
+            Tcl_DStringAppend(pKey, ".", 1);
+            Tcl_DStringAppend(pKey, zValue, -1);
+            break;
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * selectorAnalyze --
+ *
+ *     Analyze the list of selectors pRuleList, as parsed from the first
+ *     argument to [$widget search]. If the list consists of a single
+ *     selector with no sibling dependencies and the rightmost compound
+ *     selector contains an id, class or type selector, set pKey to the
+ *     index key for it (preferring id to class and class to type). 
+ *     Otherwise set pKey to an empty string. If the key is for an id
+ *     selector, *pzId is also set to the id atom. Otherwise it is set
+ *     to NULL.
+ *
+ * Results:
+ *     True if any selector uses a dynamic pseudo-class, otherwise false.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int 
+selectorAnalyze (CssRule *pRuleList, Tcl_DString *pKey, const char **pzId)
+{
+    CssRule *pRule;
+    int isDynamic = 0;
+    int isVolatile = (pRuleList->pNext ? 1 : 0);
+    int eKey = 0;
+    const char *zKey = 0;
+
+    for (pRule = pRuleList; pRule; pRule = pRule->pNext) {
+        CssSelector *pS;
+        int isRightmost = 1;
+        for (pS = pRule->pSelector; pS; pS = pS->pNext) {
+            switch (pS->eSelector) {
+                case CSS_SELECTORCHAIN_DESCENDANT:
+                case CSS_SELECTORCHAIN_CHILD:
+                    isRightmost = 0;
+                    break;
+                case CSS_SELECTORCHAIN_ADJACENT:
+                case CSS_PSEUDOCLASS_FIRSTCHILD:
+                case CSS_PSEUDOCLASS_LASTCHILD:
+                    isRightmost = 0;
+                    isVolatile = 1;
+                    break;
+                case CSS_PSEUDOCLASS_ACTIVE:
+                case CSS_PSEUDOCLASS_HOVER:
+                case CSS_PSEUDOCLASS_FOCUS:
+                case CSS_PSEUDOCLASS_LINK:
+                case CSS_PSEUDOCLASS_VISITED:
+                    isDynamic = 1;
+                    break;
+                case CSS_SELECTOR_ID:
+                case CSS_SELECTOR_CLASS:
+                case CSS_SELECTOR_TYPE:
+                    if (isRightmost && pS->eSelector > eKey) {
+                        eKey = pS->eSelector;
+                        zKey = pS->zValue;
+                    }
+                    break;
+            }
+        }
+    }
+
+    Tcl_DStringSetLength(pKey, 0);
+    *pzId = 0;
+    if (zKey && !isVolatile) {
+        searchKey(pKey, eKey, zKey);
+        if (eKey == CSS_SELECTOR_ID) {
+            *pzId = zKey;
+        }
+    }
+    return isDynamic;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * selectorUsesAttr --
+ *
+ *     Return true if any selector in list pRuleList tests the value of
+ *     attribute zAttr (including class and id selectors, which test the
+ *     "class" and "id" attributes).
+ *
+ * Results:
+ *     See above.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int 
+selectorUsesAttr (CssRule *pRuleList, const char *zAttr)
+{
+    CssRule *pRule;
+    for (pRule = pRuleList; pRule; pRule = pRule->pNext) {
+        CssSelector *pS;
+        for (pS = pRule->pSelector; pS; pS = pS->pNext) {
+            const char *z = 0;
+            switch (pS->eSelector) {
+                case CSS_SELECTOR_ATTR:
+                case CSS_SELECTOR_ATTRVALUE:
+                case CSS_SELECTOR_ATTRLISTVALUE:
+                case CSS_SELECTOR_ATTRHYPHEN:
+                    z = pS->zAttr;
+                    break;
+                case CSS_SELECTOR_CLASS:
+                    z = "class";
+                    break;
+                case CSS_SELECTOR_ID:
+                    z = "id";
+                    break;
+            }
+            if (z && 0 == stricmp(z, zAttr)) return 1;
+        }
+    }
+    return 0;
+}
+
+static void 
+cacheFree (CssCachedSearch *pCache)
+{
+    if (pCache) {
+        HtmlCssStyleSheetFree(pCache->pStyle);
+        HtmlFree(pCache->apNode);
+        HtmlFree(pCache);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * cacheDiscard --
+ *
+ *     Remove the cached result pCache from the search cache and free it.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Frees pCache.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+cacheDiscard (HtmlSearchCache *p, CssCachedSearch *pCache)
+{
+    if (pCache->pPrevKey) {
+        pCache->pPrevKey->pNextKey = pCache->pNextKey;
+    } else if (pCache->pNextKey) {
+        Tcl_SetHashValue(pCache->pKeyEntry, pCache->pNextKey);
+    } else {
+        Tcl_DeleteHashEntry(pCache->pKeyEntry);
+    }
+    if (pCache->pNextKey) {
+        pCache->pNextKey->pPrevKey = pCache->pPrevKey;
+    }
+    Tcl_DeleteHashEntry(pCache->pEntry);
+    cacheFree(pCache);
+}
+
+static void 
+cacheDiscardKey (HtmlSearchCache *p, const char *zKey)
+{
+    Tcl_HashEntry *pEntry = Tcl_FindHashEntry(&p->aKey, zKey);
+    if (pEntry) {
+        CssCachedSearch *pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
+        while (pCache) {
+            CssCachedSearch *pNext = pCache->pNextKey;
+            cacheDiscard(p, pCache);
+            pCache = pNext;
+        }
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * indexKey --
+ *
+ *     Apply the operations in mask op (see INDEX_XXX above) to the index
+ *     key zKey and element node pNode.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+indexKey (HtmlSearchCache *p, const char *zKey, HtmlNode *pNode, int op)
+{
+    if (p->isIndexed && (op & (INDEX_ADD|INDEX_REMOVE))) {
+        Tcl_HashEntry *pEntry;
+        Tcl_HashTable *pSet;
+        int isNew;
+        if (op & INDEX_ADD) {
+            pEntry = Tcl_CreateHashEntry(&p->aIndex, zKey, &isNew);
+            if (isNew) {
+                pSet = HtmlNew(Tcl_HashTable);
+                Tcl_InitHashTable(pSet, TCL_ONE_WORD_KEYS);
+                Tcl_SetHashValue(pEntry, pSet);
+            }
+            pSet = (Tcl_HashTable *)Tcl_GetHashValue(pEntry);
+            Tcl_CreateHashEntry(pSet, (char *)pNode, &isNew);
+        } else if ((pEntry = Tcl_FindHashEntry(&p->aIndex, zKey))) {
+            Tcl_HashEntry *pNodeEntry;
+            pSet = (Tcl_HashTable *)Tcl_GetHashValue(pEntry);
+            pNodeEntry = Tcl_FindHashEntry(pSet, (char *)pNode);
+            if (pNodeEntry) {
+                Tcl_DeleteHashEntry(pNodeEntry);
+                if (pSet->numEntries == 0) {
+                    Tcl_DeleteHashTable(pSet);
+                    HtmlFree(pSet);
+                    Tcl_DeleteHashEntry(pEntry);
+                }
+            }
+        }
+    }
+    if (op & INDEX_DISCARD) {
+        cacheDiscardKey(p, zKey);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * idIndex --
+ *
+ *     Add element pNode to (op==INDEX_ADD) or remove it from 
+ *     (op==INDEX_REMOVE) the list of nodes with id zId in the 
+ *     HtmlTree.aId table. zId must be an atom.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+idIndex (HtmlTree *pTree, const char *zId, HtmlNode *pNode, int op)
+{
+    Tcl_HashEntry *pEntry;
+    HtmlIdList *pList;
+    int ii;
+
+    if (op & INDEX_ADD) {
+        int isNew;
+        pEntry = Tcl_CreateHashEntry(&pTree->aId, zId, &isNew);
+        if (isNew) {
+            Tcl_SetHashValue(pEntry, HtmlNew(HtmlIdList));
+        }
+        pList = (HtmlIdList *)Tcl_GetHashValue(pEntry);
+        for (ii = 0; ii < pList->nNode && pList->apNode[ii] != pNode; ii++);
+        if (ii == pList->nNode) {
+            if (pList->nNode == pList->nAlloc) {
+                pList->nAlloc = (pList->nAlloc * 2) + 1;
+                pList->apNode = (HtmlNode **)HtmlRealloc("HtmlIdList", 
+                    pList->apNode, pList->nAlloc * sizeof(HtmlNode *)
                 );
             }
-            pCache->apNode[pCache->nNode] = pNode;
-            pCache->nNode++;
+            pList->apNode[pList->nNode++] = pNode;
+        }
+    } else if (
+        (op & INDEX_REMOVE) && 
+        (pEntry = Tcl_FindHashEntry(&pTree->aId, zId))
+    ) {
+        pList = (HtmlIdList *)Tcl_GetHashValue(pEntry);
+        for (ii = 0; ii < pList->nNode; ii++) {
+            if (pList->apNode[ii] == pNode) {
+                pList->apNode[ii] = pList->apNode[--pList->nNode];
+                break;
+            }
+        }
+        if (pList->nNode == 0) {
+            HtmlFree(pList->apNode);
+            HtmlFree(pList);
+            Tcl_DeleteHashEntry(pEntry);
         }
     }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * indexNode --
+ *
+ *     Apply the operations in mask op to each index key of element pNode.
+ *     The keys are derived from the tag name of pNode and the interned
+ *     id and class names in pAtoms. The id is added to or removed from
+ *     HtmlTree.aId regardless of whether or not the tag and class index 
+ *     has been built.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+indexNode (HtmlTree *pTree, HtmlNode *pNode, HtmlNodeAtoms *pAtoms, int op)
+{
+    HtmlSearchCache *p = pTree->pSearchCache;
+    Tcl_DString key;
+    int ii;
+
+    Tcl_DStringInit(&key);
+    if (pNode->zTag) {
+        searchKey(&key, CSS_SELECTOR_TYPE, pNode->zTag);
+        indexKey(p, Tcl_DStringValue(&key), pNode, op);
+    }
+    if (pAtoms && pAtoms->zId) {
+        idIndex(pTree, pAtoms->zId, pNode, op);
+        if (op & INDEX_DISCARD) {
+            searchKey(&key, CSS_SELECTOR_ID, pAtoms->zId);
+            cacheDiscardKey(p, Tcl_DStringValue(&key));
+        }
+    }
+    for (ii = 0; pAtoms && ii < pAtoms->nClass; ii++) {
+        searchKey(&key, CSS_SELECTOR_CLASS, pAtoms->azClass[ii]);
+        indexKey(p, Tcl_DStringValue(&key), pNode, op);
+    }
+    Tcl_DStringFree(&key);
+}
+
+static int 
+indexNodeCb (HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
+{
+    if (!HtmlNodeIsText(pNode)) {
+        int op = (int)(size_t)clientData;
+        indexNode(pTree, pNode, HtmlNodeGetAtoms(pTree, pNode), op);
+    }
     return HTML_WALK_DESCEND;
 }
 
+static void 
+indexFree (HtmlSearchCache *p)
+{
+    if (p->isIndexed) {
+        Tcl_HashSearch sSearch;
+        Tcl_HashEntry *pEntry;
+        for (
+            pEntry = Tcl_FirstHashEntry(&p->aIndex, &sSearch);
+            pEntry;
+            pEntry = Tcl_NextHashEntry(&sSearch)
+        ) {
+            Tcl_HashTable *pSet = (Tcl_HashTable *)Tcl_GetHashValue(pEntry);
+            Tcl_DeleteHashTable(pSet);
+            HtmlFree(pSet);
+        }
+        Tcl_DeleteHashTable(&p->aIndex);
+        p->isIndexed = 0;
+    }
+}
+
+/*
+ * Return true if there is nothing to maintain - the document has not
+ * been indexed and there are no cached results.
+ */
+static int 
+searchIsEmpty (HtmlTree *pTree)
+{
+    HtmlSearchCache *p = pTree->pSearchCache;
+    return (!p->isIndexed && p->aCache.numEntries == 0);
+}
+
+/*
+ * Return true if pNode is part of the document tree (not an orphan tree
+ * or a fragment under construction).
+ */
+static int 
+searchInDocument (HtmlTree *pTree, HtmlNode *pNode)
+{
+    HtmlNode *p;
+    for (p = pNode; HtmlNodeParent(p); p = HtmlNodeParent(p));
+    return (p == pTree->pRoot);
+}
+
 int 
 HtmlCssSearchInit (HtmlTree *pTree)
 {
+    Tcl_InitHashTable(&pTree->aId, TCL_ONE_WORD_KEYS);
     pTree->pSearchCache = HtmlNew(HtmlSearchCache);
     Tcl_InitHashTable(&pTree->pSearchCache->aCache, TCL_STRING_KEYS);
+    Tcl_InitHashTable(&pTree->pSearchCache->aKey, TCL_STRING_KEYS);
     return TCL_OK;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSearchInvalidateCache --
+ *
+ *     Discard all cached search results, the document index and the
+ *     contents of HtmlTree.aId. This is called when the document is 
+ *     cleared.
+ *
+ * Results:
+ *     TCL_OK.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
 int 
 HtmlCssSearchInvalidateCache (HtmlTree *pTree)
 {
     Tcl_HashSearch sSearch;
     Tcl_HashEntry *pEntry;
-    Tcl_HashTable *p = &pTree->pSearchCache->aCache;
+    HtmlSearchCache *p = pTree->pSearchCache;
 
-    while ((pEntry = Tcl_FirstHashEntry(p, &sSearch))) {
-        CssCachedSearch *pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
-	if (pCache) {
-	  HtmlFree(pCache->apNode);
-	  HtmlFree(pCache);
-	}
+    while ((pEntry = Tcl_FirstHashEntry(&p->aCache, &sSearch))) {
+        cacheDiscard(p, (CssCachedSearch *)Tcl_GetHashValue(pEntry));
+    }
+    assert(p->aKey.numEntries == 0);
+    indexFree(p);
+
+    while ((pEntry = Tcl_FirstHashEntry(&pTree->aId, &sSearch))) {
+        HtmlIdList *pList = (HtmlIdList *)Tcl_GetHashValue(pEntry);
+        HtmlFree(pList->apNode);
+        HtmlFree(pList);
         Tcl_DeleteHashEntry(pEntry);
     }
  
@@ -110,17 +659,310 @@ HtmlCssSearchShutdown (HtmlTree *pTree)
 {
     HtmlCssSearchInvalidateCache(pTree);
     Tcl_DeleteHashTable(&pTree->pSearchCache->aCache);
+    Tcl_DeleteHashTable(&pTree->pSearchCache->aKey);
+    Tcl_DeleteHashTable(&pTree->aId);
     HtmlFree(pTree->pSearchCache);
     pTree->pSearchCache = 0;
     return TCL_OK;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSearchInsert --
+ * HtmlCssSearchRemove --
+ *
+ *     HtmlCssSearchInsert() is called after the sub-tree rooted at pNode
+ *     is linked into the tree. HtmlCssSearchRemove() is called before the
+ *     sub-tree rooted at pNode is unlinked from its parent. Neither does
+ *     anything unless pNode is (or was) part of the document tree.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Updates the document index and discards affected cached results.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+searchSubtree (HtmlTree *pTree, HtmlNode *pNode, int op)
+{
+    if (!HtmlNodeIsText(pNode) && searchInDocument(pTree, pNode)) {
+        if (!searchIsEmpty(pTree)) {
+            cacheDiscardKey(pTree->pSearchCache, "");
+        }
+        HtmlWalkTree(pTree, pNode, indexNodeCb, (ClientData)(size_t)op);
+    }
+}
+void 
+HtmlCssSearchInsert (HtmlTree *pTree, HtmlNode *pNode)
+{
+    searchSubtree(pTree, pNode, INDEX_ADD|INDEX_DISCARD);
+}
+void 
+HtmlCssSearchRemove (HtmlTree *pTree, HtmlNode *pNode)
+{
+    searchSubtree(pTree, pNode, INDEX_REMOVE|INDEX_DISCARD);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSearchFreeNode --
+ *
+ *     This is called by freeNode() for each element node that is about
+ *     to be deleted. The node is not necessarily still linked into the
+ *     document, so no attempt is made to determine if it was. It is 
+ *     removed from the index and any cached results that could contain 
+ *     it are discarded.
+ *
+ *     The HtmlNodeAtoms for every element in the document are built 
+ *     when it is added to the document, and are only replaced when the 
+ *     id or class attribute is modified. So if pNode has no atoms, it
+ *     is not in the id index.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlCssSearchFreeNode (HtmlTree *pTree, HtmlNode *pNode)
+{
+    HtmlElementNode *pElem = HtmlNodeAsElement(pNode);
+    if (pElem) {
+        HtmlNodeAtoms *pAtoms = pElem->pAtoms;
+        if (!searchIsEmpty(pTree)) {
+            cacheDiscardKey(pTree->pSearchCache, "");
+        } else if (!pAtoms || !pAtoms->zId) {
+            return;
+        }
+        indexNode(pTree, pNode, pAtoms, INDEX_REMOVE|INDEX_DISCARD);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSearchAttribute --
+ *
+ *     This is called after attribute zAttr of element pNode has been
+ *     modified. Argument pOld is the HtmlNodeAtoms structure for the 
+ *     node before the modification (or NULL, if it had not been built).
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Updates the document index and discards affected cached results.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlCssSearchAttribute (
+    HtmlTree *pTree, 
+    HtmlNode *pNode, 
+    const char *zAttr, 
+    HtmlNodeAtoms *pOld
+)
+{
+    HtmlSearchCache *p = pTree->pSearchCache;
+    Tcl_HashSearch sSearch;
+    Tcl_HashEntry *pEntry;
+
+    int isAtom = (!stricmp(zAttr, "id") || !stricmp(zAttr, "class"));
+
+    if (!isAtom && searchIsEmpty(pTree)) return;
+    if (!searchInDocument(pTree, pNode)) return;
+
+    if (isAtom) {
+        /* The atoms for each node in the document are normally built when
+         * it is added to the document. Rebuild them now too, so that this
+         * remains true. If pOld is NULL there is nothing to remove from
+         * the index.
+         */
+        if (pOld) {
+            indexNode(pTree, pNode, pOld, INDEX_REMOVE);
+        }
+        indexNode(pTree, pNode, HtmlNodeGetAtoms(pTree, pNode), INDEX_ADD);
+    }
+
+    pEntry = Tcl_FirstHashEntry(&p->aCache, &sSearch);
+    while (pEntry) {
+        CssCachedSearch *pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
+        pEntry = Tcl_NextHashEntry(&sSearch);
+        if (selectorUsesAttr(pCache->pStyle->pUniversalRules, zAttr)) {
+            cacheDiscard(p, pCache);
+        }
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlCssSearchDynamic --
+ *
+ *     This is called when the dynamic flags (see [$node dynamic]) of a 
+ *     node are modified. Cached results for selectors that use dynamic
+ *     pseudo-classes are discarded.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlCssSearchDynamic (HtmlTree *pTree)
+{
+    HtmlSearchCache *p = pTree->pSearchCache;
+    Tcl_HashSearch sSearch;
+    Tcl_HashEntry *pEntry;
+
+    pEntry = Tcl_FirstHashEntry(&p->aCache, &sSearch);
+    while (pEntry) {
+        CssCachedSearch *pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
+        pEntry = Tcl_NextHashEntry(&sSearch);
+        if (pCache->isDynamic) {
+            cacheDiscard(p, pCache);
+        }
+    }
+}
+
+static int 
+searchCompare (const void *pLeft, const void *pRight)
+{
+    HtmlNode *pL = *(HtmlNode **)pLeft;
+    HtmlNode *pR = *(HtmlNode **)pRight;
+    return pL->iNode - pR->iNode;
+}
+
+/*
+ * The document index is unordered. Sort the nodes in pCache into tree
+ * order.
+ */
+static void 
+searchSort (HtmlTree *pTree, CssCachedSearch *pCache)
+{
+    if (pCache->nNode > 1) {
+        HtmlSequenceNodes(pTree);
+        qsort(pCache->apNode, pCache->nNode, sizeof(HtmlNode *), searchCompare);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * searchIndex --
+ *
+ *     Search the whole document for nodes that match the rules in 
+ *     pSearch->pRuleList, testing only those nodes stored in the index
+ *     under key zKey. The results are appended to pSearch->pCache in
+ *     tree order.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Builds the document index if it has not already been built. May
+ *     renumber the nodes of the document (see HtmlSequenceNodes()).
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+searchIndex (HtmlTree *pTree, const char *zKey, CssSearch *pSearch)
+{
+    HtmlSearchCache *p = pTree->pSearchCache;
+    CssCachedSearch *pCache = pSearch->pCache;
+    Tcl_HashEntry *pEntry;
+
+    if (!p->isIndexed) {
+        Tcl_InitHashTable(&p->aIndex, TCL_STRING_KEYS);
+        p->isIndexed = 1;
+        HtmlWalkTree(pTree, 0, indexNodeCb, (ClientData)INDEX_ADD);
+        HtmlLog(pTree, "SEARCH", "Indexed document: %d keys", 
+            p->aIndex.numEntries
+        );
+    }
+
+    pEntry = Tcl_FindHashEntry(&p->aIndex, zKey);
+    if (pEntry) {
+        Tcl_HashTable *pSet = (Tcl_HashTable *)Tcl_GetHashValue(pEntry);
+        Tcl_HashSearch sSearch;
+        Tcl_HashEntry *pNodeEntry;
+        for (
+            pNodeEntry = Tcl_FirstHashEntry(pSet, &sSearch);
+            pNodeEntry;
+            pNodeEntry = Tcl_NextHashEntry(&sSearch)
+        ) {
+            HtmlNode *pNode = (HtmlNode *)Tcl_GetHashKey(pSet, pNodeEntry);
+            if (searchTest(pSearch->pRuleList, pNode)) {
+                searchAppend(pCache, pNode);
+            }
+        }
+    }
+
+    searchSort(pTree, pCache);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * searchId --
+ *
+ *     Append the nodes in the document with id zId (an atom) that match
+ *     the rules in pSearch->pRuleList to pSearch->pCache, in tree order.
+ *     If pSearch->pRuleList is NULL, all nodes with the id match. If
+ *     pSearch->pSearchRoot is not NULL, only descendants of that node
+ *     are considered.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May renumber the nodes of the document (see HtmlSequenceNodes()).
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+searchId (HtmlTree *pTree, const char *zId, CssSearch *pSearch)
+{
+    Tcl_HashEntry *pEntry = Tcl_FindHashEntry(&pTree->aId, zId);
+    if (pEntry) {
+        HtmlIdList *pList = (HtmlIdList *)Tcl_GetHashValue(pEntry);
+        int ii;
+        for (ii = 0; ii < pList->nNode; ii++) {
+            HtmlNode *pNode = pList->apNode[ii];
+            if (pSearch->pSearchRoot) {
+                HtmlNode *p;
+                for (
+                    p = HtmlNodeParent(pNode); 
+                    p && p != pSearch->pSearchRoot; 
+                    p = HtmlNodeParent(p)
+                );
+                if (!p) continue;
+            }
+            if (!pSearch->pRuleList || searchTest(pSearch->pRuleList, pNode)) {
+                searchAppend(pSearch->pCache, pNode);
+            }
+        }
+    }
+    searchSort(pTree, pSearch->pCache);
+}
+
 /*
  *---------------------------------------------------------------------------
  *
  * HtmlCssSearch --
  *
  *         widget search CSS-SELECTOR ?OPTIONS?
+ *         widget search -id ID ?OPTIONS?
  *
  *     where OPTIONS are:
  *
@@ -134,6 +976,10 @@ HtmlCssSearchShutdown (HtmlTree *pTree)
  *
  *     The -index and -length options are mutually exclusive.
  *
+ *     The second form returns the nodes with id attribute ID (compared
+ *     case-insensitively, as for "#ID" selectors). It is answered
+ *     directly from the HtmlTree.aId table and is never cached.
+ *
  * Results:
  *     None.
  *
@@ -154,6 +1000,10 @@ HtmlCssSearch(
     int n;
     CssStyleSheet *pStyle = 0;
 
+    /* Argument to -id, or NULL if a CSS selector was specified */
+    const char *zIdArg = 0;
+    int iFirstOption = 3;
+
     /* Search only descendants of this node (NULL means search whole tree) */
     HtmlNode *pSearchRoot = 0;
     int eMode = SEARCH_MODE_ALL;
@@ -181,8 +1031,16 @@ HtmlCssSearch(
         Tcl_WrongNumArgs(interp, 2, objv, "CSS-SELECTOR ?OPTIONS?");
         return TCL_ERROR;
     }
+    if (0 == strcmp(Tcl_GetString(objv[2]), "-id")) {
+        if (objc < 4) {
+            Tcl_WrongNumArgs(interp, 2, objv, "-id ID ?OPTIONS?");
+            return TCL_ERROR;
+        }
+        zIdArg = Tcl_GetString(objv[3]);
+        iFirstOption = 4;
+    }
 
-    for (iArg = 3; iArg < objc; iArg++) {
+    for (iArg = iFirstOption; iArg < objc; iArg++) {
         int iChoice;
         if (Tcl_GetIndexFromObjStruct(interp, objv[iArg], aOption, 
             sizeof(struct HtmlCssOption), "option", 0, &iChoice)
@@ -222,39 +1080,116 @@ HtmlCssSearch(
         }
     }
 
-    zOrig = Tcl_GetStringFromObj(objv[2], &n);
-    if (pSearchRoot) {
-        isNew = 1;
-    } else {
-        pEntry = Tcl_CreateHashEntry(&pTree->pSearchCache->aCache, zOrig, &isNew);
-    }
-    if (isNew) {
-        char *z;
+    if (zIdArg) {
+        /* [$html search -id]. The id must be an atom to be in the aId
+         * table. If it is not, no node has this id.
+         */
         CssSearch sSearch;
-
-        assert(n == strlen(zOrig));
-        n += 11;
-        z = (char *)HtmlAlloc("temp", n);
-        sprintf(z, "%s {width:0}", zOrig);
-        HtmlCssSelectorParse(pTree, n, z, &pStyle);
-        if ( !pStyle || !pStyle->pUniversalRules) {
-            Tcl_AppendResult(interp, "Bad css selector: \"", zOrig, "\"", 0); 
-            return TCL_ERROR;
-        }
-        sSearch.pRuleList = pStyle->pUniversalRules;
+        memset(&sSearch, 0, sizeof(CssSearch));
         sSearch.pTree = pTree;
         sSearch.pSearchRoot = pSearchRoot;
         sSearch.pCache = HtmlNew(CssCachedSearch);
-        HtmlWalkTree(pTree, pSearchRoot, cssSearchCb, (ClientData)&sSearch);
+        if (pSearchRoot && !searchInDocument(pTree, pSearchRoot)) {
+            /* An orphan tree. The nodes are not in HtmlTree.aId, and may
+             * not have had their atoms built yet, so intern the id here.
+             */
+            ClientData cd = (ClientData)&sSearch;
+            sSearch.zId = HtmlAtom(pTree, zIdArg);
+            HtmlWalkTree(pTree, pSearchRoot, searchIdCb, cd);
+        } else {
+            const char *zId = HtmlAtomFind(pTree, zIdArg);
+            if (zId) {
+                searchId(pTree, zId, &sSearch);
+            }
+        }
         pCache = sSearch.pCache;
-        HtmlCssStyleSheetFree(pStyle);
-        HtmlFree(z);
+        pEntry = 0;
+    } else {
+        zOrig = Tcl_GetStringFromObj(objv[2], &n);
+        if (pSearchRoot) {
+            isNew = 1;
+        } else {
+            pEntry = Tcl_CreateHashEntry(
+                &pTree->pSearchCache->aCache, zOrig, &isNew
+            );
+        }
+        if (isNew) {
+            char *z;
+            CssSearch sSearch;
+            Tcl_DString key;
+            int isDynamic;
+            const char *zId;
+
+            assert(n == strlen(zOrig));
+            n += 11;
+            z = (char *)HtmlAlloc("temp", n);
+            sprintf(z, "%s {width:0}", zOrig);
+            HtmlCssSelectorParse(pTree, n, z, &pStyle);
+            HtmlFree(z);
+            if ( !pStyle || !pStyle->pUniversalRules) {
+                HtmlCssStyleSheetFree(pStyle);
+                if (pEntry) {
+                    Tcl_DeleteHashEntry(pEntry);
+                }
+                Tcl_AppendResult(interp, 
+                    "Bad css selector: \"", zOrig, "\"", 0
+                ); 
+                return TCL_ERROR;
+            }
+            sSearch.pRuleList = pStyle->pUniversalRules;
+            sSearch.pTree = pTree;
+            sSearch.pSearchRoot = pSearchRoot;
+            sSearch.pCache = HtmlNew(CssCachedSearch);
+            sSearch.zId = 0;
+            pCache = sSearch.pCache;
+
+            Tcl_DStringInit(&key);
+            isDynamic = selectorAnalyze(sSearch.pRuleList, &key, &zId);
+            if (zId && pSearchRoot && !searchInDocument(pTree, pSearchRoot)) {
+                /* HtmlTree.aId only contains nodes in the document. If 
+                 * the search root is part of an orphan tree, walk it.
+                 */
+                zId = 0;
+            }
+            if (zId) {
+                searchId(pTree, zId, &sSearch);
+            } else if (!pSearchRoot && Tcl_DStringLength(&key) > 0) {
+                searchIndex(pTree, Tcl_DStringValue(&key), &sSearch);
+            } else {
+                ClientData cd = (ClientData)&sSearch;
+                HtmlWalkTree(pTree, pSearchRoot, cssSearchCb, cd);
+            }
 
-        if (pEntry) {
-            Tcl_SetHashValue(pEntry, sSearch.pCache);
+            if (pEntry) {
+                /* Link the new result into the list for its key, so that 
+                 * it can be found by the HtmlCssSearchXXX() notification
+                 * functions.
+                 */
+                HtmlSearchCache *p = pTree->pSearchCache;
+                Tcl_HashEntry *pKeyEntry;
+                int isNewKey;
+                pKeyEntry = Tcl_CreateHashEntry(
+                    &p->aKey, Tcl_DStringValue(&key), &isNewKey
+                );
+                pCache->pStyle = pStyle;
+                pCache->isDynamic = isDynamic;
+                pCache->pEntry = pEntry;
+                pCache->pKeyEntry = pKeyEntry;
+                if (!isNewKey) {
+                    CssCachedSearch *pNext;
+                    pNext = (CssCachedSearch *)Tcl_GetHashValue(pKeyEntry);
+                    pCache->pNextKey = pNext;
+                    pNext->pPrevKey = pCache;
+                }
+                Tcl_SetHashValue(pKeyEntry, pCache);
+                Tcl_SetHashValue(pEntry, pCache);
+            } else {
+                HtmlCssStyleSheetFree(pStyle);
+            }
+            Tcl_DStringFree(&key);
+        } else {
+            pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
         }
-    } else {
-        pCache = (CssCachedSearch *)Tcl_GetHashValue(pEntry);
     }
 
     switch (eMode) {
@@ -282,9 +1217,9 @@ HtmlCssSearch(
             break;
     }
 
-    if (pSearchRoot) {
-        HtmlFree(pCache->apNode);
-        HtmlFree(pCache);
+    if (!pEntry) {
+        /* A -root or -id search. The result is not cached. */
+        cacheFree(pCache);
     }
 
     return TCL_OK;
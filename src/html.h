@@ -141,7 +141,12 @@ typedef struct HtmlTextIter HtmlTextIter;
 typedef struct HtmlDamage HtmlDamage;
 
 typedef struct HtmlFragmentContext HtmlFragmentContext;
+typedef struct HtmlNodeAtoms HtmlNodeAtoms;
 typedef struct HtmlSearchCache HtmlSearchCache;
+typedef struct HtmlSharedData HtmlSharedData;
+typedef struct HtmlParseJob HtmlParseJob;
+typedef struct HtmlNodeArena HtmlNodeArena;
+typedef struct HtmlArenaBlock HtmlArenaBlock;
 
 #include "css.h"
 #include "htmlprop.h"
@@ -162,7 +167,6 @@ struct HtmlTokenMap {
   Html_16 type;                   /* Markup type code */
   Html_u8 flags;                  /* Combination of HTMLTAG values */
   HtmlContentTest xClose;         /* Function to identify close tag */
-  HtmlTokenMap *pCollide;         /* Hash table collision chain */
 };
 
 #define HTMLTAG_INLINE      0x02  /* Set for an HTML inline tag */
@@ -180,6 +184,8 @@ struct HtmlTokenMap {
 
 struct HtmlAttributes {
     int nAttr;
+    int nIndex;             /* Size of aIndex[] (a power of 2), or 0 */
+    int *aIndex;            /* Hash index of a[] by name atom, or NULL */
     struct HtmlAttribute {
         char *zName;
         char *zValue;
@@ -334,16 +340,58 @@ struct HtmlTextNode {
  */
 #define HTML_INLINE_STYLE_ATTR "style"
 
+/*
+ * Data shared by all widgets created in a single interpreter. An instance
+ * is stored as interpreter associated-data (see Tcl_SetAssocData()) and 
+ * pointed to by HtmlTree.pShared. It is reference counted - one reference
+ * for the interpreter and one for each widget.
+ *
+ * aAtom:
+ *     String atoms (case-insensitive) used by the shared default 
+ *     stylesheet (see below). It is populated only while the shared
+ *     stylesheet is parsed. HtmlAtom() returns an atom from this table
+ *     in preference to one from HtmlTree.aAtom, so that the atoms of the
+ *     shared stylesheet may be compared by pointer with those from the 
+ *     document of any widget.
+ *
+ * pAgentStyle, pAgentText, eAgentMode:
+ *     The default stylesheet, parsed once and shared by all widgets that
+ *     use the same -defaultstyle text in the same -mode. See
+ *     HtmlCssLoadDefaultStyle().
+ */
+struct HtmlSharedData {
+    int nRef;                       /* Number of references */
+    Tcl_HashTable aAtom;            /* String atoms */
+    CssStyleSheet *pAgentStyle;     /* Parsed default stylesheet, or NULL */
+    Tcl_Obj *pAgentText;            /* Text pAgentStyle was parsed from */
+    int eAgentMode;                 /* Value of -mode when it was parsed */
+};
+
 /*
  * Structure to store an element (non-text) node.
  */
+/*
+ * The "id" attribute and each name in the "class" attribute of an element,
+ * interned by HtmlAtom(). This allows the style engine and selector 
+ * matching to compare class and id names by pointer. An instance
+ * is built on demand by HtmlNodeGetAtoms() and stored in 
+ * HtmlElementNode.pAtoms until the node attributes are modified.
+ */
+struct HtmlNodeAtoms {
+    const char *zId;               /* Atom for "id" attribute, or NULL */
+    int nClass;                    /* Number of entries in azClass[] */
+    const char **azClass;          /* Atoms for each class name */
+};
+
 struct HtmlElementNode {
     HtmlNode node;          /* Base class. MUST BE FIRST. */
 
     HtmlAttributes *pAttributes;      /* Html attributes associated with node */
+    HtmlNodeAtoms *pAtoms;            /* Interned class and id, or NULL */
 
     /* Children of this element node */
     int nChild;                    /* Number of child nodes */
+    int nChildAlloc;               /* Allocated size of apChildren[] */
     HtmlNode **apChildren;         /* Array of pointers to children nodes */
 
     CssPropertySet *pStyle;                /* Parsed inline style */
@@ -412,6 +460,7 @@ struct HtmlOptions {
     int      forcefontmetrics;
     int      forcewidth;
     Tcl_Obj *imagecmd;
+    Tcl_Obj *preloadcmd;
     Tcl_Obj *drawcleanupcrashcmd;
     int      imagecache;
     int      imagepixmapify;
@@ -420,6 +469,8 @@ struct HtmlOptions {
     double   zoom;                      /* Universal scaling factor. */
 
     int      parsemode;                 /* One of the HTML_PARSEMODE values */
+    int      asyncparse;                /* Boolean. Tokenize in a thread */
+    int      parsebudget;               /* Max ms per parse slice, or 0 */
 
     /* Debugging options. Not part of the official interface. */
     int      enablelayout;
@@ -467,13 +518,13 @@ struct HtmlCallback {
     HtmlCanvasSnapshot *pSnapshot;
 
     /* HTML_DYNAMIC */
-    HtmlNode *pDynamic;         /* Recalculate dynamic CSS for this node */
+    Tcl_HashTable aDynamic;     /* Elements with modified dynamic flags */
 
     /* HTML_DAMAGE */
     HtmlDamage *pDamage;
 
-    /* HTML_RESTYLE */
-    HtmlNode *pRestyle;         /* Restyle this node */
+    /* HTML_RESTYLE. Set of nodes to restyle (see HtmlCallbackRestyle) */
+    Tcl_HashTable aRestyle;
 
     /* HTML_SCROLL */
     int iScrollX;               /* New HtmlTree.iScrollX value */
@@ -493,7 +544,7 @@ struct HtmlCallback {
  * Functions used to schedule callbacks and set the HtmlCallback state. 
  */
 void HtmlCallbackForce(HtmlTree *);
-void HtmlCallbackDynamic(HtmlTree *, HtmlNode *);
+void HtmlCallbackDynamic(HtmlTree *, HtmlNode *, int);
 void HtmlCallbackDamage(HtmlTree *, int, int, int, int);
 void HtmlCallbackLayout(HtmlTree *, HtmlNode *);
 void HtmlCallbackRestyle(HtmlTree *, HtmlNode *);
@@ -517,6 +568,39 @@ struct HtmlTreeState {
     int isCdataInHead;      /* True if previous token was <title> */
 };
 
+/*
+ * Each document tree owns an arena from which HtmlElementNode structures
+ * and small HtmlElementNode.apChildren[] arrays are allocated. Memory is
+ * obtained from the heap in blocks of HTML_ARENA_BLOCKSIZE bytes and
+ * handed out by bumping HtmlNodeArena.iFree. Allocations released
+ * individually (i.e. nodes removed by DOM mutation) are kept on a free-list
+ * per size class for reuse. All blocks are returned to the heap at once
+ * by HtmlTreeClear().
+ *
+ * Size class 0 is used for HtmlElementNode structures. Size class N (N>0)
+ * is used for apChildren[] arrays with space for (1<<(N-1)) pointers.
+ * Larger child arrays are allocated from the heap.
+ *
+ * Only the thread that owns the widget allocates from the arena. Text
+ * nodes and attribute structures, which may be created by the background
+ * tokenizer (see htmlparse.c), are still allocated from the heap.
+ */
+#define HTML_ARENA_BLOCKSIZE 32768
+#define HTML_ARENA_NCLASS    8
+
+struct HtmlNodeArena {
+    HtmlArenaBlock *pBlock;     /* Most recently allocated block, or NULL */
+    int iFree;                  /* Offset of first unused byte in pBlock */
+    void *apFree[HTML_ARENA_NCLASS];    /* Free-list for each size class */
+
+    /* Statistics reported by the [$html _arenastats] command. */
+    int nBlock;                 /* Number of blocks currently allocated */
+    int nLive;                  /* Allocations currently in use */
+    int nAlloc;                 /* Total allocations since last clear */
+    int nReuse;                 /* Allocations satisfied by a free-list */
+    int nLarge;                 /* Child arrays allocated from the heap */
+};
+
 struct HtmlTree {
 
     /*
@@ -546,8 +630,15 @@ struct HtmlTree {
 
     /*
      * The search cache object.
+     *
+     * aId maps from element id (an atom - see HtmlNodeGetAtoms()) to the
+     * list of element nodes in the document with that id. It is kept up 
+     * to date by the HtmlCssSearchXXX() notification functions called
+     * from htmltree.c and used by [$html search -id] and by searches
+     * for id selectors. See csssearch.c.
      */
     HtmlSearchCache *pSearchCache;
+    Tcl_HashTable aId;              /* Map from id atom to HtmlIdList */
 
     /* The following variables are used to stored the text of the current
      * document (i.e. the *.html file) as it is being parsed.
@@ -556,22 +647,46 @@ struct HtmlTree {
      * entirely of 7-bit ASCII, then they are equal. The nCharParsed variable
      * is required so that the offsets passed to parse-handler callbacks
      * are in characters, not bytes. TODO! See ticket #126.
+     *
+     * If the document was loaded by [parse -file], the text may instead be
+     * a read-only memory mapping of the file (zMapped). At most one of
+     * pDocument and zMapped is non-NULL. The mapping is replaced by a copy
+     * in pDocument before the text is modified (see htmlparse.c).
      */
     Tcl_Obj *pDocument;             /* Text of the html document */
+    char *zMapped;                  /* Or, text mapped by [parse -file] */
+    int nMapped;                    /* Size of zMapped in bytes */
     int nParsed;                    /* Bytes of pDocument tokenized */
+    int nDiscarded;                 /* Bytes discarded by [parse -discard] */
     int nCharParsed;                /* TODO: Characters parsed */
+    int iDocument;                  /* Incremented by HtmlTreeClear() */
 
     int iWriteInsert;               /* Byte offset in pDocument for [write] */
     int eWriteState;                /* One of the HTML_WRITE_XXX values */
+    HtmlParseJob *pParseJob;        /* Background tokenizer job, or NULL */
+    int isParseYield;               /* True if tokenizer yielded (-parsebudget) */
+    Tcl_Time parseDeadline;         /* Time at which tokenizer should yield */
+    int nPreloaded;                 /* Bytes of pDocument preload-scanned */
+    int iPreloadResume;             /* Preload scanner end-search offset */
+    Tcl_HashTable *pPreload;        /* URIs reported to -preloadcmd */
 
     int isIgnoreNewline;            /* True after an opening tag */
     int isParseFinished;            /* True if the html parse is finished */
 
     HtmlNode *pRoot;                /* The root-node of the document. */
 
+    HtmlSharedData *pShared;        /* Per-interpreter shared data */
+
+    /* String atoms. Atoms used by the shared default stylesheet are 
+     * stored in HtmlSharedData.aAtom, all others (i.e. the class and id
+     * names in the document) in HtmlTree.aAtom, so that they are freed 
+     * along with the widget. See HtmlAtom().
+     */
     Tcl_HashTable aAtom;            /* String atoms for this widget */
+    int isSharedAtom;               /* True to create atoms in pShared */
 
     HtmlTreeState state;
+    HtmlNodeArena arena;            /* Allocator for document tree nodes */
 
     /* Sub-trees that are not currently linked into the tree rooted at 
      * pRoot are stored in the following hash-table. The HTML_NODE_ORPHAN
@@ -581,6 +696,7 @@ struct HtmlTree {
      * that is the root of the orphaned tree. Hash entry data is not used.
      */
     Tcl_HashTable aOrphan;          /* Orphan nodes (see [$html fragment]) */
+    Tcl_HashTable aDynamicDep;      /* Elements with non-local dynamic CSS */
 
     /* This pointer is used to store context during the exeuction of 
      * the [$html fragment] command. See htmltree.c for details.
@@ -715,7 +831,7 @@ Tcl_ObjCmdProc HtmlCreateUri;
 
 char *HtmlPropertyToString(CssProperty *, char **);
 
-int HtmlStyleApply(HtmlTree *, HtmlNode *);
+int HtmlStyleApply(HtmlTree *, Tcl_HashTable *);
 int HtmlStyleCounter(HtmlTree *, const char *);
 int HtmlStyleCounters(HtmlTree *, const char *, int *, int);
 void HtmlStyleHandleCounters(HtmlTree *, HtmlComputedValues *);
@@ -725,6 +841,11 @@ void HtmlLayoutMarkerBox(int, int, int, char *);
 
 int HtmlStyleParse(HtmlTree*, Tcl_Obj*, Tcl_Obj*, Tcl_Obj*, Tcl_Obj*, Tcl_Obj*);
 void HtmlTokenizerAppend(HtmlTree *, const char *, int, int);
+int HtmlTokenizerAppendFile(HtmlTree *, const char *, int);
+int HtmlTokenizerHasDocument(HtmlTree *);
+void HtmlTokenizerRelease(HtmlTree *);
+void HtmlTokenizerDiscard(HtmlTree *);
+void HtmlTokenizerCancel(HtmlTree *);
 int HtmlNameToType(void *, char *);
 Html_u8 HtmlMarkupFlags(int);
 
@@ -736,6 +857,8 @@ typedef int (*html_walk_tree_cb)(HtmlTree*,HtmlNode*,ClientData);
 int HtmlWalkTree(HtmlTree*, HtmlNode *, html_walk_tree_cb, ClientData);
 
 int HtmlTreeClear(HtmlTree *);
+const char *HtmlAtom(HtmlTree *, const char *);
+const char *HtmlAtomFind(HtmlTree *, const char *);
 int         HtmlNodeNumChildren(HtmlNode *);
 HtmlNode *  HtmlNodeBefore(HtmlNode *);
 HtmlNode *  HtmlNodeAfter(HtmlNode *);
@@ -743,12 +866,16 @@ HtmlNode *  HtmlNodeRightSibling(HtmlNode *);
 HtmlNode *  HtmlNodeLeftSibling(HtmlNode *);
 char CONST *HtmlNodeTagName(HtmlNode *);
 char CONST *HtmlNodeAttr(HtmlNode *, char CONST *);
+HtmlNodeAtoms *HtmlNodeGetAtoms(HtmlTree *, HtmlNode *);
 char *      HtmlNodeToString(HtmlNode *);
 HtmlNode *  HtmlNodeGetPointer(HtmlTree *, char CONST *);
 int         HtmlNodeIsOrphan(HtmlNode *);
 
-int HtmlNodeAddChild(HtmlElementNode *, int, const char *, HtmlAttributes *);
-int HtmlNodeAddTextChild(HtmlNode *, HtmlTextNode *);
+HtmlElementNode *HtmlElementNew(HtmlTree *);
+int HtmlNodeAddChild(
+    HtmlTree *, HtmlElementNode *, int, const char *, HtmlAttributes *
+);
+int HtmlNodeAddTextChild(HtmlTree *, HtmlNode *, HtmlTextNode *);
 
 Html_u8     HtmlNodeTagType(HtmlNode *);
 
@@ -801,6 +928,8 @@ void HtmlWidgetOverflowBox(HtmlTree *, HtmlNode *, int *, int *, int *, int *);
 HtmlTokenMap *HtmlMarkup(int);
 CONST char * HtmlMarkupName(int);
 char * HtmlMarkupArg(HtmlAttributes *, CONST char *, char *);
+char * HtmlMarkupArgAtom(HtmlAttributes *, CONST char *, char *);
+CONST char * HtmlAttrAtom(CONST char *, int);
 
 void HtmlFloatListAdd(HtmlFloatList*, int, int, int, int);
 HtmlFloatList *HtmlFloatListNew();
@@ -858,6 +987,7 @@ int HtmlNodeClearGenerated(HtmlTree *, HtmlElementNode *);
 void HtmlNodeClearRecursive(HtmlTree *, HtmlNode *);
 
 void HtmlTranslateEscapes(char *);
+void HtmlTranslateAttrEscapes(char *);
 void HtmlRestackNodes(HtmlTree *pTree);
 void HtmlDelStackingInfo(HtmlTree *, HtmlElementNode *);
 
@@ -916,7 +1046,7 @@ void HtmlTreeAddClosingTag(HtmlTree *, int, const char *, int);
 
 void HtmlInitTree(HtmlTree *);
 
-void HtmlHashInit(void *, int);
+unsigned int HtmlHashString(const char *, int, int, unsigned int);
 HtmlTokenMap * HtmlHashLookup(void *, const char *zType);
 
 /*******************************************************************
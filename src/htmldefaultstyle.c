@@ -563,36 +563,753 @@
 
 
 
+#define HTML_DEFAULT_CSS_OPS \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "ADDRESS"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BLOCKQUOTE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BODY"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DIV"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DT"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FIELDSET"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FRAME"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H1"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H2"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H3"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H4"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H5"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H6"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "NOFRAMES"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "APPLET"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CENTER"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DIR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "HR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "MENU"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "PRE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FORM"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "block"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "HEAD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SCRIPT"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TITLE"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "none"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BODY"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "8px"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "list-item"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"square\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "square"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"disc\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "disc"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"circle\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "circle"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"circle\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "circle"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"square\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "square"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"disc\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "disc"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DIR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "MENU"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DD"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding-left", "40px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-left", "1em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "type", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "tcl(::tkhtml::ol_liststyletype)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "NOBR"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "nowrap"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"left\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "float", "left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"right\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "float", "right"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "inherit"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"center\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-left", "auto"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-right", "auto"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "inherit"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"left\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "float", "left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"right\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "float", "right"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"right\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "-tkhtml-right"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"left\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "-tkhtml-left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CENTER"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "align", "\"center\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "-tkhtml-center"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding", "1px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-color", "grey60"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-color", "grey60"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-color", "grey25"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-color", "grey25"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "HR"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "block"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top", "1px solid grey45"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom", "1px solid grey80"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "0.5em auto 0.5em auto"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-spacing", "2px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-color", "grey25"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-color", "grey25"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-color", "grey60"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-color", "grey60"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TR"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-row"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "THEAD"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-header-group"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TBODY"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-row-group"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TFOOT"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-footer-group"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "COL"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-column"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "COLGROUP"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-column-group"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-cell"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CAPTION"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "table-caption"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-weight", "bolder"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "center"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CAPTION"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "center"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H1"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "2em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", ".67em 0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H2"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "1.5em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", ".83em 0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H3"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "1.17em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "1em 0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H4"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BLOCKQUOTE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FIELDSET"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DIR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "MENU"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-top", "1.0em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "1.0em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H5"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", ".83em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "line-height", "1.17em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "1.67em 0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H6"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", ".67em"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "2.33em 0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H1"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H2"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H3"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H4"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H5"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "H6"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "B"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "STRONG"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-weight", "bolder"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BLOCKQUOTE"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-left", "40px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-right", "40px"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "I"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CITE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "EM"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "VAR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "ADDRESS"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-style", "italic"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "PRE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TT"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "CODE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "KBD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SAMP"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-family", "courier"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BIG"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "1.17em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SMALL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SUB"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SUP"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", ".83em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SUB"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "vertical-align", "sub"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SUP"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "vertical-align", "super"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "S"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "STRIKE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "DEL"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-decoration", "line-through"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "list-style-type", "decimal"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "UL"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-top", "0"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "0"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "U"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INS"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-decoration", "underline"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOELEMENT_BEFORE, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "content", "\"\\A\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "pre"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "ABBR"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "ACRONYM"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-variant", "small-caps"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "letter-spacing", "0.1em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "PRE"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "PLAINTEXT"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "XMP"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "block"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "pre"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin", "1em 0"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-family", "courier"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_LINK, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "darkblue"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-decoration", "underline"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "cursor", "pointer"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_VISITED, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "purple"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-decoration", "underline"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "cursor", "pointer"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "nowrap", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "nowrap", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "nowrap"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "nowrap", "\"0\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "nowrap", "\"0\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "normal"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"hidden\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "none"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "type", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border", "none"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"file\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"text\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"password\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TEXTAREA"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SELECT"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border", "2px solid"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-color", "#848280 #ececec #ececec #848280"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "line-height", "normal"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"image\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "src", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "-tkhtml-replacement-image", "attr(src)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"submit\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"button\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "button"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "-tkhtml-inline-button"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border", "2px solid"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-color", "#ffffff #828282 #828282 #ffffff"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "background-color", "#d9d9d9"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "#000000"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding", "3px 3px 1px 3px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "nowrap"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "tcl(::tkhtml::if_disabled #666666 #000000)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"submit\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOELEMENT_AFTER, 0, 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"button\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOELEMENT_AFTER, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "content", "attr(value)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "position", "relative"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"submit\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_HOVER, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_ACTIVE, 0, 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "type", "\"button\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_HOVER, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_ACTIVE, 0, 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "button"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_HOVER, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_ACTIVE, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-color", "tcl(::tkhtml::if_disabled #ffffff #828282)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-color", "tcl(::tkhtml::if_disabled #ffffff #828282)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-color", "tcl(::tkhtml::if_disabled #828282 #ffffff)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-color", "tcl(::tkhtml::if_disabled #828282 #ffffff)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "INPUT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "size", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "width", "tcl(::tkhtml::inputsize_to_css)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BUTTON"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "nowrap"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-width", "2px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-style", "solid"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TEXTAREA"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "cols", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "width", "tcl(::tkhtml::textarea_width)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TEXTAREA"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "rows", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "height", "tcl(::tkhtml::textarea_height)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TEXTAREA"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-family", "monospace"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FRAMESET"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "display", "none"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IFRAME"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "width", "300px"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "height", "200px"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "color", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "attr(color)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "body"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "a"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "href", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_LINK, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "attr(link x body)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "body"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "a"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "href", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_VISITED, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "attr(vlink x body)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "width", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "width", "attr(width l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "height", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "height", "attr(height l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "basefont"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "size", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "attr(size)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "font"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "size", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "tcl(::tkhtml::size_to_fontsize)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "bgcolor", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "background-color", "attr(bgcolor)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "clear", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "clear", "attr(clear)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "clear", "\"all\""}, \
+    {CSS_PARSEOP_DECLARATION, 0, "clear", "both"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "src", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "-tkhtml-replacement-image", "attr(src)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "-tkhtml-replacement-image", "\"\""}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "border", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "border", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "border", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-width", "attr(border l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-width", "attr(border l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-width", "attr(border l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-width", "attr(border l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-style", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-style", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-style", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-style", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "border", "\"\""}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "border", "\"\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "td"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTRVALUE, "border", "\"\""}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "th"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-top-width", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-right-width", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-bottom-width", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-left-width", "attr(border x table solid)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "cellpadding", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "td"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "cellpadding", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_DESCENDANT, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "th"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding-top", "attr(cellpadding l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding-right", "attr(cellpadding l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding-bottom", "attr(cellpadding l table)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "padding-left", "attr(cellpadding l table)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "cellspacing", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "table"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "cellspacing", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "border-spacing", "attr(cellspacing l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "vertical-align", "middle"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "valign", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "valign", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "vertical-align", "attr(valign x tr)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "valign", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TR"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "valign", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "vertical-align", "attr(valign)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "body"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "text", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "color", "attr(text)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "background", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "background-image", "attr(background)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "vspace", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OBJECT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "vspace", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "APPLET"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "vspace", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-top", "attr(vspace l)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "attr(vspace l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "IMG"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "hspace", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OBJECT"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "hspace", 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "APPLET"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "hspace", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-left", "attr(hspace l)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-right", "attr(hspace l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BODY"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "marginheight", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-top", "attr(marginheight l)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "attr(marginheight l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "BODY"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "marginwidth", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-left", "attr(marginwidth l)"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-right", "attr(marginwidth l)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "OL"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "start", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "-tkhtml-ordered-list-start", "attr(start)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "LI"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "value", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "-tkhtml-ordered-list-value", "attr(value)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "SPAN"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "spancontent", 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOELEMENT_AFTER, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "content", "attr(spancontent)"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0},
+
+
+#define HTML_DEFAULT_QUIRKS_OPS \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "white-space", "normal"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "line-height", "normal"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-size", "medium"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-weight", "normal"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-style", "normal"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "font-variant", "normal"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TABLE"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_ATTR, "align", 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "text-align", "left"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_FIRSTCHILD, 0, 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_FIRSTCHILD, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-top", "0px"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TH"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_LASTCHILD, 0, 0}, \
+    {CSS_PARSEOP_COMMA, 0, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "TD"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTORCHAIN_CHILD, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "P"}, \
+    {CSS_PARSEOP_SELECTOR, CSS_PSEUDOCLASS_LASTCHILD, 0, 0}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "0px"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0}, \
+    {CSS_PARSEOP_SELECTOR, CSS_SELECTOR_TYPE, 0, "FORM"}, \
+    {CSS_PARSEOP_DECLARATION, 0, "margin-bottom", "1em"}, \
+    {CSS_PARSEOP_RULE, 1, 0, 0},
+
+
 #define HTML_SOURCE_FILES \
-    "css.c,v 1.139 2007/12/16 11:57:43 danielk1977 Exp\n" \
-    "cssdynamic.c,v 1.12 2007/06/10 07:53:03 danielk1977 Exp\n" \
-    "cssparser.c,v 1.8 2008/01/19 06:08:13 danielk1977 Exp\n" \
-    "csssearch.c,v 1.7 2007/10/27 08:37:50 hkoba Exp\n" \
-    "htmlcmd.c,v 1.32 2005/03/26 11:54:30 danielk1977 Exp\n" \
-    "htmldecode.c,v 1.9 2008/01/09 06:49:37 danielk1977 Exp\n" \
-    "htmldraw.c,v 1.208 2008/02/14 08:43:49 danielk1977 Exp\n" \
-    "htmlexts.c,v 1.11 2005/03/24 12:05:06 danielk1977 Exp\n" \
-    "htmlfloat.c,v 1.21 2006/10/27 15:19:18 danielk1977 Exp\n" \
-    "htmlform.c,v 1.33 2005/03/23 01:36:54 danielk1977 Exp\n" \
+    "htmltest.c,v 1.15 2005/03/23 01:36:54 danielk1977 Exp\n" \
     "htmlimage.c,v 1.70 2008/01/20 06:17:49 danielk1977 Exp\n" \
+    "htmlurl.c,v 1.27 2005/03/23 01:36:54 danielk1977 Exp\n" \
+    "htmlwish.c,v 1.10 2005/03/23 23:56:27 danielk1977 Exp\n" \
+    "htmlPs.c,v 1.8 2005/03/23 01:36:54 danielk1977 Exp\n" \
     "htmlindex.c,v 1.15 2005/03/24 12:05:06 danielk1977 Exp\n" \
+    "htmlstyle.c,v 1.61 2007/12/12 04:50:29 danielk1977 Exp\n" \
+    "htmlexts.c,v 1.11 2005/03/24 12:05:06 danielk1977 Exp\n" \
+    "restrack.c,v 1.13 2007/12/12 04:50:29 danielk1977 Exp\n" \
+    "htmltcl.c,v 1.207 2008/01/16 06:29:27 danielk1977 Exp\n" \
+    "css.c,v 1.139 2007/12/16 11:57:43 danielk1977 Exp\n" \
+    "htmlparse.c,v 1.121 2007/12/08 15:33:00 danielk1977 Exp\n" \
     "htmlinline.c,v 1.60 2008/01/12 14:23:05 danielk1977 Exp\n" \
+    "cssparser.c,v 1.8 2008/01/19 06:08:13 danielk1977 Exp\n" \
     "htmllayout.c,v 1.270 2008/01/07 04:48:02 danielk1977 Exp\n" \
-    "htmlparse.c,v 1.121 2007/12/08 15:33:00 danielk1977 Exp\n" \
-    "htmlprop.c,v 1.135 2007/12/05 10:11:12 danielk1977 Exp\n" \
-    "htmlPs.c,v 1.8 2005/03/23 01:36:54 danielk1977 Exp\n" \
+    "htmldecode.c,v 1.9 2008/01/09 06:49:37 danielk1977 Exp\n" \
     "htmlPsImg.c,v 1.7 2005/03/23 01:36:54 danielk1977 Exp\n" \
-    "htmlsizer.c,v 1.44 2005/03/23 01:36:54 danielk1977 Exp\n" \
-    "htmlstyle.c,v 1.61 2007/12/12 04:50:29 danielk1977 Exp\n" \
-    "htmltable.c,v 1.124 2007/11/03 11:23:16 danielk1977 Exp\n" \
-    "htmltagdb.c,v 1.11 2007/11/11 11:00:48 danielk1977 Exp\n" \
-    "htmltcl.c,v 1.207 2008/01/16 06:29:27 danielk1977 Exp\n" \
-    "htmltest.c,v 1.15 2005/03/23 01:36:54 danielk1977 Exp\n" \
     "htmltree.c,v 1.161 2008/02/14 08:39:14 danielk1977 Exp\n" \
-    "htmlurl.c,v 1.27 2005/03/23 01:36:54 danielk1977 Exp\n" \
+    "htmlprop.c,v 1.135 2007/12/05 10:11:12 danielk1977 Exp\n" \
     "htmlwidget.c,v 1.59 2005/03/23 23:56:27 danielk1977 Exp\n" \
-    "htmlwish.c,v 1.10 2005/03/23 23:56:27 danielk1977 Exp\n" \
+    "htmlform.c,v 1.33 2005/03/23 01:36:54 danielk1977 Exp\n" \
+    "cssdynamic.c,v 1.12 2007/06/10 07:53:03 danielk1977 Exp\n" \
+    "htmlfloat.c,v 1.21 2006/10/27 15:19:18 danielk1977 Exp\n" \
+    "htmlcmd.c,v 1.32 2005/03/26 11:54:30 danielk1977 Exp\n" \
+    "htmldraw.c,v 1.208 2008/02/14 08:43:49 danielk1977 Exp\n" \
     "main.c,v 1.9 2007/09/28 14:14:56 danielk1977 Exp\n" \
-    "restrack.c,v 1.13 2007/12/12 04:50:29 danielk1977 Exp\n" \
+    "htmltable.c,v 1.124 2007/11/03 11:23:16 danielk1977 Exp\n" \
+    "htmltagdb.c,v 1.11 2007/11/11 11:00:48 danielk1977 Exp\n" \
+    "csssearch.c,v 1.7 2007/10/27 08:37:50 hkoba Exp\n" \
+    "htmlsizer.c,v 1.44 2005/03/23 01:36:54 danielk1977 Exp\n" \
     "swproc.c,v 1.6 2006/06/10 12:38:38 danielk1977 Exp\n" \
 
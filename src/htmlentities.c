@@ -0,0 +1,2251 @@
+
+/*
+ * DO NOT EDIT!
+ *
+ * The code in this file was automatically generated. See the files
+ * src/entities.txt and src/mkentities.tcl from the tkhtml source
+ * distribution.
+ */
+
+#define HTML_ENTITY_COUNT 2126
+#define HTML_ENTITY_BUCKETS 1063
+#define HTML_ENTITY_MAXLEGACY 6
+
+static const struct HtmlEntity aHtmlEntity[HTML_ENTITY_COUNT] = {
+  {"ThinSpace",                        9, "\xE2\x80\x89",            3, 0},
+  {"heartsuit",                        9, "\xE2\x99\xA5",            3, 0},
+  {"rcaron",                           6, "\xC5\x99",                2, 0},
+  {"fjlig",                            5, "\x66\x6A",                2, 0},
+  {"nprec",                            5, "\xE2\x8A\x80",            3, 0},
+  {"bigcirc",                          7, "\xE2\x97\xAF",            3, 0},
+  {"tcy",                              3, "\xD1\x82",                2, 0},
+  {"elsdot",                           6, "\xE2\xAA\x97",            3, 0},
+  {"in",                               2, "\xE2\x88\x88",            3, 0},
+  {"plus",                             4, "\x2B",                    1, 0},
+  {"rBarr",                            5, "\xE2\xA4\x8F",            3, 0},
+  {"nsubseteqq",                      10, "\xE2\xAB\x85\xCC\xB8",    5, 0},
+  {"lbrace",                           6, "\x7B",                    1, 0},
+  {"TildeFullEqual",                  14, "\xE2\x89\x85",            3, 0},
+  {"eta",                              3, "\xCE\xB7",                2, 0},
+  {"chi",                              3, "\xCF\x87",                2, 0},
+  {"Cap",                              3, "\xE2\x8B\x92",            3, 0},
+  {"pre",                              3, "\xE2\xAA\xAF",            3, 0},
+  {"rhov",                             4, "\xCF\xB1",                2, 0},
+  {"Phi",                              3, "\xCE\xA6",                2, 0},
+  {"blacklozenge",                    12, "\xE2\xA7\xAB",            3, 0},
+  {"divonx",                           6, "\xE2\x8B\x87",            3, 0},
+  {"clubs",                            5, "\xE2\x99\xA3",            3, 0},
+  {"emptyv",                           6, "\xE2\x88\x85",            3, 0},
+  {"Nu",                               2, "\xCE\x9D",                2, 0},
+  {"rarrhk",                           6, "\xE2\x86\xAA",            3, 0},
+  {"jmath",                            5, "\xC8\xB7",                2, 0},
+  {"longmapsto",                      10, "\xE2\x9F\xBC",            3, 0},
+  {"lsaquo",                           6, "\xE2\x80\xB9",            3, 0},
+  {"oopf",                             4, "\xF0\x9D\x95\xA0",        4, 0},
+  {"langle",                           6, "\xE2\x9F\xA8",            3, 0},
+  {"nis",                              3, "\xE2\x8B\xBC",            3, 0},
+  {"ring",                             4, "\xCB\x9A",                2, 0},
+  {"Lcy",                              3, "\xD0\x9B",                2, 0},
+  {"Lacute",                           6, "\xC4\xB9",                2, 0},
+  {"parsim",                           6, "\xE2\xAB\xB3",            3, 0},
+  {"minusb",                           6, "\xE2\x8A\x9F",            3, 0},
+  {"boxDR",                            5, "\xE2\x95\x94",            3, 0},
+  {"lBarr",                            5, "\xE2\xA4\x8E",            3, 0},
+  {"RightCeiling",                    12, "\xE2\x8C\x89",            3, 0},
+  {"iocy",                             4, "\xD1\x91",                2, 0},
+  {"sqsubseteq",                      10, "\xE2\x8A\x91",            3, 0},
+  {"RightTee",                         8, "\xE2\x8A\xA2",            3, 0},
+  {"nang",                             4, "\xE2\x88\xA0\xE2\x83\x92", 6, 0},
+  {"DoubleLongRightArrow",            20, "\xE2\x9F\xB9",            3, 0},
+  {"NotRightTriangleBar",             19, "\xE2\xA7\x90\xCC\xB8",    5, 0},
+  {"nvlt",                             4, "\x3C\xE2\x83\x92",        4, 0},
+  {"Precedes",                         8, "\xE2\x89\xBA",            3, 0},
+  {"tcedil",                           6, "\xC5\xA3",                2, 0},
+  {"leftthreetimes",                  14, "\xE2\x8B\x8B",            3, 0},
+  {"udblac",                           6, "\xC5\xB1",                2, 0},
+  {"ulcrop",                           6, "\xE2\x8C\x8F",            3, 0},
+  {"squ",                              3, "\xE2\x96\xA1",            3, 0},
+  {"FilledSmallSquare",               17, "\xE2\x97\xBC",            3, 0},
+  {"Jsercy",                           6, "\xD0\x88",                2, 0},
+  {"Delta",                            5, "\xCE\x94",                2, 0},
+  {"supmult",                          7, "\xE2\xAB\x82",            3, 0},
+  {"lbrkslu",                          7, "\xE2\xA6\x8D",            3, 0},
+  {"Umacr",                            5, "\xC5\xAA",                2, 0},
+  {"NotGreaterSlantEqual",            20, "\xE2\xA9\xBE\xCC\xB8",    5, 0},
+  {"NotVerticalBar",                  14, "\xE2\x88\xA4",            3, 0},
+  {"eqvparsl",                         8, "\xE2\xA7\xA5",            3, 0},
+  {"order",                            5, "\xE2\x84\xB4",            3, 0},
+  {"nshortmid",                        9, "\xE2\x88\xA4",            3, 0},
+  {"rHar",                             4, "\xE2\xA5\xA4",            3, 0},
+  {"rbrksld",                          7, "\xE2\xA6\x8E",            3, 0},
+  {"Or",                               2, "\xE2\xA9\x94",            3, 0},
+  {"frac13",                           6, "\xE2\x85\x93",            3, 0},
+  {"brvbar",                           6, "\xC2\xA6",                2, 1},
+  {"omacr",                            5, "\xC5\x8D",                2, 0},
+  {"Rscr",                             4, "\xE2\x84\x9B",            3, 0},
+  {"PrecedesTilde",                   13, "\xE2\x89\xBE",            3, 0},
+  {"olcross",                          7, "\xE2\xA6\xBB",            3, 0},
+  {"racute",                           6, "\xC5\x95",                2, 0},
+  {"npart",                            5, "\xE2\x88\x82\xCC\xB8",    5, 0},
+  {"PlusMinus",                        9, "\xC2\xB1",                2, 0},
+  {"nleftrightarrow",                 15, "\xE2\x86\xAE",            3, 0},
+  {"notin",                            5, "\xE2\x88\x89",            3, 0},
+  {"Iukcy",                            5, "\xD0\x86",                2, 0},
+  {"intercal",                         8, "\xE2\x8A\xBA",            3, 0},
+  {"trie",                             4, "\xE2\x89\x9C",            3, 0},
+  {"zigrarr",                          7, "\xE2\x87\x9D",            3, 0},
+  {"sime",                             4, "\xE2\x89\x83",            3, 0},
+  {"veeeq",                            5, "\xE2\x89\x9A",            3, 0},
+  {"topfork",                          7, "\xE2\xAB\x9A",            3, 0},
+  {"nbump",                            5, "\xE2\x89\x8E\xCC\xB8",    5, 0},
+  {"rtrie",                            5, "\xE2\x8A\xB5",            3, 0},
+  {"Aopf",                             4, "\xF0\x9D\x94\xB8",        4, 0},
+  {"frac34",                           6, "\xC2\xBE",                2, 1},
+  {"gtrless",                          7, "\xE2\x89\xB7",            3, 0},
+  {"Sum",                              3, "\xE2\x88\x91",            3, 0},
+  {"searr",                            5, "\xE2\x86\x98",            3, 0},
+  {"nparallel",                        9, "\xE2\x88\xA6",            3, 0},
+  {"nvrArr",                           6, "\xE2\xA4\x83",            3, 0},
+  {"tstrok",                           6, "\xC5\xA7",                2, 0},
+  {"Itilde",                           6, "\xC4\xA8",                2, 0},
+  {"TildeTilde",                      10, "\xE2\x89\x88",            3, 0},
+  {"lopar",                            5, "\xE2\xA6\x85",            3, 0},
+  {"leftrightsquigarrow",             19, "\xE2\x86\xAD",            3, 0},
+  {"rdquo",                            5, "\xE2\x80\x9D",            3, 0},
+  {"njcy",                             4, "\xD1\x9A",                2, 0},
+  {"npar",                             4, "\xE2\x88\xA6",            3, 0},
+  {"nsupseteq",                        9, "\xE2\x8A\x89",            3, 0},
+  {"kcedil",                           6, "\xC4\xB7",                2, 0},
+  {"scnE",                             4, "\xE2\xAA\xB6",            3, 0},
+  {"ogon",                             4, "\xCB\x9B",                2, 0},
+  {"gne",                              3, "\xE2\xAA\x88",            3, 0},
+  {"gacute",                           6, "\xC7\xB5",                2, 0},
+  {"Scy",                              3, "\xD0\xA1",                2, 0},
+  {"telrec",                           6, "\xE2\x8C\x95",            3, 0},
+  {"rtriltri",                         8, "\xE2\xA7\x8E",            3, 0},
+  {"ne",                               2, "\xE2\x89\xA0",            3, 0},
+  {"rcub",                             4, "\x7D",                    1, 0},
+  {"simplus",                          7, "\xE2\xA8\xA4",            3, 0},
+  {"notni",                            5, "\xE2\x88\x8C",            3, 0},
+  {"intcal",                           6, "\xE2\x8A\xBA",            3, 0},
+  {"rharu",                            5, "\xE2\x87\x80",            3, 0},
+  {"LessEqualGreater",                16, "\xE2\x8B\x9A",            3, 0},
+  {"Dagger",                           6, "\xE2\x80\xA1",            3, 0},
+  {"uscr",                             4, "\xF0\x9D\x93\x8A",        4, 0},
+  {"isindot",                          7, "\xE2\x8B\xB5",            3, 0},
+  {"varpi",                            5, "\xCF\x96",                2, 0},
+  {"cedil",                            5, "\xC2\xB8",                2, 1},
+  {"Tstrok",                           6, "\xC5\xA6",                2, 0},
+  {"Hat",                              3, "\x5E",                    1, 0},
+  {"prec",                             4, "\xE2\x89\xBA",            3, 0},
+  {"backprime",                        9, "\xE2\x80\xB5",            3, 0},
+  {"circlearrowright",                16, "\xE2\x86\xBB",            3, 0},
+  {"bsolhsub",                         8, "\xE2\x9F\x88",            3, 0},
+  {"qint",                             4, "\xE2\xA8\x8C",            3, 0},
+  {"RightVector",                     11, "\xE2\x87\x80",            3, 0},
+  {"vdash",                            5, "\xE2\x8A\xA2",            3, 0},
+  {"NotPrecedesSlantEqual",           21, "\xE2\x8B\xA0",            3, 0},
+  {"becaus",                           6, "\xE2\x88\xB5",            3, 0},
+  {"ForAll",                           6, "\xE2\x88\x80",            3, 0},
+  {"rmoustache",                      10, "\xE2\x8E\xB1",            3, 0},
+  {"boxvL",                            5, "\xE2\x95\xA1",            3, 0},
+  {"realine",                          7, "\xE2\x84\x9B",            3, 0},
+  {"ccaps",                            5, "\xE2\xA9\x8D",            3, 0},
+  {"Atilde",                           6, "\xC3\x83",                2, 1},
+  {"nlE",                              3, "\xE2\x89\xA6\xCC\xB8",    5, 0},
+  {"marker",                           6, "\xE2\x96\xAE",            3, 0},
+  {"gvertneqq",                        9, "\xE2\x89\xA9\xEF\xB8\x80", 6, 0},
+  {"subdot",                           6, "\xE2\xAA\xBD",            3, 0},
+  {"precneqq",                         8, "\xE2\xAA\xB5",            3, 0},
+  {"Sc",                               2, "\xE2\xAA\xBC",            3, 0},
+  {"ii",                               2, "\xE2\x85\x88",            3, 0},
+  {"tscy",                             4, "\xD1\x86",                2, 0},
+  {"subsub",                           6, "\xE2\xAB\x95",            3, 0},
+  {"centerdot",                        9, "\xC2\xB7",                2, 0},
+  {"cudarrr",                          7, "\xE2\xA4\xB5",            3, 0},
+  {"Gcirc",                            5, "\xC4\x9C",                2, 0},
+  {"xdtri",                            5, "\xE2\x96\xBD",            3, 0},
+  {"breve",                            5, "\xCB\x98",                2, 0},
+  {"Tilde",                            5, "\xE2\x88\xBC",            3, 0},
+  {"mDDot",                            5, "\xE2\x88\xBA",            3, 0},
+  {"congdot",                          7, "\xE2\xA9\xAD",            3, 0},
+  {"ominus",                           6, "\xE2\x8A\x96",            3, 0},
+  {"drcrop",                           6, "\xE2\x8C\x8C",            3, 0},
+  {"sccue",                            5, "\xE2\x89\xBD",            3, 0},
+  {"downharpoonleft",                 15, "\xE2\x87\x83",            3, 0},
+  {"ord",                              3, "\xE2\xA9\x9D",            3, 0},
+  {"bumpe",                            5, "\xE2\x89\x8F",            3, 0},
+  {"acute",                            5, "\xC2\xB4",                2, 1},
+  {"slarr",                            5, "\xE2\x86\x90",            3, 0},
+  {"rightarrowtail",                  14, "\xE2\x86\xA3",            3, 0},
+  {"nvrtrie",                          7, "\xE2\x8A\xB5\xE2\x83\x92", 6, 0},
+  {"uuml",                             4, "\xC3\xBC",                2, 1},
+  {"rfloor",                           6, "\xE2\x8C\x8B",            3, 0},
+  {"Aacute",                           6, "\xC3\x81",                2, 1},
+  {"prod",                             4, "\xE2\x88\x8F",            3, 0},
+  {"andslope",                         8, "\xE2\xA9\x98",            3, 0},
+  {"jukcy",                            5, "\xD1\x94",                2, 0},
+  {"KHcy",                             4, "\xD0\xA5",                2, 0},
+  {"LessFullEqual",                   13, "\xE2\x89\xA6",            3, 0},
+  {"esdot",                            5, "\xE2\x89\x90",            3, 0},
+  {"nsub",                             4, "\xE2\x8A\x84",            3, 0},
+  {"dharr",                            5, "\xE2\x87\x82",            3, 0},
+  {"Ncy",                              3, "\xD0\x9D",                2, 0},
+  {"nsmid",                            5, "\xE2\x88\xA4",            3, 0},
+  {"frac56",                           6, "\xE2\x85\x9A",            3, 0},
+  {"zeta",                             4, "\xCE\xB6",                2, 0},
+  {"uHar",                             4, "\xE2\xA5\xA3",            3, 0},
+  {"nless",                            5, "\xE2\x89\xAE",            3, 0},
+  {"xmap",                             4, "\xE2\x9F\xBC",            3, 0},
+  {"bsolb",                            5, "\xE2\xA7\x85",            3, 0},
+  {"Auml",                             4, "\xC3\x84",                2, 1},
+  {"hksearow",                         8, "\xE2\xA4\xA5",            3, 0},
+  {"suphsol",                          7, "\xE2\x9F\x89",            3, 0},
+  {"radic",                            5, "\xE2\x88\x9A",            3, 0},
+  {"triangledown",                    12, "\xE2\x96\xBF",            3, 0},
+  {"lsqb",                             4, "\x5B",                    1, 0},
+  {"models",                           6, "\xE2\x8A\xA7",            3, 0},
+  {"planckh",                          7, "\xE2\x84\x8E",            3, 0},
+  {"Congruent",                        9, "\xE2\x89\xA1",            3, 0},
+  {"hellip",                           6, "\xE2\x80\xA6",            3, 0},
+  {"nldr",                             4, "\xE2\x80\xA5",            3, 0},
+  {"NotLeftTriangle",                 15, "\xE2\x8B\xAA",            3, 0},
+  {"gtdot",                            5, "\xE2\x8B\x97",            3, 0},
+  {"zwj",                              3, "\xE2\x80\x8D",            3, 0},
+  {"LeftArrowBar",                    12, "\xE2\x87\xA4",            3, 0},
+  {"triminus",                         8, "\xE2\xA8\xBA",            3, 0},
+  {"lEg",                              3, "\xE2\xAA\x8B",            3, 0},
+  {"LeftTriangle",                    12, "\xE2\x8A\xB2",            3, 0},
+  {"expectation",                     11, "\xE2\x84\xB0",            3, 0},
+  {"And",                              3, "\xE2\xA9\x93",            3, 0},
+  {"nexist",                           6, "\xE2\x88\x84",            3, 0},
+  {"DiacriticalDot",                  14, "\xCB\x99",                2, 0},
+  {"utrif",                            5, "\xE2\x96\xB4",            3, 0},
+  {"capand",                           6, "\xE2\xA9\x84",            3, 0},
+  {"CenterDot",                        9, "\xC2\xB7",                2, 0},
+  {"setminus",                         8, "\xE2\x88\x96",            3, 0},
+  {"frasl",                            5, "\xE2\x81\x84",            3, 0},
+  {"llcorner",                         8, "\xE2\x8C\x9E",            3, 0},
+  {"LeftDownVector",                  14, "\xE2\x87\x83",            3, 0},
+  {"ExponentialE",                    12, "\xE2\x85\x87",            3, 0},
+  {"curarrm",                          7, "\xE2\xA4\xBC",            3, 0},
+  {"pr",                               2, "\xE2\x89\xBA",            3, 0},
+  {"eg",                               2, "\xE2\xAA\x9A",            3, 0},
+  {"frac16",                           6, "\xE2\x85\x99",            3, 0},
+  {"cfr",                              3, "\xF0\x9D\x94\xA0",        4, 0},
+  {"hercon",                           6, "\xE2\x8A\xB9",            3, 0},
+  {"Ecirc",                            5, "\xC3\x8A",                2, 1},
+  {"iff",                              3, "\xE2\x87\x94",            3, 0},
+  {"nap",                              3, "\xE2\x89\x89",            3, 0},
+  {"subsetneqq",                      10, "\xE2\xAB\x8B",            3, 0},
+  {"sup1",                             4, "\xC2\xB9",                2, 1},
+  {"mho",                              3, "\xE2\x84\xA7",            3, 0},
+  {"awconint",                         8, "\xE2\x88\xB3",            3, 0},
+  {"simgE",                            5, "\xE2\xAA\xA0",            3, 0},
+  {"llhard",                           6, "\xE2\xA5\xAB",            3, 0},
+  {"preceq",                           6, "\xE2\xAA\xAF",            3, 0},
+  {"bull",                             4, "\xE2\x80\xA2",            3, 0},
+  {"tritime",                          7, "\xE2\xA8\xBB",            3, 0},
+  {"UpEquilibrium",                   13, "\xE2\xA5\xAE",            3, 0},
+  {"succnsim",                         8, "\xE2\x8B\xA9",            3, 0},
+  {"scE",                              3, "\xE2\xAA\xB4",            3, 0},
+  {"cscr",                             4, "\xF0\x9D\x92\xB8",        4, 0},
+  {"tprime",                           6, "\xE2\x80\xB4",            3, 0},
+  {"omid",                             4, "\xE2\xA6\xB6",            3, 0},
+  {"acirc",                            5, "\xC3\xA2",                2, 1},
+  {"OverBracket",                     11, "\xE2\x8E\xB4",            3, 0},
+  {"ordm",                             4, "\xC2\xBA",                2, 1},
+  {"NotSubset",                        9, "\xE2\x8A\x82\xE2\x83\x92", 6, 0},
+  {"xodot",                            5, "\xE2\xA8\x80",            3, 0},
+  {"Xfr",                              3, "\xF0\x9D\x94\x9B",        4, 0},
+  {"napE",                             4, "\xE2\xA9\xB0\xCC\xB8",    5, 0},
+  {"lsh",                              3, "\xE2\x86\xB0",            3, 0},
+  {"ycy",                              3, "\xD1\x8B",                2, 0},
+  {"male",                             4, "\xE2\x99\x82",            3, 0},
+  {"Star",                             4, "\xE2\x8B\x86",            3, 0},
+  {"subnE",                            5, "\xE2\xAB\x8B",            3, 0},
+  {"iukcy",                            5, "\xD1\x96",                2, 0},
+  {"thorn",                            5, "\xC3\xBE",                2, 1},
+  {"NotSquareSubsetEqual",            20, "\xE2\x8B\xA2",            3, 0},
+  {"timesb",                           6, "\xE2\x8A\xA0",            3, 0},
+  {"tshcy",                            5, "\xD1\x9B",                2, 0},
+  {"Tcedil",                           6, "\xC5\xA2",                2, 0},
+  {"twoheadleftarrow",                16, "\xE2\x86\x9E",            3, 0},
+  {"LeftArrow",                        9, "\xE2\x86\x90",            3, 0},
+  {"DownTee",                          7, "\xE2\x8A\xA4",            3, 0},
+  {"LessGreater",                     11, "\xE2\x89\xB6",            3, 0},
+  {"supplus",                          7, "\xE2\xAB\x80",            3, 0},
+  {"female",                           6, "\xE2\x99\x80",            3, 0},
+  {"lowbar",                           6, "\x5F",                    1, 0},
+  {"notindot",                         8, "\xE2\x8B\xB5\xCC\xB8",    5, 0},
+  {"gtlPar",                           6, "\xE2\xA6\x95",            3, 0},
+  {"Gbreve",                           6, "\xC4\x9E",                2, 0},
+  {"caret",                            5, "\xE2\x81\x81",            3, 0},
+  {"LowerLeftArrow",                  14, "\xE2\x86\x99",            3, 0},
+  {"Omega",                            5, "\xCE\xA9",                2, 0},
+  {"Colone",                           6, "\xE2\xA9\xB4",            3, 0},
+  {"Element",                          7, "\xE2\x88\x88",            3, 0},
+  {"lHar",                             4, "\xE2\xA5\xA2",            3, 0},
+  {"nge",                              3, "\xE2\x89\xB1",            3, 0},
+  {"nsupseteqq",                      10, "\xE2\xAB\x86\xCC\xB8",    5, 0},
+  {"rang",                             4, "\xE2\x9F\xA9",            3, 0},
+  {"robrk",                            5, "\xE2\x9F\xA7",            3, 0},
+  {"angmsdaf",                         8, "\xE2\xA6\xAD",            3, 0},
+  {"rAtail",                           6, "\xE2\xA4\x9C",            3, 0},
+  {"icy",                              3, "\xD0\xB8",                2, 0},
+  {"supe",                             4, "\xE2\x8A\x87",            3, 0},
+  {"ltcc",                             4, "\xE2\xAA\xA6",            3, 0},
+  {"ntlg",                             4, "\xE2\x89\xB8",            3, 0},
+  {"nleftarrow",                      10, "\xE2\x86\x9A",            3, 0},
+  {"lates",                            5, "\xE2\xAA\xAD\xEF\xB8\x80", 6, 0},
+  {"ssetmn",                           6, "\xE2\x88\x96",            3, 0},
+  {"cap",                              3, "\xE2\x88\xA9",            3, 0},
+  {"rcy",                              3, "\xD1\x80",                2, 0},
+  {"scap",                             4, "\xE2\xAA\xB8",            3, 0},
+  {"andand",                           6, "\xE2\xA9\x95",            3, 0},
+  {"boxVH",                            5, "\xE2\x95\xAC",            3, 0},
+  {"wedgeq",                           6, "\xE2\x89\x99",            3, 0},
+  {"NotGreater",                      10, "\xE2\x89\xAF",            3, 0},
+  {"ouml",                             4, "\xC3\xB6",                2, 1},
+  {"ratio",                            5, "\xE2\x88\xB6",            3, 0},
+  {"gg",                               2, "\xE2\x89\xAB",            3, 0},
+  {"dzcy",                             4, "\xD1\x9F",                2, 0},
+  {"npolint",                          7, "\xE2\xA8\x94",            3, 0},
+  {"plusacir",                         8, "\xE2\xA8\xA3",            3, 0},
+  {"sqsub",                            5, "\xE2\x8A\x8F",            3, 0},
+  {"nvgt",                             4, "\x3E\xE2\x83\x92",        4, 0},
+  {"NotTilde",                         8, "\xE2\x89\x81",            3, 0},
+  {"notinva",                          7, "\xE2\x88\x89",            3, 0},
+  {"RightTriangleEqual",              18, "\xE2\x8A\xB5",            3, 0},
+  {"exponentiale",                    12, "\xE2\x85\x87",            3, 0},
+  {"gesl",                             4, "\xE2\x8B\x9B\xEF\xB8\x80", 6, 0},
+  {"qopf",                             4, "\xF0\x9D\x95\xA2",        4, 0},
+  {"lesdot",                           6, "\xE2\xA9\xBF",            3, 0},
+  {"Ufr",                              3, "\xF0\x9D\x94\x98",        4, 0},
+  {"rbbrk",                            5, "\xE2\x9D\xB3",            3, 0},
+  {"NotHumpEqual",                    12, "\xE2\x89\x8F\xCC\xB8",    5, 0},
+  {"Ccirc",                            5, "\xC4\x88",                2, 0},
+  {"NotRightTriangleEqual",           21, "\xE2\x8B\xAD",            3, 0},
+  {"ngeqslant",                        9, "\xE2\xA9\xBE\xCC\xB8",    5, 0},
+  {"thetasym",                         8, "\xCF\x91",                2, 0},
+  {"isins",                            5, "\xE2\x8B\xB4",            3, 0},
+  {"plussim",                          7, "\xE2\xA8\xA6",            3, 0},
+  {"VDash",                            5, "\xE2\x8A\xAB",            3, 0},
+  {"rotimes",                          7, "\xE2\xA8\xB5",            3, 0},
+  {"ohm",                              3, "\xCE\xA9",                2, 0},
+  {"boxUL",                            5, "\xE2\x95\x9D",            3, 0},
+  {"nacute",                           6, "\xC5\x84",                2, 0},
+  {"Re",                               2, "\xE2\x84\x9C",            3, 0},
+  {"conint",                           6, "\xE2\x88\xAE",            3, 0},
+  {"precnsim",                         8, "\xE2\x8B\xA8",            3, 0},
+  {"race",                             4, "\xE2\x88\xBD\xCC\xB1",    5, 0},
+  {"odiv",                             4, "\xE2\xA8\xB8",            3, 0},
+  {"eDot",                             4, "\xE2\x89\x91",            3, 0},
+  {"Ocy",                              3, "\xD0\x9E",                2, 0},
+  {"Iogon",                            5, "\xC4\xAE",                2, 0},
+  {"nvinfin",                          7, "\xE2\xA7\x9E",            3, 0},
+  {"supedot",                          7, "\xE2\xAB\x84",            3, 0},
+  {"setmn",                            5, "\xE2\x88\x96",            3, 0},
+  {"epsilon",                          7, "\xCE\xB5",                2, 0},
+  {"swArr",                            5, "\xE2\x87\x99",            3, 0},
+  {"boxdr",                            5, "\xE2\x94\x8C",            3, 0},
+  {"nharr",                            5, "\xE2\x86\xAE",            3, 0},
+  {"prnE",                             4, "\xE2\xAA\xB5",            3, 0},
+  {"Aogon",                            5, "\xC4\x84",                2, 0},
+  {"orslope",                          7, "\xE2\xA9\x97",            3, 0},
+  {"fllig",                            5, "\xEF\xAC\x82",            3, 0},
+  {"cdot",                             4, "\xC4\x8B",                2, 0},
+  {"vert",                             4, "\x7C",                    1, 0},
+  {"minusdu",                          7, "\xE2\xA8\xAA",            3, 0},
+  {"DownRightTeeVector",              18, "\xE2\xA5\x9F",            3, 0},
+  {"npr",                              3, "\xE2\x8A\x80",            3, 0},
+  {"Square",                           6, "\xE2\x96\xA1",            3, 0},
+  {"cupbrcap",                         8, "\xE2\xA9\x88",            3, 0},
+  {"fcy",                              3, "\xD1\x84",                2, 0},
+  {"RightDoubleBracket",              18, "\xE2\x9F\xA7",            3, 0},
+  {"KJcy",                             4, "\xD0\x8C",                2, 0},
+  {"ClockwiseContourIntegral",        24, "\xE2\x88\xB2",            3, 0},
+  {"nsupE",                            5, "\xE2\xAB\x86\xCC\xB8",    5, 0},
+  {"top",                              3, "\xE2\x8A\xA4",            3, 0},
+  {"laemptyv",                         8, "\xE2\xA6\xB4",            3, 0},
+  {"DownArrow",                        9, "\xE2\x86\x93",            3, 0},
+  {"boxvR",                            5, "\xE2\x95\x9E",            3, 0},
+  {"sdot",                             4, "\xE2\x8B\x85",            3, 0},
+  {"boxvh",                            5, "\xE2\x94\xBC",            3, 0},
+  {"or",                               2, "\xE2\x88\xA8",            3, 0},
+  {"GreaterGreater",                  14, "\xE2\xAA\xA2",            3, 0},
+  {"duarr",                            5, "\xE2\x87\xB5",            3, 0},
+  {"eqcirc",                           6, "\xE2\x89\x96",            3, 0},
+  {"boxVr",                            5, "\xE2\x95\x9F",            3, 0},
+  {"DownTeeArrow",                    12, "\xE2\x86\xA7",            3, 0},
+  {"nrtri",                            5, "\xE2\x8B\xAB",            3, 0},
+  {"perp",                             4, "\xE2\x8A\xA5",            3, 0},
+  {"maltese",                          7, "\xE2\x9C\xA0",            3, 0},
+  {"lessapprox",                      10, "\xE2\xAA\x85",            3, 0},
+  {"Jscr",                             4, "\xF0\x9D\x92\xA5",        4, 0},
+  {"smid",                             4, "\xE2\x88\xA3",            3, 0},
+  {"nhArr",                            5, "\xE2\x87\x8E",            3, 0},
+  {"larrbfs",                          7, "\xE2\xA4\x9F",            3, 0},
+  {"wopf",                             4, "\xF0\x9D\x95\xA8",        4, 0},
+  {"sqcup",                            5, "\xE2\x8A\x94",            3, 0},
+  {"nsubE",                            5, "\xE2\xAB\x85\xCC\xB8",    5, 0},
+  {"downarrow",                        9, "\xE2\x86\x93",            3, 0},
+  {"iecy",                             4, "\xD0\xB5",                2, 0},
+  {"nearr",                            5, "\xE2\x86\x97",            3, 0},
+  {"ntilde",                           6, "\xC3\xB1",                2, 1},
+  {"dtri",                             4, "\xE2\x96\xBF",            3, 0},
+  {"ocir",                             4, "\xE2\x8A\x9A",            3, 0},
+  {"bfr",                              3, "\xF0\x9D\x94\x9F",        4, 0},
+  {"Lmidot",                           6, "\xC4\xBF",                2, 0},
+  {"DiacriticalDoubleAcute",          22, "\xCB\x9D",                2, 0},
+  {"UnderBracket",                    12, "\xE2\x8E\xB5",            3, 0},
+  {"ifr",                              3, "\xF0\x9D\x94\xA6",        4, 0},
+  {"roarr",                            5, "\xE2\x87\xBE",            3, 0},
+  {"Idot",                             4, "\xC4\xB0",                2, 0},
+  {"GreaterEqualLess",                16, "\xE2\x8B\x9B",            3, 0},
+  {"RightArrow",                      10, "\xE2\x86\x92",            3, 0},
+  {"srarr",                            5, "\xE2\x86\x92",            3, 0},
+  {"sext",                             4, "\xE2\x9C\xB6",            3, 0},
+  {"cupcap",                           6, "\xE2\xA9\x86",            3, 0},
+  {"NotReverseElement",               17, "\xE2\x88\x8C",            3, 0},
+  {"ntriangleright",                  14, "\xE2\x8B\xAB",            3, 0},
+  {"gtcc",                             4, "\xE2\xAA\xA7",            3, 0},
+  {"rbrack",                           6, "\x5D",                    1, 0},
+  {"leg",                              3, "\xE2\x8B\x9A",            3, 0},
+  {"Larr",                             4, "\xE2\x86\x9E",            3, 0},
+  {"Rang",                             4, "\xE2\x9F\xAB",            3, 0},
+  {"Exists",                           6, "\xE2\x88\x83",            3, 0},
+  {"npre",                             4, "\xE2\xAA\xAF\xCC\xB8",    5, 0},
+  {"boxVR",                            5, "\xE2\x95\xA0",            3, 0},
+  {"supsim",                           6, "\xE2\xAB\x88",            3, 0},
+  {"Not",                              3, "\xE2\xAB\xAC",            3, 0},
+  {"ecir",                             4, "\xE2\x89\x96",            3, 0},
+  {"angmsd",                           6, "\xE2\x88\xA1",            3, 0},
+  {"smte",                             4, "\xE2\xAA\xAC",            3, 0},
+  {"range",                            5, "\xE2\xA6\xA5",            3, 0},
+  {"rbrace",                           6, "\x7D",                    1, 0},
+  {"leftarrowtail",                   13, "\xE2\x86\xA2",            3, 0},
+  {"iota",                             4, "\xCE\xB9",                2, 0},
+  {"larrpl",                           6, "\xE2\xA4\xB9",            3, 0},
+  {"kappa",                            5, "\xCE\xBA",                2, 0},
+  {"nlarr",                            5, "\xE2\x86\x9A",            3, 0},
+  {"gesdot",                           6, "\xE2\xAA\x80",            3, 0},
+  {"iuml",                             4, "\xC3\xAF",                2, 1},
+  {"NotSucceedsSlantEqual",           21, "\xE2\x8B\xA1",            3, 0},
+  {"DoubleLeftRightArrow",            20, "\xE2\x87\x94",            3, 0},
+  {"rlm",                              3, "\xE2\x80\x8F",            3, 0},
+  {"midcir",                           6, "\xE2\xAB\xB0",            3, 0},
+  {"emsp13",                           6, "\xE2\x80\x84",            3, 0},
+  {"dopf",                             4, "\xF0\x9D\x95\x95",        4, 0},
+  {"Pscr",                             4, "\xF0\x9D\x92\xAB",        4, 0},
+  {"zcy",                              3, "\xD0\xB7",                2, 0},
+  {"xlarr",                            5, "\xE2\x9F\xB5",            3, 0},
+  {"Eopf",                             4, "\xF0\x9D\x94\xBC",        4, 0},
+  {"ngsim",                            5, "\xE2\x89\xB5",            3, 0},
+  {"sce",                              3, "\xE2\xAA\xB0",            3, 0},
+  {"ngE",                              3, "\xE2\x89\xA7\xCC\xB8",    5, 0},
+  {"Ccaron",                           6, "\xC4\x8C",                2, 0},
+  {"veebar",                           6, "\xE2\x8A\xBB",            3, 0},
+  {"dblac",                            5, "\xCB\x9D",                2, 0},
+  {"gl",                               2, "\xE2\x89\xB7",            3, 0},
+  {"simrarr",                          7, "\xE2\xA5\xB2",            3, 0},
+  {"andv",                             4, "\xE2\xA9\x9A",            3, 0},
+  {"Because",                          7, "\xE2\x88\xB5",            3, 0},
+  {"mldr",                             4, "\xE2\x80\xA6",            3, 0},
+  {"NotSucceedsTilde",                16, "\xE2\x89\xBF\xCC\xB8",    5, 0},
+  {"trade",                            5, "\xE2\x84\xA2",            3, 0},
+  {"hscr",                             4, "\xF0\x9D\x92\xBD",        4, 0},
+  {"jfr",                              3, "\xF0\x9D\x94\xA7",        4, 0},
+  {"LeftUpVector",                    12, "\xE2\x86\xBF",            3, 0},
+  {"ruluhar",                          7, "\xE2\xA5\xA8",            3, 0},
+  {"zfr",                              3, "\xF0\x9D\x94\xB7",        4, 0},
+  {"uring",                            5, "\xC5\xAF",                2, 0},
+  {"DoubleUpArrow",                   13, "\xE2\x87\x91",            3, 0},
+  {"ecy",                              3, "\xD1\x8D",                2, 0},
+  {"wreath",                           6, "\xE2\x89\x80",            3, 0},
+  {"mlcp",                             4, "\xE2\xAB\x9B",            3, 0},
+  {"Wfr",                              3, "\xF0\x9D\x94\x9A",        4, 0},
+  {"notinvb",                          7, "\xE2\x8B\xB7",            3, 0},
+  {"sum",                              3, "\xE2\x88\x91",            3, 0},
+  {"lceil",                            5, "\xE2\x8C\x88",            3, 0},
+  {"micro",                            5, "\xC2\xB5",                2, 1},
+  {"Gamma",                            5, "\xCE\x93",                2, 0},
+  {"lstrok",                           6, "\xC5\x82",                2, 0},
+  {"dash",                             4, "\xE2\x80\x90",            3, 0},
+  {"ycirc",                            5, "\xC5\xB7",                2, 0},
+  {"Lcaron",                           6, "\xC4\xBD",                2, 0},
+  {"doteq",                            5, "\xE2\x89\x90",            3, 0},
+  {"lbrksld",                          7, "\xE2\xA6\x8F",            3, 0},
+  {"minusd",                           6, "\xE2\x88\xB8",            3, 0},
+  {"ocirc",                            5, "\xC3\xB4",                2, 1},
+  {"boxvH",                            5, "\xE2\x95\xAA",            3, 0},
+  {"Icy",                              3, "\xD0\x98",                2, 0},
+  {"parsl",                            5, "\xE2\xAB\xBD",            3, 0},
+  {"VerticalLine",                    12, "\x7C",                    1, 0},
+  {"zhcy",                             4, "\xD0\xB6",                2, 0},
+  {"Gcy",                              3, "\xD0\x93",                2, 0},
+  {"Cedilla",                          7, "\xC2\xB8",                2, 0},
+  {"boxVL",                            5, "\xE2\x95\xA3",            3, 0},
+  {"OpenCurlyDoubleQuote",            20, "\xE2\x80\x9C",            3, 0},
+  {"varnothing",                      10, "\xE2\x88\x85",            3, 0},
+  {"ap",                               2, "\xE2\x89\x88",            3, 0},
+  {"bigtriangledown",                 15, "\xE2\x96\xBD",            3, 0},
+  {"imagline",                         8, "\xE2\x84\x90",            3, 0},
+  {"exist",                            5, "\xE2\x88\x83",            3, 0},
+  {"midast",                           6, "\x2A",                    1, 0},
+  {"Updownarrow",                     11, "\xE2\x87\x95",            3, 0},
+  {"rmoust",                           6, "\xE2\x8E\xB1",            3, 0},
+  {"LeftTee",                          7, "\xE2\x8A\xA3",            3, 0},
+  {"dot",                              3, "\xCB\x99",                2, 0},
+  {"neArr",                            5, "\xE2\x87\x97",            3, 0},
+  {"nGg",                              3, "\xE2\x8B\x99\xCC\xB8",    5, 0},
+  {"Lambda",                           6, "\xCE\x9B",                2, 0},
+  {"ecirc",                            5, "\xC3\xAA",                2, 1},
+  {"ldquo",                            5, "\xE2\x80\x9C",            3, 0},
+  {"TScy",                             4, "\xD0\xA6",                2, 0},
+  {"asymp",                            5, "\xE2\x89\x88",            3, 0},
+  {"tau",                              3, "\xCF\x84",                2, 0},
+  {"lesssim",                          7, "\xE2\x89\xB2",            3, 0},
+  {"lscr",                             4, "\xF0\x9D\x93\x81",        4, 0},
+  {"lambda",                           6, "\xCE\xBB",                2, 0},
+  {"puncsp",                           6, "\xE2\x80\x88",            3, 0},
+  {"Uacute",                           6, "\xC3\x9A",                2, 1},
+  {"rlhar",                            5, "\xE2\x87\x8C",            3, 0},
+  {"NotSuperset",                     11, "\xE2\x8A\x83\xE2\x83\x92", 6, 0},
+  {"geqslant",                         8, "\xE2\xA9\xBE",            3, 0},
+  {"Eta",                              3, "\xCE\x97",                2, 0},
+  {"dstrok",                           6, "\xC4\x91",                2, 0},
+  {"simdot",                           6, "\xE2\xA9\xAA",            3, 0},
+  {"SHCHcy",                           6, "\xD0\xA9",                2, 0},
+  {"spades",                           6, "\xE2\x99\xA0",            3, 0},
+  {"CloseCurlyDoubleQuote",           21, "\xE2\x80\x9D",            3, 0},
+  {"geqq",                             4, "\xE2\x89\xA7",            3, 0},
+  {"Abreve",                           6, "\xC4\x82",                2, 0},
+  {"ufr",                              3, "\xF0\x9D\x94\xB2",        4, 0},
+  {"lfr",                              3, "\xF0\x9D\x94\xA9",        4, 0},
+  {"sfr",                              3, "\xF0\x9D\x94\xB0",        4, 0},
+  {"boxh",                             4, "\xE2\x94\x80",            3, 0},
+  {"rangd",                            5, "\xE2\xA6\x92",            3, 0},
+  {"Sfr",                              3, "\xF0\x9D\x94\x96",        4, 0},
+  {"angrt",                            5, "\xE2\x88\x9F",            3, 0},
+  {"dcaron",                           6, "\xC4\x8F",                2, 0},
+  {"Ffr",                              3, "\xF0\x9D\x94\x89",        4, 0},
+  {"nvle",                             4, "\xE2\x89\xA4\xE2\x83\x92", 6, 0},
+  {"bigtriangleup",                   13, "\xE2\x96\xB3",            3, 0},
+  {"CirclePlus",                      10, "\xE2\x8A\x95",            3, 0},
+  {"napid",                            5, "\xE2\x89\x8B\xCC\xB8",    5, 0},
+  {"yuml",                             4, "\xC3\xBF",                2, 1},
+  {"forkv",                            5, "\xE2\xAB\x99",            3, 0},
+  {"yfr",                              3, "\xF0\x9D\x94\xB6",        4, 0},
+  {"LessTilde",                        9, "\xE2\x89\xB2",            3, 0},
+  {"strns",                            5, "\xC2\xAF",                2, 0},
+  {"NotSquareSuperset",               17, "\xE2\x8A\x90\xCC\xB8",    5, 0},
+  {"nearrow",                          7, "\xE2\x86\x97",            3, 0},
+  {"THORN",                            5, "\xC3\x9E",                2, 1},
+  {"Pr",                               2, "\xE2\xAA\xBB",            3, 0},
+  {"jscr",                             4, "\xF0\x9D\x92\xBF",        4, 0},
+  {"fpartint",                         8, "\xE2\xA8\x8D",            3, 0},
+  {"upsih",                            5, "\xCF\x92",                2, 0},
+  {"Diamond",                          7, "\xE2\x8B\x84",            3, 0},
+  {"eqslantless",                     11, "\xE2\xAA\x95",            3, 0},
+  {"urcorner",                         8, "\xE2\x8C\x9D",            3, 0},
+  {"TripleDot",                        9, "\xE2\x83\x9B",            3, 0},
+  {"ultri",                            5, "\xE2\x97\xB8",            3, 0},
+  {"NotSquareSubset",                 15, "\xE2\x8A\x8F\xCC\xB8",    5, 0},
+  {"pscr",                             4, "\xF0\x9D\x93\x85",        4, 0},
+  {"cupcup",                           6, "\xE2\xA9\x8A",            3, 0},
+  {"there4",                           6, "\xE2\x88\xB4",            3, 0},
+  {"LessLess",                         8, "\xE2\xAA\xA1",            3, 0},
+  {"downharpoonright",                16, "\xE2\x87\x82",            3, 0},
+  {"gtquest",                          7, "\xE2\xA9\xBC",            3, 0},
+  {"Iopf",                             4, "\xF0\x9D\x95\x80",        4, 0},
+  {"larrfs",                           6, "\xE2\xA4\x9D",            3, 0},
+  {"vellip",                           6, "\xE2\x8B\xAE",            3, 0},
+  {"ggg",                              3, "\xE2\x8B\x99",            3, 0},
+  {"simne",                            5, "\xE2\x89\x86",            3, 0},
+  {"DownRightVectorBar",              18, "\xE2\xA5\x97",            3, 0},
+  {"ReverseEquilibrium",              18, "\xE2\x87\x8B",            3, 0},
+  {"rarrsim",                          7, "\xE2\xA5\xB4",            3, 0},
+  {"sube",                             4, "\xE2\x8A\x86",            3, 0},
+  {"SucceedsTilde",                   13, "\xE2\x89\xBF",            3, 0},
+  {"leftrightarrow",                  14, "\xE2\x86\x94",            3, 0},
+  {"sqsup",                            5, "\xE2\x8A\x90",            3, 0},
+  {"Gg",                               2, "\xE2\x8B\x99",            3, 0},
+  {"natural",                          7, "\xE2\x99\xAE",            3, 0},
+  {"kscr",                             4, "\xF0\x9D\x93\x80",        4, 0},
+  {"cupor",                            5, "\xE2\xA9\x85",            3, 0},
+  {"toea",                             4, "\xE2\xA4\xA8",            3, 0},
+  {"hamilt",                           6, "\xE2\x84\x8B",            3, 0},
+  {"dotsquare",                        9, "\xE2\x8A\xA1",            3, 0},
+  {"Eacute",                           6, "\xC3\x89",                2, 1},
+  {"rarrc",                            5, "\xE2\xA4\xB3",            3, 0},
+  {"dtdot",                            5, "\xE2\x8B\xB1",            3, 0},
+  {"kgreen",                           6, "\xC4\xB8",                2, 0},
+  {"hstrok",                           6, "\xC4\xA7",                2, 0},
+  {"yicy",                             4, "\xD1\x97",                2, 0},
+  {"bumpE",                            5, "\xE2\xAA\xAE",            3, 0},
+  {"Ocirc",                            5, "\xC3\x94",                2, 1},
+  {"nsqsupe",                          7, "\xE2\x8B\xA3",            3, 0},
+  {"rnmid",                            5, "\xE2\xAB\xAE",            3, 0},
+  {"bot",                              3, "\xE2\x8A\xA5",            3, 0},
+  {"rightleftharpoons",               17, "\xE2\x87\x8C",            3, 0},
+  {"Ecy",                              3, "\xD0\xAD",                2, 0},
+  {"gsim",                             4, "\xE2\x89\xB3",            3, 0},
+  {"bepsi",                            5, "\xCF\xB6",                2, 0},
+  {"vBarv",                            5, "\xE2\xAB\xA9",            3, 0},
+  {"NotDoubleVerticalBar",            20, "\xE2\x88\xA6",            3, 0},
+  {"shortparallel",                   13, "\xE2\x88\xA5",            3, 0},
+  {"nlsim",                            5, "\xE2\x89\xB4",            3, 0},
+  {"xlArr",                            5, "\xE2\x9F\xB8",            3, 0},
+  {"pertenk",                          7, "\xE2\x80\xB1",            3, 0},
+  {"LT",                               2, "\x3C",                    1, 1},
+  {"Wedge",                            5, "\xE2\x8B\x80",            3, 0},
+  {"commat",                           6, "\x40",                    1, 0},
+  {"gvnE",                             4, "\xE2\x89\xA9\xEF\xB8\x80", 6, 0},
+  {"Rfr",                              3, "\xE2\x84\x9C",            3, 0},
+  {"infintie",                         8, "\xE2\xA7\x9D",            3, 0},
+  {"semi",                             4, "\x3B",                    1, 0},
+  {"Laplacetrf",                      10, "\xE2\x84\x92",            3, 0},
+  {"lnapprox",                         8, "\xE2\xAA\x89",            3, 0},
+  {"NotGreaterLess",                  14, "\xE2\x89\xB9",            3, 0},
+  {"nsubseteq",                        9, "\xE2\x8A\x88",            3, 0},
+  {"lharul",                           6, "\xE2\xA5\xAA",            3, 0},
+  {"NotCongruent",                    12, "\xE2\x89\xA2",            3, 0},
+  {"Rrightarrow",                     11, "\xE2\x87\x9B",            3, 0},
+  {"die",                              3, "\xC2\xA8",                2, 0},
+  {"iquest",                           6, "\xC2\xBF",                2, 1},
+  {"UnderBar",                         8, "\x5F",                    1, 0},
+  {"bsol",                             4, "\x5C",                    1, 0},
+  {"NotElement",                      10, "\xE2\x88\x89",            3, 0},
+  {"frac18",                           6, "\xE2\x85\x9B",            3, 0},
+  {"dharl",                            5, "\xE2\x87\x83",            3, 0},
+  {"odot",                             4, "\xE2\x8A\x99",            3, 0},
+  {"frac38",                           6, "\xE2\x85\x9C",            3, 0},
+  {"not",                              3, "\xC2\xAC",                2, 1},
+  {"lrtri",                            5, "\xE2\x8A\xBF",            3, 0},
+  {"TildeEqual",                      10, "\xE2\x89\x83",            3, 0},
+  {"csup",                             4, "\xE2\xAB\x90",            3, 0},
+  {"copf",                             4, "\xF0\x9D\x95\x94",        4, 0},
+  {"upharpoonleft",                   13, "\xE2\x86\xBF",            3, 0},
+  {"gesdoto",                          7, "\xE2\xAA\x82",            3, 0},
+  {"varsupsetneq",                    12, "\xE2\x8A\x8B\xEF\xB8\x80", 6, 0},
+  {"supdsub",                          7, "\xE2\xAB\x98",            3, 0},
+  {"Bumpeq",                           6, "\xE2\x89\x8E",            3, 0},
+  {"bdquo",                            5, "\xE2\x80\x9E",            3, 0},
+  {"gjcy",                             4, "\xD1\x93",                2, 0},
+  {"bnequiv",                          7, "\xE2\x89\xA1\xE2\x83\xA5", 6, 0},
+  {"leqq",                             4, "\xE2\x89\xA6",            3, 0},
+  {"ldsh",                             4, "\xE2\x86\xB2",            3, 0},
+  {"dlcrop",                           6, "\xE2\x8C\x8D",            3, 0},
+  {"lne",                              3, "\xE2\xAA\x87",            3, 0},
+  {"num",                              3, "\x23",                    1, 0},
+  {"DScy",                             4, "\xD0\x85",                2, 0},
+  {"nrarrc",                           6, "\xE2\xA4\xB3\xCC\xB8",    5, 0},
+  {"gnapprox",                         8, "\xE2\xAA\x8A",            3, 0},
+  {"rfr",                              3, "\xF0\x9D\x94\xAF",        4, 0},
+  {"nparsl",                           6, "\xE2\xAB\xBD\xE2\x83\xA5", 6, 0},
+  {"rpar",                             4, "\x29",                    1, 0},
+  {"LeftRightVector",                 15, "\xE2\xA5\x8E",            3, 0},
+  {"malt",                             4, "\xE2\x9C\xA0",            3, 0},
+  {"solbar",                           6, "\xE2\x8C\xBF",            3, 0},
+  {"Kcedil",                           6, "\xC4\xB6",                2, 0},
+  {"edot",                             4, "\xC4\x97",                2, 0},
+  {"boxHU",                            5, "\xE2\x95\xA9",            3, 0},
+  {"lcub",                             4, "\x7B",                    1, 0},
+  {"subseteqq",                        9, "\xE2\xAB\x85",            3, 0},
+  {"ofcir",                            5, "\xE2\xA6\xBF",            3, 0},
+  {"Cayleys",                          7, "\xE2\x84\xAD",            3, 0},
+  {"nequiv",                           6, "\xE2\x89\xA2",            3, 0},
+  {"Cfr",                              3, "\xE2\x84\xAD",            3, 0},
+  {"ncy",                              3, "\xD0\xBD",                2, 0},
+  {"suplarr",                          7, "\xE2\xA5\xBB",            3, 0},
+  {"triangleright",                   13, "\xE2\x96\xB9",            3, 0},
+  {"boxDL",                            5, "\xE2\x95\x97",            3, 0},
+  {"supdot",                           6, "\xE2\xAA\xBE",            3, 0},
+  {"Uparrow",                          7, "\xE2\x87\x91",            3, 0},
+  {"timesd",                           6, "\xE2\xA8\xB0",            3, 0},
+  {"diamond",                          7, "\xE2\x8B\x84",            3, 0},
+  {"ltquest",                          7, "\xE2\xA9\xBB",            3, 0},
+  {"barwed",                           6, "\xE2\x8C\x85",            3, 0},
+  {"triplus",                          7, "\xE2\xA8\xB9",            3, 0},
+  {"kfr",                              3, "\xF0\x9D\x94\xA8",        4, 0},
+  {"otimesas",                         8, "\xE2\xA8\xB6",            3, 0},
+  {"niv",                              3, "\xE2\x88\x8B",            3, 0},
+  {"xutri",                            5, "\xE2\x96\xB3",            3, 0},
+  {"sol",                              3, "\x2F",                    1, 0},
+  {"gnap",                             4, "\xE2\xAA\x8A",            3, 0},
+  {"percnt",                           6, "\x25",                    1, 0},
+  {"rect",                             4, "\xE2\x96\xAD",            3, 0},
+  {"notinE",                           6, "\xE2\x8B\xB9\xCC\xB8",    5, 0},
+  {"Ofr",                              3, "\xF0\x9D\x94\x92",        4, 0},
+  {"MinusPlus",                        9, "\xE2\x88\x93",            3, 0},
+  {"ovbar",                            5, "\xE2\x8C\xBD",            3, 0},
+  {"mdash",                            5, "\xE2\x80\x94",            3, 0},
+  {"Hfr",                              3, "\xE2\x84\x8C",            3, 0},
+  {"questeq",                          7, "\xE2\x89\x9F",            3, 0},
+  {"Vbar",                             4, "\xE2\xAB\xAB",            3, 0},
+  {"excl",                             4, "\x21",                    1, 0},
+  {"gsime",                            5, "\xE2\xAA\x8E",            3, 0},
+  {"ddotseq",                          7, "\xE2\xA9\xB7",            3, 0},
+  {"gt",                               2, "\x3E",                    1, 1},
+  {"varkappa",                         8, "\xCF\xB0",                2, 0},
+  {"bnot",                             4, "\xE2\x8C\x90",            3, 0},
+  {"diams",                            5, "\xE2\x99\xA6",            3, 0},
+  {"vzigzag",                          7, "\xE2\xA6\x9A",            3, 0},
+  {"Subset",                           6, "\xE2\x8B\x90",            3, 0},
+  {"biguplus",                         8, "\xE2\xA8\x84",            3, 0},
+  {"nscr",                             4, "\xF0\x9D\x93\x83",        4, 0},
+  {"otimes",                           6, "\xE2\x8A\x97",            3, 0},
+  {"filig",                            5, "\xEF\xAC\x81",            3, 0},
+  {"succsim",                          7, "\xE2\x89\xBF",            3, 0},
+  {"umacr",                            5, "\xC5\xAB",                2, 0},
+  {"pluscir",                          7, "\xE2\xA8\xA2",            3, 0},
+  {"ntriangleleft",                   13, "\xE2\x8B\xAA",            3, 0},
+  {"nLeftarrow",                      10, "\xE2\x87\x8D",            3, 0},
+  {"gnE",                              3, "\xE2\x89\xA9",            3, 0},
+  {"iacute",                           6, "\xC3\xAD",                2, 1},
+  {"mstpos",                           6, "\xE2\x88\xBE",            3, 0},
+  {"Theta",                            5, "\xCE\x98",                2, 0},
+  {"Lcedil",                           6, "\xC4\xBB",                2, 0},
+  {"iinfin",                           6, "\xE2\xA7\x9C",            3, 0},
+  {"ropar",                            5, "\xE2\xA6\x86",            3, 0},
+  {"angrtvbd",                         8, "\xE2\xA6\x9D",            3, 0},
+  {"cup",                              3, "\xE2\x88\xAA",            3, 0},
+  {"Tcy",                              3, "\xD0\xA2",                2, 0},
+  {"hkswarow",                         8, "\xE2\xA4\xA6",            3, 0},
+  {"triangle",                         8, "\xE2\x96\xB5",            3, 0},
+  {"mu",                               2, "\xCE\xBC",                2, 0},
+  {"DoubleDownArrow",                 15, "\xE2\x87\x93",            3, 0},
+  {"mapstoup",                         8, "\xE2\x86\xA5",            3, 0},
+  {"DownLeftVectorBar",               17, "\xE2\xA5\x96",            3, 0},
+  {"ReverseElement",                  14, "\xE2\x88\x8B",            3, 0},
+  {"ape",                              3, "\xE2\x89\x8A",            3, 0},
+  {"Efr",                              3, "\xF0\x9D\x94\x88",        4, 0},
+  {"nrArr",                            5, "\xE2\x87\x8F",            3, 0},
+  {"Bfr",                              3, "\xF0\x9D\x94\x85",        4, 0},
+  {"pluse",                            5, "\xE2\xA9\xB2",            3, 0},
+  {"qfr",                              3, "\xF0\x9D\x94\xAE",        4, 0},
+  {"pfr",                              3, "\xF0\x9D\x94\xAD",        4, 0},
+  {"lmoustache",                      10, "\xE2\x8E\xB0",            3, 0},
+  {"nrarr",                            5, "\xE2\x86\x9B",            3, 0},
+  {"xnis",                             4, "\xE2\x8B\xBB",            3, 0},
+  {"sqsubset",                         8, "\xE2\x8A\x8F",            3, 0},
+  {"HilbertSpace",                    12, "\xE2\x84\x8B",            3, 0},
+  {"lsime",                            5, "\xE2\xAA\x8D",            3, 0},
+  {"siml",                             4, "\xE2\xAA\x9D",            3, 0},
+  {"cwconint",                         8, "\xE2\x88\xB2",            3, 0},
+  {"daleth",                           6, "\xE2\x84\xB8",            3, 0},
+  {"amacr",                            5, "\xC4\x81",                2, 0},
+  {"Afr",                              3, "\xF0\x9D\x94\x84",        4, 0},
+  {"apacir",                           6, "\xE2\xA9\xAF",            3, 0},
+  {"VerticalSeparator",               17, "\xE2\x9D\x98",            3, 0},
+  {"gfr",                              3, "\xF0\x9D\x94\xA4",        4, 0},
+  {"scedil",                           6, "\xC5\x9F",                2, 0},
+  {"YUcy",                             4, "\xD0\xAE",                2, 0},
+  {"DoubleLeftTee",                   13, "\xE2\xAB\xA4",            3, 0},
+  {"realpart",                         8, "\xE2\x84\x9C",            3, 0},
+  {"Ycirc",                            5, "\xC5\xB6",                2, 0},
+  {"DownRightVector",                 15, "\xE2\x87\x81",            3, 0},
+  {"Hopf",                             4, "\xE2\x84\x8D",            3, 0},
+  {"LeftArrowRightArrow",             19, "\xE2\x87\x86",            3, 0},
+  {"OpenCurlyQuote",                  14, "\xE2\x80\x98",            3, 0},
+  {"Yopf",                             4, "\xF0\x9D\x95\x90",        4, 0},
+  {"ccups",                            5, "\xE2\xA9\x8C",            3, 0},
+  {"NotHumpDownHump",                 15, "\xE2\x89\x8E\xCC\xB8",    5, 0},
+  {"kopf",                             4, "\xF0\x9D\x95\x9C",        4, 0},
+  {"lcedil",                           6, "\xC4\xBC",                2, 0},
+  {"Longrightarrow",                  14, "\xE2\x9F\xB9",            3, 0},
+  {"Product",                          7, "\xE2\x88\x8F",            3, 0},
+  {"Dscr",                             4, "\xF0\x9D\x92\x9F",        4, 0},
+  {"lgE",                              3, "\xE2\xAA\x91",            3, 0},
+  {"ffllig",                           6, "\xEF\xAC\x84",            3, 0},
+  {"bumpeq",                           6, "\xE2\x89\x8F",            3, 0},
+  {"ge",                               2, "\xE2\x89\xA5",            3, 0},
+  {"RightArrowBar",                   13, "\xE2\x87\xA5",            3, 0},
+  {"nGtv",                             4, "\xE2\x89\xAB\xCC\xB8",    5, 0},
+  {"odash",                            5, "\xE2\x8A\x9D",            3, 0},
+  {"NJcy",                             4, "\xD0\x8A",                2, 0},
+  {"boxUr",                            5, "\xE2\x95\x99",            3, 0},
+  {"cupdot",                           6, "\xE2\x8A\x8D",            3, 0},
+  {"rlarr",                            5, "\xE2\x87\x84",            3, 0},
+  {"mcy",                              3, "\xD0\xBC",                2, 0},
+  {"cups",                             4, "\xE2\x88\xAA\xEF\xB8\x80", 6, 0},
+  {"DJcy",                             4, "\xD0\x82",                2, 0},
+  {"egs",                              3, "\xE2\xAA\x96",            3, 0},
+  {"rarrlp",                           6, "\xE2\x86\xAC",            3, 0},
+  {"notniva",                          7, "\xE2\x88\x8C",            3, 0},
+  {"vsupnE",                           6, "\xE2\xAB\x8C\xEF\xB8\x80", 6, 0},
+  {"ncongdot",                         8, "\xE2\xA9\xAD\xCC\xB8",    5, 0},
+  {"cylcty",                           6, "\xE2\x8C\xAD",            3, 0},
+  {"ntrianglelefteq",                 15, "\xE2\x8B\xAC",            3, 0},
+  {"ecaron",                           6, "\xC4\x9B",                2, 0},
+  {"xrarr",                            5, "\xE2\x9F\xB6",            3, 0},
+  {"bottom",                           6, "\xE2\x8A\xA5",            3, 0},
+  {"uwangle",                          7, "\xE2\xA6\xA7",            3, 0},
+  {"Leftrightarrow",                  14, "\xE2\x87\x94",            3, 0},
+  {"Zdot",                             4, "\xC5\xBB",                2, 0},
+  {"nwArr",                            5, "\xE2\x87\x96",            3, 0},
+  {"NotLeftTriangleEqual",            20, "\xE2\x8B\xAC",            3, 0},
+  {"hearts",                           6, "\xE2\x99\xA5",            3, 0},
+  {"lesg",                             4, "\xE2\x8B\x9A\xEF\xB8\x80", 6, 0},
+  {"VerticalTilde",                   13, "\xE2\x89\x80",            3, 0},
+  {"xcap",                             4, "\xE2\x8B\x82",            3, 0},
+  {"Cacute",                           6, "\xC4\x86",                2, 0},
+  {"angrtvb",                          7, "\xE2\x8A\xBE",            3, 0},
+  {"sect",                             4, "\xC2\xA7",                2, 1},
+  {"harrcir",                          7, "\xE2\xA5\x88",            3, 0},
+  {"Longleftarrow",                   13, "\xE2\x9F\xB8",            3, 0},
+  {"ShortUpArrow",                    12, "\xE2\x86\x91",            3, 0},
+  {"sim",                              3, "\xE2\x88\xBC",            3, 0},
+  {"larr",                             4, "\xE2\x86\x90",            3, 0},
+  {"natur",                            5, "\xE2\x99\xAE",            3, 0},
+  {"SmallCircle",                     11, "\xE2\x88\x98",            3, 0},
+  {"eDDot",                            5, "\xE2\xA9\xB7",            3, 0},
+  {"UnionPlus",                        9, "\xE2\x8A\x8E",            3, 0},
+  {"NotRightTriangle",                16, "\xE2\x8B\xAB",            3, 0},
+  {"nle",                              3, "\xE2\x89\xB0",            3, 0},
+  {"omicron",                          7, "\xCE\xBF",                2, 0},
+  {"DotEqual",                         8, "\xE2\x89\x90",            3, 0},
+  {"between",                          7, "\xE2\x89\xAC",            3, 0},
+  {"cirscir",                          7, "\xE2\xA7\x82",            3, 0},
+  {"LeftDownTeeVector",               17, "\xE2\xA5\xA1",            3, 0},
+  {"jopf",                             4, "\xF0\x9D\x95\x9B",        4, 0},
+  {"egrave",                           6, "\xC3\xA8",                2, 1},
+  {"LongLeftArrow",                   13, "\xE2\x9F\xB5",            3, 0},
+  {"hybull",                           6, "\xE2\x81\x83",            3, 0},
+  {"xuplus",                           6, "\xE2\xA8\x84",            3, 0},
+  {"vee",                              3, "\xE2\x88\xA8",            3, 0},
+  {"LeftTriangleEqual",               17, "\xE2\x8A\xB4",            3, 0},
+  {"bigsqcup",                         8, "\xE2\xA8\x86",            3, 0},
+  {"bigodot",                          7, "\xE2\xA8\x80",            3, 0},
+  {"LongRightArrow",                  14, "\xE2\x9F\xB6",            3, 0},
+  {"utilde",                           6, "\xC5\xA9",                2, 0},
+  {"raemptyv",                         8, "\xE2\xA6\xB3",            3, 0},
+  {"thkap",                            5, "\xE2\x89\x88",            3, 0},
+  {"subset",                           6, "\xE2\x8A\x82",            3, 0},
+  {"tfr",                              3, "\xF0\x9D\x94\xB1",        4, 0},
+  {"DiacriticalTilde",                16, "\xCB\x9C",                2, 0},
+  {"le",                               2, "\xE2\x89\xA4",            3, 0},
+  {"Ropf",                             4, "\xE2\x84\x9D",            3, 0},
+  {"blk14",                            5, "\xE2\x96\x91",            3, 0},
+  {"yacy",                             4, "\xD1\x8F",                2, 0},
+  {"rscr",                             4, "\xF0\x9D\x93\x87",        4, 0},
+  {"leqslant",                         8, "\xE2\xA9\xBD",            3, 0},
+  {"int",                              3, "\xE2\x88\xAB",            3, 0},
+  {"FilledVerySmallSquare",           21, "\xE2\x96\xAA",            3, 0},
+  {"swarhk",                           6, "\xE2\xA4\xA6",            3, 0},
+  {"boxDl",                            5, "\xE2\x95\x96",            3, 0},
+  {"CupCap",                           6, "\xE2\x89\x8D",            3, 0},
+  {"Rcy",                              3, "\xD0\xA0",                2, 0},
+  {"aring",                            5, "\xC3\xA5",                2, 1},
+  {"Iota",                             4, "\xCE\x99",                2, 0},
+  {"rppolint",                         8, "\xE2\xA8\x92",            3, 0},
+  {"cwint",                            5, "\xE2\x88\xB1",            3, 0},
+  {"Union",                            5, "\xE2\x8B\x83",            3, 0},
+  {"naturals",                         8, "\xE2\x84\x95",            3, 0},
+  {"nvdash",                           6, "\xE2\x8A\xAC",            3, 0},
+  {"lbrke",                            5, "\xE2\xA6\x8B",            3, 0},
+  {"boxvl",                            5, "\xE2\x94\xA4",            3, 0},
+  {"Epsilon",                          7, "\xCE\x95",                2, 0},
+  {"rthree",                           6, "\xE2\x8B\x8C",            3, 0},
+  {"straightepsilon",                 15, "\xCF\xB5",                2, 0},
+  {"tcaron",                           6, "\xC5\xA5",                2, 0},
+  {"sqcups",                           6, "\xE2\x8A\x94\xEF\xB8\x80", 6, 0},
+  {"IOcy",                             4, "\xD0\x81",                2, 0},
+  {"eqcolon",                          7, "\xE2\x89\x95",            3, 0},
+  {"Colon",                            5, "\xE2\x88\xB7",            3, 0},
+  {"AElig",                            5, "\xC3\x86",                2, 1},
+  {"lescc",                            5, "\xE2\xAA\xA8",            3, 0},
+  {"vartheta",                         8, "\xCF\x91",                2, 0},
+  {"propto",                           6, "\xE2\x88\x9D",            3, 0},
+  {"risingdotseq",                    12, "\xE2\x89\x93",            3, 0},
+  {"ncong",                            5, "\xE2\x89\x87",            3, 0},
+  {"ljcy",                             4, "\xD1\x99",                2, 0},
+  {"eogon",                            5, "\xC4\x99",                2, 0},
+  {"amalg",                            5, "\xE2\xA8\xBF",            3, 0},
+  {"acy",                              3, "\xD0\xB0",                2, 0},
+  {"glj",                              3, "\xE2\xAA\xA4",            3, 0},
+  {"lacute",                           6, "\xC4\xBA",                2, 0},
+  {"erarr",                            5, "\xE2\xA5\xB1",            3, 0},
+  {"GreaterLess",                     11, "\xE2\x89\xB7",            3, 0},
+  {"nsubset",                          7, "\xE2\x8A\x82\xE2\x83\x92", 6, 0},
+  {"Lleftarrow",                      10, "\xE2\x87\x9A",            3, 0},
+  {"ofr",                              3, "\xF0\x9D\x94\xAC",        4, 0},
+  {"rtrif",                            5, "\xE2\x96\xB8",            3, 0},
+  {"luruhar",                          7, "\xE2\xA5\xA6",            3, 0},
+  {"coloneq",                          7, "\xE2\x89\x94",            3, 0},
+  {"delta",                            5, "\xCE\xB4",                2, 0},
+  {"infin",                            5, "\xE2\x88\x9E",            3, 0},
+  {"Uarrocir",                         8, "\xE2\xA5\x89",            3, 0},
+  {"zdot",                             4, "\xC5\xBC",                2, 0},
+  {"tbrk",                             4, "\xE2\x8E\xB4",            3, 0},
+  {"Zopf",                             4, "\xE2\x84\xA4",            3, 0},
+  {"boxhu",                            5, "\xE2\x94\xB4",            3, 0},
+  {"scaron",                           6, "\xC5\xA1",                2, 0},
+  {"lnsim",                            5, "\xE2\x8B\xA6",            3, 0},
+  {"Sacute",                           6, "\xC5\x9A",                2, 0},
+  {"xsqcup",                           6, "\xE2\xA8\x86",            3, 0},
+  {"CloseCurlyQuote",                 15, "\xE2\x80\x99",            3, 0},
+  {"ange",                             4, "\xE2\xA6\xA4",            3, 0},
+  {"Ascr",                             4, "\xF0\x9D\x92\x9C",        4, 0},
+  {"planck",                           6, "\xE2\x84\x8F",            3, 0},
+  {"epsiv",                            5, "\xCF\xB5",                2, 0},
+  {"Proportion",                      10, "\xE2\x88\xB7",            3, 0},
+  {"scirc",                            5, "\xC5\x9D",                2, 0},
+  {"supseteqq",                        9, "\xE2\xAB\x86",            3, 0},
+  {"lmidot",                           6, "\xC5\x80",                2, 0},
+  {"CircleMinus",                     11, "\xE2\x8A\x96",            3, 0},
+  {"notinvc",                          7, "\xE2\x8B\xB6",            3, 0},
+  {"intprod",                          7, "\xE2\xA8\xBC",            3, 0},
+  {"lotimes",                          7, "\xE2\xA8\xB4",            3, 0},
+  {"cross",                            5, "\xE2\x9C\x97",            3, 0},
+  {"DoubleContourIntegral",           21, "\xE2\x88\xAF",            3, 0},
+  {"diam",                             4, "\xE2\x8B\x84",            3, 0},
+  {"nspar",                            5, "\xE2\x88\xA6",            3, 0},
+  {"upsilon",                          7, "\xCF\x85",                2, 0},
+  {"squarf",                           6, "\xE2\x96\xAA",            3, 0},
+  {"topcir",                           6, "\xE2\xAB\xB1",            3, 0},
+  {"lozenge",                          7, "\xE2\x97\x8A",            3, 0},
+  {"sigma",                            5, "\xCF\x83",                2, 0},
+  {"Vcy",                              3, "\xD0\x92",                2, 0},
+  {"forall",                           6, "\xE2\x88\x80",            3, 0},
+  {"rsh",                              3, "\xE2\x86\xB1",            3, 0},
+  {"Gt",                               2, "\xE2\x89\xAB",            3, 0},
+  {"therefore",                        9, "\xE2\x88\xB4",            3, 0},
+  {"lhblk",                            5, "\xE2\x96\x84",            3, 0},
+  {"DZcy",                             4, "\xD0\x8F",                2, 0},
+  {"Fscr",                             4, "\xE2\x84\xB1",            3, 0},
+  {"blacktriangle",                   13, "\xE2\x96\xB4",            3, 0},
+  {"PrecedesSlantEqual",              18, "\xE2\x89\xBC",            3, 0},
+  {"succapprox",                      10, "\xE2\xAA\xB8",            3, 0},
+  {"SuchThat",                         8, "\xE2\x88\x8B",            3, 0},
+  {"smashp",                           6, "\xE2\xA8\xB3",            3, 0},
+  {"ngtr",                             4, "\xE2\x89\xAF",            3, 0},
+  {"ndash",                            5, "\xE2\x80\x93",            3, 0},
+  {"bne",                              3, "\x3D\xE2\x83\xA5",        4, 0},
+  {"ldrdhar",                          7, "\xE2\xA5\xA7",            3, 0},
+  {"late",                             4, "\xE2\xAA\xAD",            3, 0},
+  {"sqcap",                            5, "\xE2\x8A\x93",            3, 0},
+  {"boxdR",                            5, "\xE2\x95\x92",            3, 0},
+  {"uArr",                             4, "\xE2\x87\x91",            3, 0},
+  {"yucy",                             4, "\xD1\x8E",                2, 0},
+  {"vsubne",                           6, "\xE2\x8A\x8A\xEF\xB8\x80", 6, 0},
+  {"leftleftarrows",                  14, "\xE2\x87\x87",            3, 0},
+  {"hbar",                             4, "\xE2\x84\x8F",            3, 0},
+  {"uhblk",                            5, "\xE2\x96\x80",            3, 0},
+  {"vnsup",                            5, "\xE2\x8A\x83\xE2\x83\x92", 6, 0},
+  {"nles",                             4, "\xE2\xA9\xBD\xCC\xB8",    5, 0},
+  {"nvsim",                            5, "\xE2\x88\xBC\xE2\x83\x92", 6, 0},
+  {"leq",                              3, "\xE2\x89\xA4",            3, 0},
+  {"DoubleRightTee",                  14, "\xE2\x8A\xA8",            3, 0},
+  {"Ecaron",                           6, "\xC4\x9A",                2, 0},
+  {"xrArr",                            5, "\xE2\x9F\xB9",            3, 0},
+  {"duhar",                            5, "\xE2\xA5\xAF",            3, 0},
+  {"Otilde",                           6, "\xC3\x95",                2, 1},
+  {"el",                               2, "\xE2\xAA\x99",            3, 0},
+  {"lowast",                           6, "\xE2\x88\x97",            3, 0},
+  {"Prime",                            5, "\xE2\x80\xB3",            3, 0},
+  {"nsccue",                           6, "\xE2\x8B\xA1",            3, 0},
+  {"Chi",                              3, "\xCE\xA7",                2, 0},
+  {"nleqq",                            5, "\xE2\x89\xA6\xCC\xB8",    5, 0},
+  {"mfr",                              3, "\xF0\x9D\x94\xAA",        4, 0},
+  {"Kfr",                              3, "\xF0\x9D\x94\x8E",        4, 0},
+  {"Omacr",                            5, "\xC5\x8C",                2, 0},
+  {"Alpha",                            5, "\xCE\x91",                2, 0},
+  {"boxminus",                         8, "\xE2\x8A\x9F",            3, 0},
+  {"ubreve",                           6, "\xC5\xAD",                2, 0},
+  {"nsimeq",                           6, "\xE2\x89\x84",            3, 0},
+  {"horbar",                           6, "\xE2\x80\x95",            3, 0},
+  {"thksim",                           6, "\xE2\x88\xBC",            3, 0},
+  {"Tfr",                              3, "\xF0\x9D\x94\x97",        4, 0},
+  {"bigvee",                           6, "\xE2\x8B\x81",            3, 0},
+  {"circeq",                           6, "\xE2\x89\x97",            3, 0},
+  {"varsubsetneqq",                   13, "\xE2\xAB\x8B\xEF\xB8\x80", 6, 0},
+  {"SucceedsSlantEqual",              18, "\xE2\x89\xBD",            3, 0},
+  {"vprop",                            5, "\xE2\x88\x9D",            3, 0},
+  {"target",                           6, "\xE2\x8C\x96",            3, 0},
+  {"Cscr",                             4, "\xF0\x9D\x92\x9E",        4, 0},
+  {"rarrw",                            5, "\xE2\x86\x9D",            3, 0},
+  {"boxuL",                            5, "\xE2\x95\x9B",            3, 0},
+  {"Tscr",                             4, "\xF0\x9D\x92\xAF",        4, 0},
+  {"varsupsetneqq",                   13, "\xE2\xAB\x8C\xEF\xB8\x80", 6, 0},
+  {"star",                             4, "\xE2\x98\x86",            3, 0},
+  {"oS",                               2, "\xE2\x93\x88",            3, 0},
+  {"eqsim",                            5, "\xE2\x89\x82",            3, 0},
+  {"boxhD",                            5, "\xE2\x95\xA5",            3, 0},
+  {"NotGreaterTilde",                 15, "\xE2\x89\xB5",            3, 0},
+  {"circlearrowleft",                 15, "\xE2\x86\xBA",            3, 0},
+  {"rightarrow",                      10, "\xE2\x86\x92",            3, 0},
+  {"Cup",                              3, "\xE2\x8B\x93",            3, 0},
+  {"curlyvee",                         8, "\xE2\x8B\x8E",            3, 0},
+  {"approxeq",                         8, "\xE2\x89\x8A",            3, 0},
+  {"sbquo",                            5, "\xE2\x80\x9A",            3, 0},
+  {"RightUpTeeVector",                16, "\xE2\xA5\x9C",            3, 0},
+  {"demptyv",                          7, "\xE2\xA6\xB1",            3, 0},
+  {"loz",                              3, "\xE2\x97\x8A",            3, 0},
+  {"Qopf",                             4, "\xE2\x84\x9A",            3, 0},
+  {"rsquor",                           6, "\xE2\x80\x99",            3, 0},
+  {"Racute",                           6, "\xC5\x94",                2, 0},
+  {"shortmid",                         8, "\xE2\x88\xA3",            3, 0},
+  {"ang",                              3, "\xE2\x88\xA0",            3, 0},
+  {"boxUl",                            5, "\xE2\x95\x9C",            3, 0},
+  {"Hscr",                             4, "\xE2\x84\x8B",            3, 0},
+  {"RightTriangle",                   13, "\xE2\x8A\xB3",            3, 0},
+  {"Dopf",                             4, "\xF0\x9D\x94\xBB",        4, 0},
+  {"Lsh",                              3, "\xE2\x86\xB0",            3, 0},
+  {"nVdash",                           6, "\xE2\x8A\xAE",            3, 0},
+  {"Bernoullis",                      10, "\xE2\x84\xAC",            3, 0},
+  {"searrow",                          7, "\xE2\x86\x98",            3, 0},
+  {"nlArr",                            5, "\xE2\x87\x8D",            3, 0},
+  {"clubsuit",                         8, "\xE2\x99\xA3",            3, 0},
+  {"NotLess",                          7, "\xE2\x89\xAE",            3, 0},
+  {"bigotimes",                        9, "\xE2\xA8\x82",            3, 0},
+  {"Kopf",                             4, "\xF0\x9D\x95\x82",        4, 0},
+  {"vcy",                              3, "\xD0\xB2",                2, 0},
+  {"HumpEqual",                        9, "\xE2\x89\x8F",            3, 0},
+  {"Lscr",                             4, "\xE2\x84\x92",            3, 0},
+  {"RuleDelayed",                     11, "\xE2\xA7\xB4",            3, 0},
+  {"NotSucceedsEqual",                16, "\xE2\xAA\xB0\xCC\xB8",    5, 0},
+  {"HorizontalLine",                  14, "\xE2\x94\x80",            3, 0},
+  {"ocy",                              3, "\xD0\xBE",                2, 0},
+  {"DoubleDot",                        9, "\xC2\xA8",                2, 0},
+  {"efDot",                            5, "\xE2\x89\x92",            3, 0},
+  {"DoubleVerticalBar",               17, "\xE2\x88\xA5",            3, 0},
+  {"orarr",                            5, "\xE2\x86\xBB",            3, 0},
+  {"vBar",                             4, "\xE2\xAB\xA8",            3, 0},
+  {"nwnear",                           6, "\xE2\xA4\xA7",            3, 0},
+  {"circledS",                         8, "\xE2\x93\x88",            3, 0},
+  {"zeetrf",                           6, "\xE2\x84\xA8",            3, 0},
+  {"NotLessSlantEqual",               17, "\xE2\xA9\xBD\xCC\xB8",    5, 0},
+  {"image",                            5, "\xE2\x84\x91",            3, 0},
+  {"Ccedil",                           6, "\xC3\x87",                2, 1},
+  {"Fopf",                             4, "\xF0\x9D\x94\xBD",        4, 0},
+  {"rarrpl",                           6, "\xE2\xA5\x85",            3, 0},
+  {"rarrap",                           6, "\xE2\xA5\xB5",            3, 0},
+  {"Omicron",                          7, "\xCE\x9F",                2, 0},
+  {"Rcedil",                           6, "\xC5\x96",                2, 0},
+  {"larrhk",                           6, "\xE2\x86\xA9",            3, 0},
+  {"rx",                               2, "\xE2\x84\x9E",            3, 0},
+  {"leftrightharpoons",               17, "\xE2\x87\x8B",            3, 0},
+  {"xhArr",                            5, "\xE2\x9F\xBA",            3, 0},
+  {"varphi",                           6, "\xCF\x95",                2, 0},
+  {"boxdl",                            5, "\xE2\x94\x90",            3, 0},
+  {"rarrbfs",                          7, "\xE2\xA4\xA0",            3, 0},
+  {"djcy",                             4, "\xD1\x92",                2, 0},
+  {"map",                              3, "\xE2\x86\xA6",            3, 0},
+  {"succeq",                           6, "\xE2\xAA\xB0",            3, 0},
+  {"imof",                             4, "\xE2\x8A\xB7",            3, 0},
+  {"Longleftrightarrow",              18, "\xE2\x9F\xBA",            3, 0},
+  {"sacute",                           6, "\xC5\x9B",                2, 0},
+  {"half",                             4, "\xC2\xBD",                2, 0},
+  {"Copf",                             4, "\xE2\x84\x82",            3, 0},
+  {"subne",                            5, "\xE2\x8A\x8A",            3, 0},
+  {"cirmid",                           6, "\xE2\xAB\xAF",            3, 0},
+  {"weierp",                           6, "\xE2\x84\x98",            3, 0},
+  {"oacute",                           6, "\xC3\xB3",                2, 1},
+  {"roang",                            5, "\xE2\x9F\xAD",            3, 0},
+  {"supsup",                           6, "\xE2\xAB\x96",            3, 0},
+  {"divideontimes",                   13, "\xE2\x8B\x87",            3, 0},
+  {"orv",                              3, "\xE2\xA9\x9B",            3, 0},
+  {"nwarrow",                          7, "\xE2\x86\x96",            3, 0},
+  {"SquareUnion",                     11, "\xE2\x8A\x94",            3, 0},
+  {"NestedLessLess",                  14, "\xE2\x89\xAA",            3, 0},
+  {"nsce",                             4, "\xE2\xAA\xB0\xCC\xB8",    5, 0},
+  {"ddarr",                            5, "\xE2\x87\x8A",            3, 0},
+  {"plusdu",                           6, "\xE2\xA8\xA5",            3, 0},
+  {"thicksim",                         8, "\xE2\x88\xBC",            3, 0},
+  {"LeftVectorBar",                   13, "\xE2\xA5\x92",            3, 0},
+  {"copy",                             4, "\xC2\xA9",                2, 1},
+  {"ContourIntegral",                 15, "\xE2\x88\xAE",            3, 0},
+  {"middot",                           6, "\xC2\xB7",                2, 1},
+  {"bernou",                           6, "\xE2\x84\xAC",            3, 0},
+  {"Uring",                            5, "\xC5\xAE",                2, 0},
+  {"ntrianglerighteq",                16, "\xE2\x8B\xAD",            3, 0},
+  {"Ll",                               2, "\xE2\x8B\x98",            3, 0},
+  {"sopf",                             4, "\xF0\x9D\x95\xA4",        4, 0},
+  {"hopf",                             4, "\xF0\x9D\x95\x99",        4, 0},
+  {"egsdot",                           6, "\xE2\xAA\x98",            3, 0},
+  {"circledR",                         8, "\xC2\xAE",                2, 0},
+  {"backsimeq",                        9, "\xE2\x8B\x8D",            3, 0},
+  {"permil",                           6, "\xE2\x80\xB0",            3, 0},
+  {"osol",                             4, "\xE2\x8A\x98",            3, 0},
+  {"barvee",                           6, "\xE2\x8A\xBD",            3, 0},
+  {"Therefore",                        9, "\xE2\x88\xB4",            3, 0},
+  {"rrarr",                            5, "\xE2\x87\x89",            3, 0},
+  {"wedge",                            5, "\xE2\x88\xA7",            3, 0},
+  {"harr",                             4, "\xE2\x86\x94",            3, 0},
+  {"UpArrow",                          7, "\xE2\x86\x91",            3, 0},
+  {"NegativeThickSpace",              18, "\xE2\x80\x8B",            3, 0},
+  {"nsupset",                          7, "\xE2\x8A\x83\xE2\x83\x92", 6, 0},
+  {"Wcirc",                            5, "\xC5\xB4",                2, 0},
+  {"Kcy",                              3, "\xD0\x9A",                2, 0},
+  {"shchcy",                           6, "\xD1\x89",                2, 0},
+  {"angmsdac",                         8, "\xE2\xA6\xAA",            3, 0},
+  {"angmsdah",                         8, "\xE2\xA6\xAF",            3, 0},
+  {"llarr",                            5, "\xE2\x87\x87",            3, 0},
+  {"ltlarr",                           6, "\xE2\xA5\xB6",            3, 0},
+  {"multimap",                         8, "\xE2\x8A\xB8",            3, 0},
+  {"alefsym",                          7, "\xE2\x84\xB5",            3, 0},
+  {"boxhd",                            5, "\xE2\x94\xAC",            3, 0},
+  {"sup3",                             4, "\xC2\xB3",                2, 1},
+  {"uparrow",                          7, "\xE2\x86\x91",            3, 0},
+  {"ni",                               2, "\xE2\x88\x8B",            3, 0},
+  {"psi",                              3, "\xCF\x88",                2, 0},
+  {"ratail",                           6, "\xE2\xA4\x9A",            3, 0},
+  {"hArr",                             4, "\xE2\x87\x94",            3, 0},
+  {"Verbar",                           6, "\xE2\x80\x96",            3, 0},
+  {"hookrightarrow",                  14, "\xE2\x86\xAA",            3, 0},
+  {"cularrp",                          7, "\xE2\xA4\xBD",            3, 0},
+  {"langd",                            5, "\xE2\xA6\x91",            3, 0},
+  {"NotCupCap",                        9, "\xE2\x89\xAD",            3, 0},
+  {"colon",                            5, "\x3A",                    1, 0},
+  {"ograve",                           6, "\xC3\xB2",                2, 1},
+  {"EmptyVerySmallSquare",            20, "\xE2\x96\xAB",            3, 0},
+  {"Ubreve",                           6, "\xC5\xAC",                2, 0},
+  {"dagger",                           6, "\xE2\x80\xA0",            3, 0},
+  {"DownLeftVector",                  14, "\xE2\x86\xBD",            3, 0},
+  {"lessgtr",                          7, "\xE2\x89\xB6",            3, 0},
+  {"RightTeeArrow",                   13, "\xE2\x86\xA6",            3, 0},
+  {"Zscr",                             4, "\xF0\x9D\x92\xB5",        4, 0},
+  {"gsiml",                            5, "\xE2\xAA\x90",            3, 0},
+  {"NotSquareSupersetEqual",          22, "\xE2\x8B\xA3",            3, 0},
+  {"PrecedesEqual",                   13, "\xE2\xAA\xAF",            3, 0},
+  {"plusb",                            5, "\xE2\x8A\x9E",            3, 0},
+  {"lesdotor",                         8, "\xE2\xAA\x83",            3, 0},
+  {"rangle",                           6, "\xE2\x9F\xA9",            3, 0},
+  {"compfn",                           6, "\xE2\x88\x98",            3, 0},
+  {"plusmn",                           6, "\xC2\xB1",                2, 1},
+  {"boxHD",                            5, "\xE2\x95\xA6",            3, 0},
+  {"Upsi",                             4, "\xCF\x92",                2, 0},
+  {"bprime",                           6, "\xE2\x80\xB5",            3, 0},
+  {"Equal",                            5, "\xE2\xA9\xB5",            3, 0},
+  {"intlarhk",                         8, "\xE2\xA8\x97",            3, 0},
+  {"Integral",                         8, "\xE2\x88\xAB",            3, 0},
+  {"simeq",                            5, "\xE2\x89\x83",            3, 0},
+  {"scnap",                            5, "\xE2\xAA\xBA",            3, 0},
+  {"geq",                              3, "\xE2\x89\xA5",            3, 0},
+  {"boxuR",                            5, "\xE2\x95\x98",            3, 0},
+  {"RBarr",                            5, "\xE2\xA4\x90",            3, 0},
+  {"nhpar",                            5, "\xE2\xAB\xB2",            3, 0},
+  {"Gscr",                             4, "\xF0\x9D\x92\xA2",        4, 0},
+  {"sigmaf",                           6, "\xCF\x82",                2, 0},
+  {"TRADE",                            5, "\xE2\x84\xA2",            3, 0},
+  {"and",                              3, "\xE2\x88\xA7",            3, 0},
+  {"rdquor",                           6, "\xE2\x80\x9D",            3, 0},
+  {"gesles",                           6, "\xE2\xAA\x94",            3, 0},
+  {"SHcy",                             4, "\xD0\xA8",                2, 0},
+  {"LeftFloor",                        9, "\xE2\x8C\x8A",            3, 0},
+  {"leftrightarrows",                 15, "\xE2\x87\x86",            3, 0},
+  {"NestedGreaterGreater",            20, "\xE2\x89\xAB",            3, 0},
+  {"Xi",                               2, "\xCE\x9E",                2, 0},
+  {"frac14",                           6, "\xC2\xBC",                2, 1},
+  {"succcurlyeq",                     11, "\xE2\x89\xBD",            3, 0},
+  {"boxUR",                            5, "\xE2\x95\x9A",            3, 0},
+  {"prap",                             4, "\xE2\xAA\xB7",            3, 0},
+  {"varr",                             4, "\xE2\x86\x95",            3, 0},
+  {"LeftUpTeeVector",                 15, "\xE2\xA5\xA0",            3, 0},
+  {"andd",                             4, "\xE2\xA9\x9C",            3, 0},
+  {"curlyeqsucc",                     11, "\xE2\x8B\x9F",            3, 0},
+  {"ccirc",                            5, "\xC4\x89",                2, 0},
+  {"div",                              3, "\xC3\xB7",                2, 0},
+  {"Egrave",                           6, "\xC3\x88",                2, 1},
+  {"cuepr",                            5, "\xE2\x8B\x9E",            3, 0},
+  {"prop",                             4, "\xE2\x88\x9D",            3, 0},
+  {"Vdash",                            5, "\xE2\x8A\xA9",            3, 0},
+  {"succ",                             4, "\xE2\x89\xBB",            3, 0},
+  {"tosa",                             4, "\xE2\xA4\xA9",            3, 0},
+  {"Zcy",                              3, "\xD0\x97",                2, 0},
+  {"Euml",                             4, "\xC3\x8B",                2, 1},
+  {"looparrowleft",                   13, "\xE2\x86\xAB",            3, 0},
+  {"UpArrowBar",                      10, "\xE2\xA4\x92",            3, 0},
+  {"solb",                             4, "\xE2\xA7\x84",            3, 0},
+  {"rArr",                             4, "\xE2\x87\x92",            3, 0},
+  {"Sqrt",                             4, "\xE2\x88\x9A",            3, 0},
+  {"Equilibrium",                     11, "\xE2\x87\x8C",            3, 0},
+  {"circledcirc",                     11, "\xE2\x8A\x9A",            3, 0},
+  {"nLl",                              3, "\xE2\x8B\x98\xCC\xB8",    5, 0},
+  {"Pfr",                              3, "\xF0\x9D\x94\x93",        4, 0},
+  {"nsup",                             4, "\xE2\x8A\x85",            3, 0},
+  {"Iuml",                             4, "\xC3\x8F",                2, 1},
+  {"dotminus",                         8, "\xE2\x88\xB8",            3, 0},
+  {"nmid",                             4, "\xE2\x88\xA4",            3, 0},
+  {"NotGreaterFullEqual",             19, "\xE2\x89\xA7\xCC\xB8",    5, 0},
+  {"varpropto",                        9, "\xE2\x88\x9D",            3, 0},
+  {"ubrcy",                            5, "\xD1\x9E",                2, 0},
+  {"bsime",                            5, "\xE2\x8B\x8D",            3, 0},
+  {"cuvee",                            5, "\xE2\x8B\x8E",            3, 0},
+  {"angmsdab",                         8, "\xE2\xA6\xA9",            3, 0},
+  {"Backslash",                        9, "\xE2\x88\x96",            3, 0},
+  {"igrave",                           6, "\xC3\xAC",                2, 1},
+  {"nesim",                            5, "\xE2\x89\x82\xCC\xB8",    5, 0},
+  {"rightleftarrows",                 15, "\xE2\x87\x84",            3, 0},
+  {"icirc",                            5, "\xC3\xAE",                2, 1},
+  {"els",                              3, "\xE2\xAA\x95",            3, 0},
+  {"wcirc",                            5, "\xC5\xB5",                2, 0},
+  {"DifferentialD",                   13, "\xE2\x85\x86",            3, 0},
+  {"zopf",                             4, "\xF0\x9D\x95\xAB",        4, 0},
+  {"LJcy",                             4, "\xD0\x89",                2, 0},
+  {"ges",                              3, "\xE2\xA9\xBE",            3, 0},
+  {"LessSlantEqual",                  14, "\xE2\xA9\xBD",            3, 0},
+  {"upuparrows",                      10, "\xE2\x87\x88",            3, 0},
+  {"nlt",                              3, "\xE2\x89\xAE",            3, 0},
+  {"varrho",                           6, "\xCF\xB1",                2, 0},
+  {"colone",                           6, "\xE2\x89\x94",            3, 0},
+  {"Rarr",                             4, "\xE2\x86\xA0",            3, 0},
+  {"curren",                           6, "\xC2\xA4",                2, 1},
+  {"gcirc",                            5, "\xC4\x9D",                2, 0},
+  {"Jukcy",                            5, "\xD0\x84",                2, 0},
+  {"ffilig",                           6, "\xEF\xAC\x83",            3, 0},
+  {"thinsp",                           6, "\xE2\x80\x89",            3, 0},
+  {"cemptyv",                          7, "\xE2\xA6\xB2",            3, 0},
+  {"LowerRightArrow",                 15, "\xE2\x86\x98",            3, 0},
+  {"Cconint",                          7, "\xE2\x88\xB0",            3, 0},
+  {"Fcy",                              3, "\xD0\xA4",                2, 0},
+  {"imped",                            5, "\xC6\xB5",                2, 0},
+  {"iprod",                            5, "\xE2\xA8\xBC",            3, 0},
+  {"period",                           6, "\x2E",                    1, 0},
+  {"Xscr",                             4, "\xF0\x9D\x92\xB3",        4, 0},
+  {"RightArrowLeftArrow",             19, "\xE2\x87\x84",            3, 0},
+  {"Jcirc",                            5, "\xC4\xB4",                2, 0},
+  {"nrarrw",                           6, "\xE2\x86\x9D\xCC\xB8",    5, 0},
+  {"parallel",                         8, "\xE2\x88\xA5",            3, 0},
+  {"nesear",                           6, "\xE2\xA4\xA8",            3, 0},
+  {"csub",                             4, "\xE2\xAB\x8F",            3, 0},
+  {"rsqb",                             4, "\x5D",                    1, 0},
+  {"vartriangleright",                16, "\xE2\x8A\xB3",            3, 0},
+  {"pi",                               2, "\xCF\x80",                2, 0},
+  {"profline",                         8, "\xE2\x8C\x92",            3, 0},
+  {"backsim",                          7, "\xE2\x88\xBD",            3, 0},
+  {"xcup",                             4, "\xE2\x8B\x83",            3, 0},
+  {"epsi",                             4, "\xCE\xB5",                2, 0},
+  {"fscr",                             4, "\xF0\x9D\x92\xBB",        4, 0},
+  {"Rcaron",                           6, "\xC5\x98",                2, 0},
+  {"LeftCeiling",                     11, "\xE2\x8C\x88",            3, 0},
+  {"quest",                            5, "\x3F",                    1, 0},
+  {"Iacute",                           6, "\xC3\x8D",                2, 1},
+  {"Ubrcy",                            5, "\xD0\x8E",                2, 0},
+  {"esim",                             4, "\xE2\x89\x82",            3, 0},
+  {"nges",                             4, "\xE2\xA9\xBE\xCC\xB8",    5, 0},
+  {"leftharpoondown",                 15, "\xE2\x86\xBD",            3, 0},
+  {"dArr",                             4, "\xE2\x87\x93",            3, 0},
+  {"bullet",                           6, "\xE2\x80\xA2",            3, 0},
+  {"Sigma",                            5, "\xCE\xA3",                2, 0},
+  {"dbkarow",                          7, "\xE2\xA4\x8F",            3, 0},
+  {"rAarr",                            5, "\xE2\x87\x9B",            3, 0},
+  {"Zfr",                              3, "\xE2\x84\xA8",            3, 0},
+  {"Igrave",                           6, "\xC3\x8C",                2, 1},
+  {"mnplus",                           6, "\xE2\x88\x93",            3, 0},
+  {"supsetneqq",                      10, "\xE2\xAB\x8C",            3, 0},
+  {"supsub",                           6, "\xE2\xAB\x94",            3, 0},
+  {"uplus",                            5, "\xE2\x8A\x8E",            3, 0},
+  {"lesseqqgtr",                      10, "\xE2\xAA\x8B",            3, 0},
+  {"lAarr",                            5, "\xE2\x87\x9A",            3, 0},
+  {"rpargt",                           6, "\xE2\xA6\x94",            3, 0},
+  {"DoubleRightArrow",                16, "\xE2\x87\x92",            3, 0},
+  {"yen",                              3, "\xC2\xA5",                2, 1},
+  {"pitchfork",                        9, "\xE2\x8B\x94",            3, 0},
+  {"ngeq",                             4, "\xE2\x89\xB1",            3, 0},
+  {"GreaterSlantEqual",               17, "\xE2\xA9\xBE",            3, 0},
+  {"divide",                           6, "\xC3\xB7",                2, 1},
+  {"rsaquo",                           6, "\xE2\x80\xBA",            3, 0},
+  {"DDotrahd",                         8, "\xE2\xA4\x91",            3, 0},
+  {"odblac",                           6, "\xC5\x91",                2, 0},
+  {"ee",                               2, "\xE2\x85\x87",            3, 0},
+  {"Barwed",                           6, "\xE2\x8C\x86",            3, 0},
+  {"varsubsetneq",                    12, "\xE2\x8A\x8A\xEF\xB8\x80", 6, 0},
+  {"trisb",                            5, "\xE2\xA7\x8D",            3, 0},
+  {"szlig",                            5, "\xC3\x9F",                2, 1},
+  {"uopf",                             4, "\xF0\x9D\x95\xA6",        4, 0},
+  {"Ucy",                              3, "\xD0\xA3",                2, 0},
+  {"Supset",                           6, "\xE2\x8B\x91",            3, 0},
+  {"aacute",                           6, "\xC3\xA1",                2, 1},
+  {"trianglelefteq",                  14, "\xE2\x8A\xB4",            3, 0},
+  {"lneq",                             4, "\xE2\xAA\x87",            3, 0},
+  {"DiacriticalGrave",                16, "\x60",                    1, 0},
+  {"ntgl",                             4, "\xE2\x89\xB9",            3, 0},
+  {"tscr",                             4, "\xF0\x9D\x93\x89",        4, 0},
+  {"nedot",                            5, "\xE2\x89\x90\xCC\xB8",    5, 0},
+  {"curvearrowleft",                  14, "\xE2\x86\xB6",            3, 0},
+  {"integers",                         8, "\xE2\x84\xA4",            3, 0},
+  {"utdot",                            5, "\xE2\x8B\xB0",            3, 0},
+  {"nvltrie",                          7, "\xE2\x8A\xB4\xE2\x83\x92", 6, 0},
+  {"Scedil",                           6, "\xC5\x9E",                2, 0},
+  {"nltrie",                           6, "\xE2\x8B\xAC",            3, 0},
+  {"diamondsuit",                     11, "\xE2\x99\xA6",            3, 0},
+  {"Tau",                              3, "\xCE\xA4",                2, 0},
+  {"UpperRightArrow",                 15, "\xE2\x86\x97",            3, 0},
+  {"copysr",                           6, "\xE2\x84\x97",            3, 0},
+  {"fflig",                            5, "\xEF\xAC\x80",            3, 0},
+  {"xscr",                             4, "\xF0\x9D\x93\x8D",        4, 0},
+  {"bkarow",                           6, "\xE2\xA4\x8D",            3, 0},
+  {"gdot",                             4, "\xC4\xA1",                2, 0},
+  {"NotLessEqual",                    12, "\xE2\x89\xB0",            3, 0},
+  {"laquo",                            5, "\xC2\xAB",                2, 1},
+  {"Lopf",                             4, "\xF0\x9D\x95\x83",        4, 0},
+  {"popf",                             4, "\xF0\x9D\x95\xA1",        4, 0},
+  {"Udblac",                           6, "\xC5\xB0",                2, 0},
+  {"lang",                             4, "\xE2\x9F\xA8",            3, 0},
+  {"RightTriangleBar",                16, "\xE2\xA7\x90",            3, 0},
+  {"Ouml",                             4, "\xC3\x96",                2, 1},
+  {"NotTildeFullEqual",               17, "\xE2\x89\x87",            3, 0},
+  {"vfr",                              3, "\xF0\x9D\x94\xB3",        4, 0},
+  {"lbbrk",                            5, "\xE2\x9D\xB2",            3, 0},
+  {"OElig",                            5, "\xC5\x92",                2, 0},
+  {"Uopf",                             4, "\xF0\x9D\x95\x8C",        4, 0},
+  {"csupe",                            5, "\xE2\xAB\x92",            3, 0},
+  {"roplus",                           6, "\xE2\xA8\xAE",            3, 0},
+  {"precsim",                          7, "\xE2\x89\xBE",            3, 0},
+  {"RightDownVectorBar",              18, "\xE2\xA5\x95",            3, 0},
+  {"yopf",                             4, "\xF0\x9D\x95\xAA",        4, 0},
+  {"NotLeftTriangleBar",              18, "\xE2\xA7\x8F\xCC\xB8",    5, 0},
+  {"bopf",                             4, "\xF0\x9D\x95\x93",        4, 0},
+  {"Bcy",                              3, "\xD0\x91",                2, 0},
+  {"udhar",                            5, "\xE2\xA5\xAE",            3, 0},
+  {"Uarr",                             4, "\xE2\x86\x9F",            3, 0},
+  {"iiint",                            5, "\xE2\x88\xAD",            3, 0},
+  {"dollar",                           6, "\x24",                    1, 0},
+  {"uogon",                            5, "\xC5\xB3",                2, 0},
+  {"Ycy",                              3, "\xD0\xAB",                2, 0},
+  {"VeryThinSpace",                   13, "\xE2\x80\x8A",            3, 0},
+  {"NotEqualTilde",                   13, "\xE2\x89\x82\xCC\xB8",    5, 0},
+  {"phi",                              3, "\xCF\x86",                2, 0},
+  {"Succeeds",                         8, "\xE2\x89\xBB",            3, 0},
+  {"digamma",                          7, "\xCF\x9D",                2, 0},
+  {"ecolon",                           6, "\xE2\x89\x95",            3, 0},
+  {"NoBreak",                          7, "\xE2\x81\xA0",            3, 0},
+  {"operp",                            5, "\xE2\xA6\xB9",            3, 0},
+  {"Qfr",                              3, "\xF0\x9D\x94\x94",        4, 0},
+  {"boxv",                             4, "\xE2\x94\x82",            3, 0},
+  {"gimel",                            5, "\xE2\x84\xB7",            3, 0},
+  {"Yuml",                             4, "\xC5\xB8",                2, 0},
+  {"gel",                              3, "\xE2\x8B\x9B",            3, 0},
+  {"frac25",                           6, "\xE2\x85\x96",            3, 0},
+  {"Bopf",                             4, "\xF0\x9D\x94\xB9",        4, 0},
+  {"uuarr",                            5, "\xE2\x87\x88",            3, 0},
+  {"apos",                             4, "\x27",                    1, 0},
+  {"timesbar",                         8, "\xE2\xA8\xB1",            3, 0},
+  {"cudarrl",                          7, "\xE2\xA4\xB8",            3, 0},
+  {"NotExists",                        9, "\xE2\x88\x84",            3, 0},
+  {"vangrt",                           6, "\xE2\xA6\x9C",            3, 0},
+  {"nbsp",                             4, "\xC2\xA0",                2, 1},
+  {"TSHcy",                            5, "\xD0\x8B",                2, 0},
+  {"NegativeMediumSpace",             19, "\xE2\x80\x8B",            3, 0},
+  {"NotEqual",                         8, "\xE2\x89\xA0",            3, 0},
+  {"cularr",                           6, "\xE2\x86\xB6",            3, 0},
+  {"backepsilon",                     11, "\xCF\xB6",                2, 0},
+  {"Vert",                             4, "\xE2\x80\x96",            3, 0},
+  {"LeftRightArrow",                  14, "\xE2\x86\x94",            3, 0},
+  {"para",                             4, "\xC2\xB6",                2, 1},
+  {"emacr",                            5, "\xC4\x93",                2, 0},
+  {"atilde",                           6, "\xC3\xA3",                2, 1},
+  {"measuredangle",                   13, "\xE2\x88\xA1",            3, 0},
+  {"lbrack",                           6, "\x5B",                    1, 0},
+  {"scsim",                            5, "\xE2\x89\xBF",            3, 0},
+  {"inodot",                           6, "\xC4\xB1",                2, 0},
+  {"loplus",                           6, "\xE2\xA8\xAD",            3, 0},
+  {"rdldhar",                          7, "\xE2\xA5\xA9",            3, 0},
+  {"Zcaron",                           6, "\xC5\xBD",                2, 0},
+  {"emsp14",                           6, "\xE2\x80\x85",            3, 0},
+  {"fltns",                            5, "\xE2\x96\xB1",            3, 0},
+  {"NewLine",                          7, "\x0A",                    1, 0},
+  {"Topf",                             4, "\xF0\x9D\x95\x8B",        4, 0},
+  {"iiiint",                           6, "\xE2\xA8\x8C",            3, 0},
+  {"capcap",                           6, "\xE2\xA9\x8B",            3, 0},
+  {"tdot",                             4, "\xE2\x83\x9B",            3, 0},
+  {"comp",                             4, "\xE2\x88\x81",            3, 0},
+  {"SquareIntersection",              18, "\xE2\x8A\x93",            3, 0},
+  {"subE",                             4, "\xE2\xAB\x85",            3, 0},
+  {"lharu",                            5, "\xE2\x86\xBC",            3, 0},
+  {"NegativeThinSpace",               17, "\xE2\x80\x8B",            3, 0},
+  {"oplus",                            5, "\xE2\x8A\x95",            3, 0},
+  {"NotNestedLessLess",               17, "\xE2\xAA\xA1\xCC\xB8",    5, 0},
+  {"DoubleLongLeftRightArrow",        24, "\xE2\x9F\xBA",            3, 0},
+  {"jcirc",                            5, "\xC4\xB5",                2, 0},
+  {"Sscr",                             4, "\xF0\x9D\x92\xAE",        4, 0},
+  {"Icirc",                            5, "\xC3\x8E",                2, 1},
+  {"Ncedil",                           6, "\xC5\x85",                2, 0},
+  {"Breve",                            5, "\xCB\x98",                2, 0},
+  {"rcedil",                           6, "\xC5\x97",                2, 0},
+  {"smallsetminus",                   13, "\xE2\x88\x96",            3, 0},
+  {"verbar",                           6, "\x7C",                    1, 0},
+  {"part",                             4, "\xE2\x88\x82",            3, 0},
+  {"Popf",                             4, "\xE2\x84\x99",            3, 0},
+  {"Nacute",                           6, "\xC5\x83",                2, 0},
+  {"wp",                               2, "\xE2\x84\x98",            3, 0},
+  {"mopf",                             4, "\xF0\x9D\x95\x9E",        4, 0},
+  {"caps",                             4, "\xE2\x88\xA9\xEF\xB8\x80", 6, 0},
+  {"Lt",                               2, "\xE2\x89\xAA",            3, 0},
+  {"square",                           6, "\xE2\x96\xA1",            3, 0},
+  {"bNot",                             4, "\xE2\xAB\xAD",            3, 0},
+  {"nsqsube",                          7, "\xE2\x8B\xA2",            3, 0},
+  {"isinv",                            5, "\xE2\x88\x88",            3, 0},
+  {"numsp",                            5, "\xE2\x80\x87",            3, 0},
+  {"Qscr",                             4, "\xF0\x9D\x92\xAC",        4, 0},
+  {"npreceq",                          7, "\xE2\xAA\xAF\xCC\xB8",    5, 0},
+  {"isinE",                            5, "\xE2\x8B\xB9",            3, 0},
+  {"flat",                             4, "\xE2\x99\xAD",            3, 0},
+  {"ltimes",                           6, "\xE2\x8B\x89",            3, 0},
+  {"gneqq",                            5, "\xE2\x89\xA9",            3, 0},
+  {"boxH",                             4, "\xE2\x95\x90",            3, 0},
+  {"ffr",                              3, "\xF0\x9D\x94\xA3",        4, 0},
+  {"COPY",                             4, "\xC2\xA9",                2, 1},
+  {"SupersetEqual",                   13, "\xE2\x8A\x87",            3, 0},
+  {"sc",                               2, "\xE2\x89\xBB",            3, 0},
+  {"rarrfs",                           6, "\xE2\xA4\x9E",            3, 0},
+  {"efr",                              3, "\xF0\x9D\x94\xA2",        4, 0},
+  {"boxdL",                            5, "\xE2\x95\x95",            3, 0},
+  {"bbrk",                             4, "\xE2\x8E\xB5",            3, 0},
+  {"phiv",                             4, "\xCF\x95",                2, 0},
+  {"blacktriangledown",               17, "\xE2\x96\xBE",            3, 0},
+  {"xharr",                            5, "\xE2\x9F\xB7",            3, 0},
+  {"lsquor",                           6, "\xE2\x80\x9A",            3, 0},
+  {"frown",                            5, "\xE2\x8C\xA2",            3, 0},
+  {"nLtv",                             4, "\xE2\x89\xAA\xCC\xB8",    5, 0},
+  {"nsc",                              3, "\xE2\x8A\x81",            3, 0},
+  {"nLt",                              3, "\xE2\x89\xAA\xE2\x83\x92", 6, 0},
+  {"starf",                            5, "\xE2\x98\x85",            3, 0},
+  {"YIcy",                             4, "\xD0\x87",                2, 0},
+  {"curvearrowright",                 15, "\xE2\x86\xB7",            3, 0},
+  {"af",                               2, "\xE2\x81\xA1",            3, 0},
+  {"odsold",                           6, "\xE2\xA6\xBC",            3, 0},
+  {"rtimes",                           6, "\xE2\x8B\x8A",            3, 0},
+  {"loang",                            5, "\xE2\x9F\xAC",            3, 0},
+  {"sqsupset",                         8, "\xE2\x8A\x90",            3, 0},
+  {"vartriangleleft",                 15, "\xE2\x8A\xB2",            3, 0},
+  {"aelig",                            5, "\xC3\xA6",                2, 1},
+  {"Nopf",                             4, "\xE2\x84\x95",            3, 0},
+  {"macr",                             4, "\xC2\xAF",                2, 1},
+  {"precapprox",                      10, "\xE2\xAA\xB7",            3, 0},
+  {"Jopf",                             4, "\xF0\x9D\x95\x81",        4, 0},
+  {"rdca",                             4, "\xE2\xA4\xB7",            3, 0},
+  {"lesdoto",                          7, "\xE2\xAA\x81",            3, 0},
+  {"pointint",                         8, "\xE2\xA8\x95",            3, 0},
+  {"nVDash",                           6, "\xE2\x8A\xAF",            3, 0},
+  {"triangleleft",                    12, "\xE2\x97\x83",            3, 0},
+  {"nbumpe",                           6, "\xE2\x89\x8F\xCC\xB8",    5, 0},
+  {"NonBreakingSpace",                16, "\xC2\xA0",                2, 0},
+  {"YAcy",                             4, "\xD0\xAF",                2, 0},
+  {"kcy",                              3, "\xD0\xBA",                2, 0},
+  {"hardcy",                           6, "\xD1\x8A",                2, 0},
+  {"lozf",                             4, "\xE2\xA7\xAB",            3, 0},
+  {"Dcy",                              3, "\xD0\x94",                2, 0},
+  {"Ncaron",                           6, "\xC5\x87",                2, 0},
+  {"Vscr",                             4, "\xF0\x9D\x92\xB1",        4, 0},
+  {"Cdot",                             4, "\xC4\x8A",                2, 0},
+  {"longleftrightarrow",              18, "\xE2\x9F\xB7",            3, 0},
+  {"lnap",                             4, "\xE2\xAA\x89",            3, 0},
+  {"circledast",                      10, "\xE2\x8A\x9B",            3, 0},
+  {"xopf",                             4, "\xF0\x9D\x95\xA9",        4, 0},
+  {"theta",                            5, "\xCE\xB8",                2, 0},
+  {"angmsdae",                         8, "\xE2\xA6\xAC",            3, 0},
+  {"nleqslant",                        9, "\xE2\xA9\xBD\xCC\xB8",    5, 0},
+  {"GJcy",                             4, "\xD0\x83",                2, 0},
+  {"Agrave",                           6, "\xC3\x80",                2, 1},
+  {"Mellintrf",                        9, "\xE2\x84\xB3",            3, 0},
+  {"VerticalBar",                     11, "\xE2\x88\xA3",            3, 0},
+  {"hyphen",                           6, "\xE2\x80\x90",            3, 0},
+  {"beta",                             4, "\xCE\xB2",                2, 0},
+  {"ast",                              3, "\x2A",                    1, 0},
+  {"squf",                             4, "\xE2\x96\xAA",            3, 0},
+  {"gscr",                             4, "\xE2\x84\x8A",            3, 0},
+  {"HumpDownHump",                    12, "\xE2\x89\x8E",            3, 0},
+  {"Esim",                             4, "\xE2\xA9\xB3",            3, 0},
+  {"check",                            5, "\xE2\x9C\x93",            3, 0},
+  {"Yscr",                             4, "\xF0\x9D\x92\xB4",        4, 0},
+  {"lesges",                           6, "\xE2\xAA\x93",            3, 0},
+  {"sqsube",                           6, "\xE2\x8A\x91",            3, 0},
+  {"oslash",                           6, "\xC3\xB8",                2, 1},
+  {"boxul",                            5, "\xE2\x94\x98",            3, 0},
+  {"wedbar",                           6, "\xE2\xA9\x9F",            3, 0},
+  {"IEcy",                             4, "\xD0\x95",                2, 0},
+  {"primes",                           6, "\xE2\x84\x99",            3, 0},
+  {"boxplus",                          7, "\xE2\x8A\x9E",            3, 0},
+  {"grave",                            5, "\x60",                    1, 0},
+  {"olcir",                            5, "\xE2\xA6\xBE",            3, 0},
+  {"nearhk",                           6, "\xE2\xA4\xA4",            3, 0},
+  {"Oacute",                           6, "\xC3\x93",                2, 1},
+  {"kjcy",                             4, "\xD1\x9C",                2, 0},
+  {"boxtimes",                         8, "\xE2\x8A\xA0",            3, 0},
+  {"Darr",                             4, "\xE2\x86\xA1",            3, 0},
+  {"Kscr",                             4, "\xF0\x9D\x92\xA6",        4, 0},
+  {"subplus",                          7, "\xE2\xAA\xBF",            3, 0},
+  {"Int",                              3, "\xE2\x88\xAC",            3, 0},
+  {"smt",                              3, "\xE2\xAA\xAA",            3, 0},
+  {"RightUpVectorBar",                16, "\xE2\xA5\x94",            3, 0},
+  {"uacute",                           6, "\xC3\xBA",                2, 1},
+  {"SquareSubset",                    12, "\xE2\x8A\x8F",            3, 0},
+  {"agrave",                           6, "\xC3\xA0",                2, 1},
+  {"dlcorn",                           6, "\xE2\x8C\x9E",            3, 0},
+  {"lparlt",                           6, "\xE2\xA6\x93",            3, 0},
+  {"deg",                              3, "\xC2\xB0",                2, 1},
+  {"Yacute",                           6, "\xC3\x9D",                2, 1},
+  {"ulcorn",                           6, "\xE2\x8C\x9C",            3, 0},
+  {"Downarrow",                        9, "\xE2\x87\x93",            3, 0},
+  {"thetav",                           6, "\xCF\x91",                2, 0},
+  {"rharul",                           6, "\xE2\xA5\xAC",            3, 0},
+  {"IJlig",                            5, "\xC4\xB2",                2, 0},
+  {"nvge",                             4, "\xE2\x89\xA5\xE2\x83\x92", 6, 0},
+  {"complement",                      10, "\xE2\x88\x81",            3, 0},
+  {"vDash",                            5, "\xE2\x8A\xA8",            3, 0},
+  {"eacute",                           6, "\xC3\xA9",                2, 1},
+  {"Tab",                              3, "\x09",                    1, 0},
+  {"doublebarwedge",                  14, "\xE2\x8C\x86",            3, 0},
+  {"ImaginaryI",                      10, "\xE2\x85\x88",            3, 0},
+  {"numero",                           6, "\xE2\x84\x96",            3, 0},
+  {"lap",                              3, "\xE2\xAA\x85",            3, 0},
+  {"Vee",                              3, "\xE2\x8B\x81",            3, 0},
+  {"Bscr",                             4, "\xE2\x84\xAC",            3, 0},
+  {"Pi",                               2, "\xCE\xA0",                2, 0},
+  {"xotime",                           6, "\xE2\xA8\x82",            3, 0},
+  {"Jcy",                              3, "\xD0\x99",                2, 0},
+  {"pcy",                              3, "\xD0\xBF",                2, 0},
+  {"plankv",                           6, "\xE2\x84\x8F",            3, 0},
+  {"DownArrowBar",                    12, "\xE2\xA4\x93",            3, 0},
+  {"lnE",                              3, "\xE2\x89\xA8",            3, 0},
+  {"nwarr",                            5, "\xE2\x86\x96",            3, 0},
+  {"mapstodown",                      10, "\xE2\x86\xA7",            3, 0},
+  {"frac45",                           6, "\xE2\x85\x98",            3, 0},
+  {"acd",                              3, "\xE2\x88\xBF",            3, 0},
+  {"supnE",                            5, "\xE2\xAB\x8C",            3, 0},
+  {"lvnE",                             4, "\xE2\x89\xA8\xEF\xB8\x80", 6, 0},
+  {"boxhU",                            5, "\xE2\x95\xA8",            3, 0},
+  {"rho",                              3, "\xCF\x81",                2, 0},
+  {"sub",                              3, "\xE2\x8A\x82",            3, 0},
+  {"RightAngleBracket",               17, "\xE2\x9F\xA9",            3, 0},
+  {"AMP",                              3, "\x26",                    1, 1},
+  {"lrcorner",                         8, "\xE2\x8C\x9F",            3, 0},
+  {"sharp",                            5, "\xE2\x99\xAF",            3, 0},
+  {"empty",                            5, "\xE2\x88\x85",            3, 0},
+  {"Vfr",                              3, "\xF0\x9D\x94\x99",        4, 0},
+  {"emsp",                             4, "\xE2\x80\x83",            3, 0},
+  {"ic",                               2, "\xE2\x81\xA3",            3, 0},
+  {"prcue",                            5, "\xE2\x89\xBC",            3, 0},
+  {"rtri",                             4, "\xE2\x96\xB9",            3, 0},
+  {"cirE",                             4, "\xE2\xA7\x83",            3, 0},
+  {"vrtri",                            5, "\xE2\x8A\xB3",            3, 0},
+  {"coprod",                           6, "\xE2\x88\x90",            3, 0},
+  {"mapstoleft",                      10, "\xE2\x86\xA4",            3, 0},
+  {"lrhard",                           6, "\xE2\xA5\xAD",            3, 0},
+  {"dtrif",                            5, "\xE2\x96\xBE",            3, 0},
+  {"nGt",                              3, "\xE2\x89\xAB\xE2\x83\x92", 6, 0},
+  {"Gammad",                           6, "\xCF\x9C",                2, 0},
+  {"NotTildeEqual",                   13, "\xE2\x89\x84",            3, 0},
+  {"gescc",                            5, "\xE2\xAA\xA9",            3, 0},
+  {"supne",                            5, "\xE2\x8A\x8B",            3, 0},
+  {"lhard",                            5, "\xE2\x86\xBD",            3, 0},
+  {"Dcaron",                           6, "\xC4\x8E",                2, 0},
+  {"ltrie",                            5, "\xE2\x8A\xB4",            3, 0},
+  {"Gfr",                              3, "\xF0\x9D\x94\x8A",        4, 0},
+  {"olt",                              3, "\xE2\xA7\x80",            3, 0},
+  {"rightrightarrows",                16, "\xE2\x87\x89",            3, 0},
+  {"DownLeftTeeVector",               17, "\xE2\xA5\x9E",            3, 0},
+  {"quot",                             4, "\x22",                    1, 1},
+  {"Mu",                               2, "\xCE\x9C",                2, 0},
+  {"hslash",                           6, "\xE2\x84\x8F",            3, 0},
+  {"jsercy",                           6, "\xD1\x98",                2, 0},
+  {"Del",                              3, "\xE2\x88\x87",            3, 0},
+  {"mumap",                            5, "\xE2\x8A\xB8",            3, 0},
+  {"sdotb",                            5, "\xE2\x8A\xA1",            3, 0},
+  {"larrlp",                           6, "\xE2\x86\xAB",            3, 0},
+  {"eng",                              3, "\xC5\x8B",                2, 0},
+  {"opar",                             4, "\xE2\xA6\xB7",            3, 0},
+  {"twoheadrightarrow",               17, "\xE2\x86\xA0",            3, 0},
+  {"MediumSpace",                     11, "\xE2\x81\x9F",            3, 0},
+  {"Gopf",                             4, "\xF0\x9D\x94\xBE",        4, 0},
+  {"uml",                              3, "\xC2\xA8",                2, 1},
+  {"ldquor",                           6, "\xE2\x80\x9E",            3, 0},
+  {"DownBreve",                        9, "\xCC\x91",                2, 0},
+  {"CounterClockwiseContourIntegral", 31, "\xE2\x88\xB3",            3, 0},
+  {"tridot",                           6, "\xE2\x97\xAC",            3, 0},
+  {"Rightarrow",                      10, "\xE2\x87\x92",            3, 0},
+  {"incare",                           6, "\xE2\x84\x85",            3, 0},
+  {"rdsh",                             4, "\xE2\x86\xB3",            3, 0},
+  {"ctdot",                            5, "\xE2\x8B\xAF",            3, 0},
+  {"blank",                            5, "\xE2\x90\xA3",            3, 0},
+  {"dscy",                             4, "\xD1\x95",                2, 0},
+  {"spar",                             4, "\xE2\x88\xA5",            3, 0},
+  {"gammad",                           6, "\xCF\x9D",                2, 0},
+  {"Ugrave",                           6, "\xC3\x99",                2, 1},
+  {"xfr",                              3, "\xF0\x9D\x94\xB5",        4, 0},
+  {"reals",                            5, "\xE2\x84\x9D",            3, 0},
+  {"EmptySmallSquare",                16, "\xE2\x97\xBB",            3, 0},
+  {"checkmark",                        9, "\xE2\x9C\x93",            3, 0},
+  {"phmmat",                           6, "\xE2\x84\xB3",            3, 0},
+  {"nvDash",                           6, "\xE2\x8A\xAD",            3, 0},
+  {"downdownarrows",                  14, "\xE2\x87\x8A",            3, 0},
+  {"Odblac",                           6, "\xC5\x90",                2, 0},
+  {"dzigrarr",                         8, "\xE2\x9F\xBF",            3, 0},
+  {"gopf",                             4, "\xF0\x9D\x95\x98",        4, 0},
+  {"nleq",                             4, "\xE2\x89\xB0",            3, 0},
+  {"rbarr",                            5, "\xE2\xA4\x8D",            3, 0},
+  {"xwedge",                           6, "\xE2\x8B\x80",            3, 0},
+  {"looparrowright",                  14, "\xE2\x86\xAC",            3, 0},
+  {"bigcap",                           6, "\xE2\x8B\x82",            3, 0},
+  {"CircleTimes",                     11, "\xE2\x8A\x97",            3, 0},
+  {"csube",                            5, "\xE2\xAB\x91",            3, 0},
+  {"lesseqgtr",                        9, "\xE2\x8B\x9A",            3, 0},
+  {"Emacr",                            5, "\xC4\x92",                2, 0},
+  {"thickapprox",                     11, "\xE2\x89\x88",            3, 0},
+  {"ShortRightArrow",                 15, "\xE2\x86\x92",            3, 0},
+  {"NotPrecedes",                     11, "\xE2\x8A\x80",            3, 0},
+  {"caron",                            5, "\xCB\x87",                2, 0},
+  {"ac",                               2, "\xE2\x88\xBE",            3, 0},
+  {"bscr",                             4, "\xF0\x9D\x92\xB7",        4, 0},
+  {"wfr",                              3, "\xF0\x9D\x94\xB4",        4, 0},
+  {"approx",                           6, "\xE2\x89\x88",            3, 0},
+  {"GreaterEqual",                    12, "\xE2\x89\xA5",            3, 0},
+  {"Kappa",                            5, "\xCE\x9A",                2, 0},
+  {"LeftDownVectorBar",               17, "\xE2\xA5\x99",            3, 0},
+  {"ascr",                             4, "\xF0\x9D\x92\xB6",        4, 0},
+  {"DownArrowUpArrow",                16, "\xE2\x87\xB5",            3, 0},
+  {"Zacute",                           6, "\xC5\xB9",                2, 0},
+  {"OverBrace",                        9, "\xE2\x8F\x9E",            3, 0},
+  {"Lang",                             4, "\xE2\x9F\xAA",            3, 0},
+  {"Sub",                              3, "\xE2\x8B\x90",            3, 0},
+  {"NotLessLess",                     11, "\xE2\x89\xAA\xCC\xB8",    5, 0},
+  {"OverBar",                          7, "\xE2\x80\xBE",            3, 0},
+  {"SOFTcy",                           6, "\xD0\xAC",                2, 0},
+  {"fork",                             4, "\xE2\x8B\x94",            3, 0},
+  {"par",                              3, "\xE2\x88\xA5",            3, 0},
+  {"Coproduct",                        9, "\xE2\x88\x90",            3, 0},
+  {"Gdot",                             4, "\xC4\xA0",                2, 0},
+  {"RightDownTeeVector",              18, "\xE2\xA5\x9D",            3, 0},
+  {"frac23",                           6, "\xE2\x85\x94",            3, 0},
+  {"Oslash",                           6, "\xC3\x98",                2, 1},
+  {"ensp",                             4, "\xE2\x80\x82",            3, 0},
+  {"subsup",                           6, "\xE2\xAB\x93",            3, 0},
+  {"frac12",                           6, "\xC2\xBD",                2, 1},
+  {"Lfr",                              3, "\xF0\x9D\x94\x8F",        4, 0},
+  {"straightphi",                     11, "\xCF\x95",                2, 0},
+  {"Barv",                             4, "\xE2\xAB\xA7",            3, 0},
+  {"boxur",                            5, "\xE2\x94\x94",            3, 0},
+  {"prime",                            5, "\xE2\x80\xB2",            3, 0},
+  {"ldrushar",                         8, "\xE2\xA5\x8B",            3, 0},
+  {"preccurlyeq",                     11, "\xE2\x89\xBC",            3, 0},
+  {"lcaron",                           6, "\xC4\xBE",                2, 0},
+  {"Scirc",                            5, "\xC5\x9C",                2, 0},
+  {"crarr",                            5, "\xE2\x86\xB5",            3, 0},
+  {"Hstrok",                           6, "\xC4\xA6",                2, 0},
+  {"vopf",                             4, "\xF0\x9D\x95\xA7",        4, 0},
+  {"LeftDoubleBracket",               17, "\xE2\x9F\xA6",            3, 0},
+  {"eplus",                            5, "\xE2\xA9\xB1",            3, 0},
+  {"oscr",                             4, "\xE2\x84\xB4",            3, 0},
+  {"vnsub",                            5, "\xE2\x8A\x82\xE2\x83\x92", 6, 0},
+  {"bigcup",                           6, "\xE2\x8B\x83",            3, 0},
+  {"vArr",                             4, "\xE2\x87\x95",            3, 0},
+  {"scnsim",                           6, "\xE2\x8B\xA9",            3, 0},
+  {"gtrsim",                           6, "\xE2\x89\xB3",            3, 0},
+  {"RoundImplies",                    12, "\xE2\xA5\xB0",            3, 0},
+  {"rightthreetimes",                 15, "\xE2\x8B\x8C",            3, 0},
+  {"topf",                             4, "\xF0\x9D\x95\xA5",        4, 0},
+  {"xi",                               2, "\xCE\xBE",                2, 0},
+  {"urcorn",                           6, "\xE2\x8C\x9D",            3, 0},
+  {"itilde",                           6, "\xC4\xA9",                2, 0},
+  {"angst",                            5, "\xC3\x85",                2, 0},
+  {"RightTeeVector",                  14, "\xE2\xA5\x9B",            3, 0},
+  {"iexcl",                            5, "\xC2\xA1",                2, 1},
+  {"euml",                             4, "\xC3\xAB",                2, 1},
+  {"sup",                              3, "\xE2\x8A\x83",            3, 0},
+  {"submult",                          7, "\xE2\xAB\x81",            3, 0},
+  {"Xopf",                             4, "\xF0\x9D\x95\x8F",        4, 0},
+  {"it",                               2, "\xE2\x81\xA2",            3, 0},
+  {"jcy",                              3, "\xD0\xB9",                2, 0},
+  {"DownLeftRightVector",             19, "\xE2\xA5\x90",            3, 0},
+  {"eth",                              3, "\xC3\xB0",                2, 1},
+  {"ncedil",                           6, "\xC5\x86",                2, 0},
+  {"NotLessTilde",                    12, "\xE2\x89\xB4",            3, 0},
+  {"lessdot",                          7, "\xE2\x8B\x96",            3, 0},
+  {"afr",                              3, "\xF0\x9D\x94\x9E",        4, 0},
+  {"LeftTeeArrow",                    12, "\xE2\x86\xA4",            3, 0},
+  {"profsurf",                         8, "\xE2\x8C\x93",            3, 0},
+  {"Poincareplane",                   13, "\xE2\x84\x8C",            3, 0},
+  {"latail",                           6, "\xE2\xA4\x99",            3, 0},
+  {"angmsdaa",                         8, "\xE2\xA6\xA8",            3, 0},
+  {"varsigma",                         8, "\xCF\x82",                2, 0},
+  {"backcong",                         8, "\xE2\x89\x8C",            3, 0},
+  {"boxVh",                            5, "\xE2\x95\xAB",            3, 0},
+  {"dscr",                             4, "\xF0\x9D\x92\xB9",        4, 0},
+  {"rightharpoonup",                  14, "\xE2\x87\x80",            3, 0},
+  {"otilde",                           6, "\xC3\xB5",                2, 1},
+  {"LeftVector",                      10, "\xE2\x86\xBC",            3, 0},
+  {"mp",                               2, "\xE2\x88\x93",            3, 0},
+  {"nfr",                              3, "\xF0\x9D\x94\xAB",        4, 0},
+  {"homtht",                           6, "\xE2\x88\xBB",            3, 0},
+  {"zwnj",                             4, "\xE2\x80\x8C",            3, 0},
+  {"utri",                             4, "\xE2\x96\xB5",            3, 0},
+  {"frac58",                           6, "\xE2\x85\x9D",            3, 0},
+  {"capbrcup",                         8, "\xE2\xA9\x89",            3, 0},
+  {"gcy",                              3, "\xD0\xB3",                2, 0},
+  {"swnwar",                           6, "\xE2\xA4\xAA",            3, 0},
+  {"Upsilon",                          7, "\xCE\xA5",                2, 0},
+  {"lt",                               2, "\x3C",                    1, 1},
+  {"epar",                             4, "\xE2\x8B\x95",            3, 0},
+  {"Mscr",                             4, "\xE2\x84\xB3",            3, 0},
+  {"lthree",                           6, "\xE2\x8B\x8B",            3, 0},
+  {"nabla",                            5, "\xE2\x88\x87",            3, 0},
+  {"ltri",                             4, "\xE2\x97\x83",            3, 0},
+  {"erDot",                            5, "\xE2\x89\x93",            3, 0},
+  {"UpTee",                            5, "\xE2\x8A\xA5",            3, 0},
+  {"boxbox",                           6, "\xE2\xA7\x89",            3, 0},
+  {"dHar",                             4, "\xE2\xA5\xA5",            3, 0},
+  {"boxDr",                            5, "\xE2\x95\x93",            3, 0},
+  {"mscr",                             4, "\xF0\x9D\x93\x82",        4, 0},
+  {"equest",                           6, "\xE2\x89\x9F",            3, 0},
+  {"ltrPar",                           6, "\xE2\xA6\x96",            3, 0},
+  {"nltri",                            5, "\xE2\x8B\xAA",            3, 0},
+  {"oelig",                            5, "\xC5\x93",                2, 0},
+  {"ll",                               2, "\xE2\x89\xAA",            3, 0},
+  {"iopf",                             4, "\xF0\x9D\x95\x9A",        4, 0},
+  {"shy",                              3, "\xC2\xAD",                2, 1},
+  {"nexists",                          7, "\xE2\x88\x84",            3, 0},
+  {"ccaron",                           6, "\xC4\x8D",                2, 0},
+  {"lfisht",                           6, "\xE2\xA5\xBC",            3, 0},
+  {"Tcaron",                           6, "\xC5\xA4",                2, 0},
+  {"Lstrok",                           6, "\xC5\x81",                2, 0},
+  {"supE",                             4, "\xE2\xAB\x86",            3, 0},
+  {"sscr",                             4, "\xF0\x9D\x93\x88",        4, 0},
+  {"larrsim",                          7, "\xE2\xA5\xB3",            3, 0},
+  {"HARDcy",                           6, "\xD0\xAA",                2, 0},
+  {"cir",                              3, "\xE2\x97\x8B",            3, 0},
+  {"lsquo",                            5, "\xE2\x80\x98",            3, 0},
+  {"rationals",                        9, "\xE2\x84\x9A",            3, 0},
+  {"zcaron",                           6, "\xC5\xBE",                2, 0},
+  {"Ntilde",                           6, "\xC3\x91",                2, 1},
+  {"nvHarr",                           6, "\xE2\xA4\x84",            3, 0},
+  {"Vopf",                             4, "\xF0\x9D\x95\x8D",        4, 0},
+  {"trpezium",                         8, "\xE2\x8F\xA2",            3, 0},
+  {"Mfr",                              3, "\xF0\x9D\x94\x90",        4, 0},
+  {"yacute",                           6, "\xC3\xBD",                2, 1},
+  {"ncap",                             4, "\xE2\xA9\x83",            3, 0},
+  {"vltri",                            5, "\xE2\x8A\xB2",            3, 0},
+  {"curlyeqprec",                     11, "\xE2\x8B\x9E",            3, 0},
+  {"Utilde",                           6, "\xC5\xA8",                2, 0},
+  {"rarrtl",                           6, "\xE2\x86\xA3",            3, 0},
+  {"napos",                            5, "\xC5\x89",                2, 0},
+  {"oint",                             4, "\xE2\x88\xAE",            3, 0},
+  {"GreaterTilde",                    12, "\xE2\x89\xB3",            3, 0},
+  {"dd",                               2, "\xE2\x85\x86",            3, 0},
+  {"ShortLeftArrow",                  14, "\xE2\x86\x90",            3, 0},
+  {"gnsim",                            5, "\xE2\x8B\xA7",            3, 0},
+  {"lE",                               2, "\xE2\x89\xA6",            3, 0},
+  {"Dashv",                            5, "\xE2\xAB\xA4",            3, 0},
+  {"Hcirc",                            5, "\xC4\xA4",                2, 0},
+  {"Hacek",                            5, "\xCB\x87",                2, 0},
+  {"dfr",                              3, "\xF0\x9D\x94\xA1",        4, 0},
+  {"Uogon",                            5, "\xC5\xB2",                2, 0},
+  {"imagpart",                         8, "\xE2\x84\x91",            3, 0},
+  {"sdote",                            5, "\xE2\xA9\xA6",            3, 0},
+  {"vsupne",                           6, "\xE2\x8A\x8B\xEF\xB8\x80", 6, 0},
+  {"tilde",                            5, "\xCB\x9C",                2, 0},
+  {"Jfr",                              3, "\xF0\x9D\x94\x8D",        4, 0},
+  {"nsube",                            5, "\xE2\x8A\x88",            3, 0},
+  {"Nscr",                             4, "\xF0\x9D\x92\xA9",        4, 0},
+  {"hoarr",                            5, "\xE2\x87\xBF",            3, 0},
+  {"lrarr",                            5, "\xE2\x87\x86",            3, 0},
+  {"glE",                              3, "\xE2\xAA\x92",            3, 0},
+  {"cong",                             4, "\xE2\x89\x85",            3, 0},
+  {"RightVectorBar",                  14, "\xE2\xA5\x93",            3, 0},
+  {"ccedil",                           6, "\xC3\xA7",                2, 1},
+  {"NotPrecedesEqual",                16, "\xE2\xAA\xAF\xCC\xB8",    5, 0},
+  {"ssmile",                           6, "\xE2\x8C\xA3",            3, 0},
+  {"ulcorner",                         8, "\xE2\x8C\x9C",            3, 0},
+  {"hookleftarrow",                   13, "\xE2\x86\xA9",            3, 0},
+  {"lArr",                             4, "\xE2\x87\x90",            3, 0},
+  {"iiota",                            5, "\xE2\x84\xA9",            3, 0},
+  {"zacute",                           6, "\xC5\xBA",                2, 0},
+  {"Rho",                              3, "\xCE\xA1",                2, 0},
+  {"InvisibleComma",                  14, "\xE2\x81\xA3",            3, 0},
+  {"SucceedsEqual",                   13, "\xE2\xAA\xB0",            3, 0},
+  {"rbrkslu",                          7, "\xE2\xA6\x90",            3, 0},
+  {"swarr",                            5, "\xE2\x86\x99",            3, 0},
+  {"succneqq",                         8, "\xE2\xAA\xB6",            3, 0},
+  {"DiacriticalAcute",                16, "\xC2\xB4",                2, 0},
+  {"cent",                             4, "\xC2\xA2",                2, 1},
+  {"leftarrow",                        9, "\xE2\x86\x90",            3, 0},
+  {"UnderBrace",                      10, "\xE2\x8F\x9F",            3, 0},
+  {"longrightarrow",                  14, "\xE2\x9F\xB6",            3, 0},
+  {"Aring",                            5, "\xC3\x85",                2, 1},
+  {"Assign",                           6, "\xE2\x89\x94",            3, 0},
+  {"ijlig",                            5, "\xC4\xB3",                2, 0},
+  {"NotLessGreater",                  14, "\xE2\x89\xB8",            3, 0},
+  {"UpDownArrow",                     11, "\xE2\x86\x95",            3, 0},
+  {"larrtl",                           6, "\xE2\x86\xA2",            3, 0},
+  {"ell",                              3, "\xE2\x84\x93",            3, 0},
+  {"Leftarrow",                        9, "\xE2\x87\x90",            3, 0},
+  {"Edot",                             4, "\xC4\x96",                2, 0},
+  {"scpolint",                         8, "\xE2\xA8\x93",            3, 0},
+  {"suphsub",                          7, "\xE2\xAB\x97",            3, 0},
+  {"UnderParenthesis",                16, "\xE2\x8F\x9D",            3, 0},
+  {"khcy",                             4, "\xD1\x85",                2, 0},
+  {"oast",                             4, "\xE2\x8A\x9B",            3, 0},
+  {"Rsh",                              3, "\xE2\x86\xB1",            3, 0},
+  {"bump",                             4, "\xE2\x89\x8E",            3, 0},
+  {"ThickSpace",                      10, "\xE2\x81\x9F\xE2\x80\x8A", 6, 0},
+  {"RightUpVector",                   13, "\xE2\x86\xBE",            3, 0},
+  {"ZeroWidthSpace",                  14, "\xE2\x80\x8B",            3, 0},
+  {"Dot",                              3, "\xC2\xA8",                2, 0},
+  {"beth",                             4, "\xE2\x84\xB6",            3, 0},
+  {"lAtail",                           6, "\xE2\xA4\x9B",            3, 0},
+  {"lopf",                             4, "\xF0\x9D\x95\x9D",        4, 0},
+  {"ufisht",                           6, "\xE2\xA5\xBE",            3, 0},
+  {"boxHd",                            5, "\xE2\x95\xA4",            3, 0},
+  {"gneq",                             4, "\xE2\xAA\x88",            3, 0},
+  {"Dfr",                              3, "\xF0\x9D\x94\x87",        4, 0},
+  {"piv",                              3, "\xCF\x96",                2, 0},
+  {"RightFloor",                      10, "\xE2\x8C\x8B",            3, 0},
+  {"yscr",                             4, "\xF0\x9D\x93\x8E",        4, 0},
+  {"twixt",                            5, "\xE2\x89\xAC",            3, 0},
+  {"LongLeftRightArrow",              18, "\xE2\x9F\xB7",            3, 0},
+  {"ucy",                              3, "\xD1\x83",                2, 0},
+  {"drbkarow",                         8, "\xE2\xA4\x90",            3, 0},
+  {"UpArrowDownArrow",                16, "\xE2\x87\x85",            3, 0},
+  {"Acirc",                            5, "\xC3\x82",                2, 1},
+  {"boxvr",                            5, "\xE2\x94\x9C",            3, 0},
+  {"NegativeVeryThinSpace",           21, "\xE2\x80\x8B",            3, 0},
+  {"Dstrok",                           6, "\xC4\x90",                2, 0},
+  {"ccupssm",                          7, "\xE2\xA9\x90",            3, 0},
+  {"chcy",                             4, "\xD1\x87",                2, 0},
+  {"Ifr",                              3, "\xE2\x84\x91",            3, 0},
+  {"upharpoonright",                  14, "\xE2\x86\xBE",            3, 0},
+  {"bsemi",                            5, "\xE2\x81\x8F",            3, 0},
+  {"nLeftrightarrow",                 15, "\xE2\x87\x8E",            3, 0},
+  {"sung",                             4, "\xE2\x99\xAA",            3, 0},
+  {"fallingdotseq",                   13, "\xE2\x89\x92",            3, 0},
+  {"fopf",                             4, "\xF0\x9D\x95\x97",        4, 0},
+  {"rbrke",                            5, "\xE2\xA6\x8C",            3, 0},
+  {"topbot",                           6, "\xE2\x8C\xB6",            3, 0},
+  {"drcorn",                           6, "\xE2\x8C\x9F",            3, 0},
+  {"lvertneqq",                        9, "\xE2\x89\xA8\xEF\xB8\x80", 6, 0},
+  {"imacr",                            5, "\xC4\xAB",                2, 0},
+  {"NotNestedGreaterGreater",         23, "\xE2\xAA\xA2\xCC\xB8",    5, 0},
+  {"ucirc",                            5, "\xC3\xBB",                2, 1},
+  {"frac15",                           6, "\xE2\x85\x95",            3, 0},
+  {"bsim",                             4, "\xE2\x88\xBD",            3, 0},
+  {"NotGreaterGreater",               17, "\xE2\x89\xAB\xCC\xB8",    5, 0},
+  {"origof",                           6, "\xE2\x8A\xB6",            3, 0},
+  {"lsimg",                            5, "\xE2\xAA\x8F",            3, 0},
+  {"SquareSupersetEqual",             19, "\xE2\x8A\x92",            3, 0},
+  {"subsim",                           6, "\xE2\xAB\x87",            3, 0},
+  {"acE",                              3, "\xE2\x88\xBE\xCC\xB3",    5, 0},
+  {"scy",                              3, "\xD1\x81",                2, 0},
+  {"Wopf",                             4, "\xF0\x9D\x95\x8E",        4, 0},
+  {"subrarr",                          7, "\xE2\xA5\xB9",            3, 0},
+  {"apid",                             4, "\xE2\x89\x8B",            3, 0},
+  {"ngt",                              3, "\xE2\x89\xAF",            3, 0},
+  {"gesdotol",                         8, "\xE2\xAA\x84",            3, 0},
+  {"nRightarrow",                     11, "\xE2\x87\x8F",            3, 0},
+  {"Im",                               2, "\xE2\x84\x91",            3, 0},
+  {"boxVl",                            5, "\xE2\x95\xA2",            3, 0},
+  {"lfloor",                           6, "\xE2\x8C\x8A",            3, 0},
+  {"angle",                            5, "\xE2\x88\xA0",            3, 0},
+  {"bowtie",                           6, "\xE2\x8B\x88",            3, 0},
+  {"ZHcy",                             4, "\xD0\x96",                2, 0},
+  {"mapsto",                           6, "\xE2\x86\xA6",            3, 0},
+  {"ltdot",                            5, "\xE2\x8B\x96",            3, 0},
+  {"bcong",                            5, "\xE2\x89\x8C",            3, 0},
+  {"lat",                              3, "\xE2\xAA\xAB",            3, 0},
+  {"Escr",                             4, "\xE2\x84\xB0",            3, 0},
+  {"DotDot",                           6, "\xE2\x83\x9C",            3, 0},
+  {"bcy",                              3, "\xD0\xB1",                2, 0},
+  {"Sopf",                             4, "\xF0\x9D\x95\x8A",        4, 0},
+  {"because",                          7, "\xE2\x88\xB5",            3, 0},
+  {"harrw",                            5, "\xE2\x86\xAD",            3, 0},
+  {"Mopf",                             4, "\xF0\x9D\x95\x84",        4, 0},
+  {"Ograve",                           6, "\xC3\x92",                2, 1},
+  {"nisd",                             4, "\xE2\x8B\xBA",            3, 0},
+  {"angmsdad",                         8, "\xE2\xA6\xAB",            3, 0},
+  {"minus",                            5, "\xE2\x88\x92",            3, 0},
+  {"searhk",                           6, "\xE2\xA4\xA5",            3, 0},
+  {"disin",                            5, "\xE2\x8B\xB2",            3, 0},
+  {"nvlArr",                           6, "\xE2\xA4\x82",            3, 0},
+  {"aleph",                            5, "\xE2\x84\xB5",            3, 0},
+  {"real",                             4, "\xE2\x84\x9C",            3, 0},
+  {"Gcedil",                           6, "\xC4\xA2",                2, 0},
+  {"nu",                               2, "\xCE\xBD",                2, 0},
+  {"lagran",                           6, "\xE2\x84\x92",            3, 0},
+  {"prnap",                            5, "\xE2\xAA\xB9",            3, 0},
+  {"ugrave",                           6, "\xC3\xB9",                2, 1},
+  {"Yfr",                              3, "\xF0\x9D\x94\x9C",        4, 0},
+  {"seArr",                            5, "\xE2\x87\x98",            3, 0},
+  {"Wscr",                             4, "\xF0\x9D\x92\xB2",        4, 0},
+  {"pound",                            5, "\xC2\xA3",                2, 1},
+  {"nrightarrow",                     11, "\xE2\x86\x9B",            3, 0},
+  {"urcrop",                           6, "\xE2\x8C\x8E",            3, 0},
+  {"LeftUpDownVector",                16, "\xE2\xA5\x91",            3, 0},
+  {"DD",                               2, "\xE2\x85\x85",            3, 0},
+  {"lg",                               2, "\xE2\x89\xB6",            3, 0},
+  {"rhard",                            5, "\xE2\x87\x81",            3, 0},
+  {"Oscr",                             4, "\xF0\x9D\x92\xAA",        4, 0},
+  {"tint",                             4, "\xE2\x88\xAD",            3, 0},
+  {"uharr",                            5, "\xE2\x86\xBE",            3, 0},
+  {"gE",                               2, "\xE2\x89\xA7",            3, 0},
+  {"capdot",                           6, "\xE2\xA9\x80",            3, 0},
+  {"asympeq",                          7, "\xE2\x89\x8D",            3, 0},
+  {"block",                            5, "\xE2\x96\x88",            3, 0},
+  {"NotSupersetEqual",                16, "\xE2\x8A\x89",            3, 0},
+  {"urtri",                            5, "\xE2\x97\xB9",            3, 0},
+  {"circ",                             4, "\xCB\x86",                2, 0},
+  {"bbrktbrk",                         8, "\xE2\x8E\xB6",            3, 0},
+  {"lpar",                             4, "\x28",                    1, 0},
+  {"gtrdot",                           6, "\xE2\x8B\x97",            3, 0},
+  {"Iscr",                             4, "\xE2\x84\x90",            3, 0},
+  {"NotSubsetEqual",                  14, "\xE2\x8A\x88",            3, 0},
+  {"spadesuit",                        9, "\xE2\x99\xA0",            3, 0},
+  {"profalar",                         8, "\xE2\x8C\xAE",            3, 0},
+  {"rightsquigarrow",                 15, "\xE2\x86\x9D",            3, 0},
+  {"rarr",                             4, "\xE2\x86\x92",            3, 0},
+  {"curlywedge",                      10, "\xE2\x8B\x8F",            3, 0},
+  {"Pcy",                              3, "\xD0\x9F",                2, 0},
+  {"Proportional",                    12, "\xE2\x88\x9D",            3, 0},
+  {"hcirc",                            5, "\xC4\xA5",                2, 0},
+  {"upsi",                             4, "\xCF\x85",                2, 0},
+  {"hairsp",                           6, "\xE2\x80\x8A",            3, 0},
+  {"SquareSuperset",                  14, "\xE2\x8A\x90",            3, 0},
+  {"dotplus",                          7, "\xE2\x88\x94",            3, 0},
+  {"RightDownVector",                 15, "\xE2\x87\x82",            3, 0},
+  {"dwangle",                          7, "\xE2\xA6\xA6",            3, 0},
+  {"simg",                             4, "\xE2\xAA\x9E",            3, 0},
+  {"DoubleUpDownArrow",               17, "\xE2\x87\x95",            3, 0},
+  {"elinters",                         8, "\xE2\x8F\xA7",            3, 0},
+  {"Cross",                            5, "\xE2\xA8\xAF",            3, 0},
+  {"dashv",                            5, "\xE2\x8A\xA3",            3, 0},
+  {"euro",                             4, "\xE2\x82\xAC",            3, 0},
+  {"raquo",                            5, "\xC2\xBB",                2, 1},
+  {"awint",                            5, "\xE2\xA8\x91",            3, 0},
+  {"oline",                            5, "\xE2\x80\xBE",            3, 0},
+  {"les",                              3, "\xE2\xA9\xBD",            3, 0},
+  {"SubsetEqual",                     11, "\xE2\x8A\x86",            3, 0},
+  {"complexes",                        9, "\xE2\x84\x82",            3, 0},
+  {"alpha",                            5, "\xCE\xB1",                2, 0},
+  {"REG",                              3, "\xC2\xAE",                2, 1},
+  {"nvap",                             4, "\xE2\x89\x8D\xE2\x83\x92", 6, 0},
+  {"quote",                            5, "\x22",                    1, 1},
+  {"wscr",                             4, "\xF0\x9D\x93\x8C",        4, 0},
+  {"precnapprox",                     11, "\xE2\xAA\xB9",            3, 0},
+  {"lrm",                              3, "\xE2\x80\x8E",            3, 0},
+  {"NotSucceeds",                     11, "\xE2\x8A\x81",            3, 0},
+  {"trianglerighteq",                 15, "\xE2\x8A\xB5",            3, 0},
+  {"orderof",                          7, "\xE2\x84\xB4",            3, 0},
+  {"circleddash",                     11, "\xE2\x8A\x9D",            3, 0},
+  {"vscr",                             4, "\xF0\x9D\x93\x8B",        4, 0},
+  {"Map",                              3, "\xE2\xA4\x85",            3, 0},
+  {"blacktriangleright",              18, "\xE2\x96\xB8",            3, 0},
+  {"sqcaps",                           6, "\xE2\x8A\x93\xEF\xB8\x80", 6, 0},
+  {"rarrb",                            5, "\xE2\x87\xA5",            3, 0},
+  {"bigoplus",                         8, "\xE2\xA8\x81",            3, 0},
+  {"aogon",                            5, "\xC4\x85",                2, 0},
+  {"dcy",                              3, "\xD0\xB4",                2, 0},
+  {"nshortparallel",                  14, "\xE2\x88\xA6",            3, 0},
+  {"iscr",                             4, "\xF0\x9D\x92\xBE",        4, 0},
+  {"RightUpDownVector",               17, "\xE2\xA5\x8F",            3, 0},
+  {"amp",                              3, "\x26",                    1, 1},
+  {"imath",                            5, "\xC4\xB1",                2, 0},
+  {"Oopf",                             4, "\xF0\x9D\x95\x86",        4, 0},
+  {"simlE",                            5, "\xE2\xAA\x9F",            3, 0},
+  {"ddagger",                          7, "\xE2\x80\xA1",            3, 0},
+  {"bigstar",                          7, "\xE2\x98\x85",            3, 0},
+  {"plustwo",                          7, "\xE2\xA8\xA7",            3, 0},
+  {"subedot",                          7, "\xE2\xAB\x83",            3, 0},
+  {"dsol",                             4, "\xE2\xA7\xB6",            3, 0},
+  {"LeftTriangleBar",                 15, "\xE2\xA7\x8F",            3, 0},
+  {"frac78",                           6, "\xE2\x85\x9E",            3, 0},
+  {"Acy",                              3, "\xD0\x90",                2, 0},
+  {"sup2",                             4, "\xC2\xB2",                2, 1},
+  {"xvee",                             4, "\xE2\x8B\x81",            3, 0},
+  {"nwarhk",                           6, "\xE2\xA4\xA3",            3, 0},
+  {"smtes",                            5, "\xE2\xAA\xAC\xEF\xB8\x80", 6, 0},
+  {"GreaterFullEqual",                16, "\xE2\x89\xA7",            3, 0},
+  {"isin",                             4, "\xE2\x88\x88",            3, 0},
+  {"gla",                              3, "\xE2\xAA\xA5",            3, 0},
+  {"kappav",                           6, "\xCF\xB0",                2, 0},
+  {"cirfnint",                         8, "\xE2\xA8\x90",            3, 0},
+  {"lltri",                            5, "\xE2\x97\xBA",            3, 0},
+  {"ENG",                              3, "\xC5\x8A",                2, 0},
+  {"eqslantgtr",                      10, "\xE2\xAA\x96",            3, 0},
+  {"barwedge",                         8, "\xE2\x8C\x85",            3, 0},
+  {"QUOT",                             4, "\x22",                    1, 1},
+  {"supset",                           6, "\xE2\x8A\x83",            3, 0},
+  {"prnsim",                           6, "\xE2\x8B\xA8",            3, 0},
+  {"quatint",                          7, "\xE2\xA8\x96",            3, 0},
+  {"nopf",                             4, "\xF0\x9D\x95\x9F",        4, 0},
+  {"gtrarr",                           6, "\xE2\xA5\xB8",            3, 0},
+  {"blacksquare",                     11, "\xE2\x96\xAA",            3, 0},
+  {"pm",                               2, "\xC2\xB1",                2, 0},
+  {"nsucceq",                          7, "\xE2\xAA\xB0\xCC\xB8",    5, 0},
+  {"smile",                            5, "\xE2\x8C\xA3",            3, 0},
+  {"triangleq",                        9, "\xE2\x89\x9C",            3, 0},
+  {"mid",                              3, "\xE2\x88\xA3",            3, 0},
+  {"supsetneq",                        9, "\xE2\x8A\x8B",            3, 0},
+  {"rightharpoondown",                16, "\xE2\x87\x81",            3, 0},
+  {"auml",                             4, "\xC3\xA4",                2, 1},
+  {"lrhar",                            5, "\xE2\x87\x8B",            3, 0},
+  {"oror",                             4, "\xE2\xA9\x96",            3, 0},
+  {"cuwed",                            5, "\xE2\x8B\x8F",            3, 0},
+  {"ApplyFunction",                   13, "\xE2\x81\xA1",            3, 0},
+  {"abreve",                           6, "\xC4\x83",                2, 0},
+  {"ordf",                             4, "\xC2\xAA",                2, 1},
+  {"updownarrow",                     11, "\xE2\x86\x95",            3, 0},
+  {"DoubleLeftArrow",                 15, "\xE2\x87\x90",            3, 0},
+  {"comma",                            5, "\x2C",                    1, 0},
+  {"Eogon",                            5, "\xC4\x98",                2, 0},
+  {"Amacr",                            5, "\xC4\x80",                2, 0},
+  {"shcy",                             4, "\xD1\x88",                2, 0},
+  {"Vvdash",                           6, "\xE2\x8A\xAA",            3, 0},
+  {"EqualTilde",                      10, "\xE2\x89\x82",            3, 0},
+  {"larrb",                            5, "\xE2\x87\xA4",            3, 0},
+  {"GT",                               2, "\x3E",                    1, 1},
+  {"capcup",                           6, "\xE2\xA9\x87",            3, 0},
+  {"prurel",                           6, "\xE2\x8A\xB0",            3, 0},
+  {"fnof",                             4, "\xC6\x92",                2, 0},
+  {"Mcy",                              3, "\xD0\x9C",                2, 0},
+  {"Superset",                         8, "\xE2\x8A\x83",            3, 0},
+  {"Implies",                          7, "\xE2\x87\x92",            3, 0},
+  {"rsquo",                            5, "\xE2\x80\x99",            3, 0},
+  {"Otimes",                           6, "\xE2\xA8\xB7",            3, 0},
+  {"quaternions",                     11, "\xE2\x84\x8D",            3, 0},
+  {"aopf",                             4, "\xF0\x9D\x95\x92",        4, 0},
+  {"NotGreaterEqual",                 15, "\xE2\x89\xB1",            3, 0},
+  {"cuesc",                            5, "\xE2\x8B\x9F",            3, 0},
+  {"isinsv",                           6, "\xE2\x8B\xB3",            3, 0},
+  {"prE",                              3, "\xE2\xAA\xB3",            3, 0},
+  {"Vdashl",                           6, "\xE2\xAB\xA6",            3, 0},
+  {"Fouriertrf",                      10, "\xE2\x84\xB1",            3, 0},
+  {"Scaron",                           6, "\xC5\xA0",                2, 0},
+  {"gtcir",                            5, "\xE2\xA9\xBA",            3, 0},
+  {"equivDD",                          7, "\xE2\xA9\xB8",            3, 0},
+  {"easter",                           6, "\xE2\xA9\xAE",            3, 0},
+  {"blk34",                            5, "\xE2\x96\x93",            3, 0},
+  {"gtreqqless",                      10, "\xE2\xAA\x8C",            3, 0},
+  {"ReverseUpEquilibrium",            20, "\xE2\xA5\xAF",            3, 0},
+  {"ShortDownArrow",                  14, "\xE2\x86\x93",            3, 0},
+  {"UpTeeArrow",                      10, "\xE2\x86\xA5",            3, 0},
+  {"boxV",                             4, "\xE2\x95\x91",            3, 0},
+  {"gEl",                              3, "\xE2\xAA\x8C",            3, 0},
+  {"lobrk",                            5, "\xE2\x9F\xA6",            3, 0},
+  {"zscr",                             4, "\xF0\x9D\x93\x8F",        4, 0},
+  {"xcirc",                            5, "\xE2\x97\xAF",            3, 0},
+  {"lcy",                              3, "\xD0\xBB",                2, 0},
+  {"Nfr",                              3, "\xF0\x9D\x94\x91",        4, 0},
+  {"gamma",                            5, "\xCE\xB3",                2, 0},
+  {"InvisibleTimes",                  14, "\xE2\x81\xA2",            3, 0},
+  {"leftharpoonup",                   13, "\xE2\x86\xBC",            3, 0},
+  {"curarr",                           6, "\xE2\x86\xB7",            3, 0},
+  {"angsph",                           6, "\xE2\x88\xA2",            3, 0},
+  {"eparsl",                           6, "\xE2\xA7\xA3",            3, 0},
+  {"ohbar",                            5, "\xE2\xA6\xB5",            3, 0},
+  {"varepsilon",                      10, "\xCF\xB5",                2, 0},
+  {"wr",                               2, "\xE2\x89\x80",            3, 0},
+  {"iogon",                            5, "\xC4\xAF",                2, 0},
+  {"rceil",                            5, "\xE2\x8C\x89",            3, 0},
+  {"longleftarrow",                   13, "\xE2\x9F\xB5",            3, 0},
+  {"Rarrtl",                           6, "\xE2\xA4\x96",            3, 0},
+  {"supseteq",                         8, "\xE2\x8A\x87",            3, 0},
+  {"seswar",                           6, "\xE2\xA4\xA9",            3, 0},
+  {"Sup",                              3, "\xE2\x8B\x91",            3, 0},
+  {"Imacr",                            5, "\xC4\xAA",                2, 0},
+  {"equiv",                            5, "\xE2\x89\xA1",            3, 0},
+  {"rfisht",                           6, "\xE2\xA5\xBD",            3, 0},
+  {"ETH",                              3, "\xC3\x90",                2, 1},
+  {"nprcue",                           6, "\xE2\x8B\xA0",            3, 0},
+  {"ncup",                             4, "\xE2\xA9\x82",            3, 0},
+  {"sstarf",                           6, "\xE2\x8B\x86",            3, 0},
+  {"notnivc",                          7, "\xE2\x8B\xBD",            3, 0},
+  {"Beta",                             4, "\xCE\x92",                2, 0},
+  {"sqsupseteq",                      10, "\xE2\x8A\x92",            3, 0},
+  {"qprime",                           6, "\xE2\x81\x97",            3, 0},
+  {"Conint",                           6, "\xE2\x88\xAF",            3, 0},
+  {"Uscr",                             4, "\xF0\x9D\x92\xB0",        4, 0},
+  {"angmsdag",                         8, "\xE2\xA6\xAE",            3, 0},
+  {"LeftAngleBracket",                16, "\xE2\x9F\xA8",            3, 0},
+  {"boxHu",                            5, "\xE2\x95\xA7",            3, 0},
+  {"LeftUpVectorBar",                 15, "\xE2\xA5\x98",            3, 0},
+  {"mcomma",                           6, "\xE2\xA8\xA9",            3, 0},
+  {"equals",                           6, "\x3D",                    1, 0},
+  {"hfr",                              3, "\xF0\x9D\x94\xA5",        4, 0},
+  {"gap",                              3, "\xE2\xAA\x86",            3, 0},
+  {"Psi",                              3, "\xCE\xA8",                2, 0},
+  {"lmoust",                           6, "\xE2\x8E\xB0",            3, 0},
+  {"vsubnE",                           6, "\xE2\xAB\x8B\xEF\xB8\x80", 6, 0},
+  {"nsime",                            5, "\xE2\x89\x84",            3, 0},
+  {"gbreve",                           6, "\xC4\x9F",                2, 0},
+  {"CapitalDifferentialD",            20, "\xE2\x85\x85",            3, 0},
+  {"apE",                              3, "\xE2\xA9\xB0",            3, 0},
+  {"Zeta",                             4, "\xCE\x96",                2, 0},
+  {"uharl",                            5, "\xE2\x86\xBF",            3, 0},
+  {"sigmav",                           6, "\xCF\x82",                2, 0},
+  {"Ucirc",                            5, "\xC3\x9B",                2, 1},
+  {"times",                            5, "\xC3\x97",                2, 1},
+  {"qscr",                             4, "\xF0\x9D\x93\x86",        4, 0},
+  {"loarr",                            5, "\xE2\x87\xBD",            3, 0},
+  {"PartialD",                         8, "\xE2\x88\x82",            3, 0},
+  {"swarrow",                          7, "\xE2\x86\x99",            3, 0},
+  {"blacktriangleleft",               17, "\xE2\x97\x82",            3, 0},
+  {"udarr",                            5, "\xE2\x87\x85",            3, 0},
+  {"OverParenthesis",                 15, "\xE2\x8F\x9C",            3, 0},
+  {"napprox",                          7, "\xE2\x89\x89",            3, 0},
+  {"ogt",                              3, "\xE2\xA7\x81",            3, 0},
+  {"DoubleLongLeftArrow",             19, "\xE2\x9F\xB8",            3, 0},
+  {"lurdshar",                         8, "\xE2\xA5\x8A",            3, 0},
+  {"omega",                            5, "\xCF\x89",                2, 0},
+  {"lneqq",                            5, "\xE2\x89\xA8",            3, 0},
+  {"cacute",                           6, "\xC4\x87",                2, 0},
+  {"softcy",                           6, "\xD1\x8C",                2, 0},
+  {"darr",                             4, "\xE2\x86\x93",            3, 0},
+  {"lbarr",                            5, "\xE2\xA4\x8C",            3, 0},
+  {"lsim",                             4, "\xE2\x89\xB2",            3, 0},
+  {"olarr",                            5, "\xE2\x86\xBA",            3, 0},
+  {"escr",                             4, "\xE2\x84\xAF",            3, 0},
+  {"ncaron",                           6, "\xC5\x88",                2, 0},
+  {"ropf",                             4, "\xF0\x9D\x95\xA3",        4, 0},
+  {"frac35",                           6, "\xE2\x85\x97",            3, 0},
+  {"ltcir",                            5, "\xE2\xA9\xB9",            3, 0},
+  {"nsupe",                            5, "\xE2\x8A\x89",            3, 0},
+  {"UpperLeftArrow",                  14, "\xE2\x86\x96",            3, 0},
+  {"gtreqless",                        9, "\xE2\x8B\x9B",            3, 0},
+  {"NotTildeTilde",                   13, "\xE2\x89\x89",            3, 0},
+  {"phone",                            5, "\xE2\x98\x8E",            3, 0},
+  {"ltrif",                            5, "\xE2\x97\x82",            3, 0},
+  {"xoplus",                           6, "\xE2\xA8\x81",            3, 0},
+  {"bemptyv",                          7, "\xE2\xA6\xB0",            3, 0},
+  {"blk12",                            5, "\xE2\x96\x92",            3, 0},
+  {"dfisht",                           6, "\xE2\xA5\xBF",            3, 0},
+  {"gtrapprox",                        9, "\xE2\xAA\x86",            3, 0},
+  {"reg",                              3, "\xC2\xAE",                2, 1},
+  {"Intersection",                    12, "\xE2\x8B\x82",            3, 0},
+  {"bigwedge",                         8, "\xE2\x8B\x80",            3, 0},
+  {"sqsupe",                           6, "\xE2\x8A\x92",            3, 0},
+  {"smeparsl",                         8, "\xE2\xA7\xA4",            3, 0},
+  {"uarr",                             4, "\xE2\x86\x91",            3, 0},
+  {"eopf",                             4, "\xF0\x9D\x95\x96",        4, 0},
+  {"ldca",                             4, "\xE2\xA4\xB6",            3, 0},
+  {"subsetneq",                        9, "\xE2\x8A\x8A",            3, 0},
+  {"doteqdot",                         8, "\xE2\x89\x91",            3, 0},
+  {"Uuml",                             4, "\xC3\x9C",                2, 1},
+  {"sfrown",                           6, "\xE2\x8C\xA2",            3, 0},
+  {"nrtrie",                           6, "\xE2\x8B\xAD",            3, 0},
+  {"LeftTeeVector",                   13, "\xE2\xA5\x9A",            3, 0},
+  {"cire",                             4, "\xE2\x89\x97",            3, 0},
+  {"angzarr",                          7, "\xE2\x8D\xBC",            3, 0},
+  {"notnivb",                          7, "\xE2\x8B\xBE",            3, 0},
+  {"emptyset",                         8, "\xE2\x88\x85",            3, 0},
+  {"CHcy",                             4, "\xD0\xA7",                2, 0},
+  {"plusdo",                           6, "\xE2\x88\x94",            3, 0},
+  {"CircleDot",                        9, "\xE2\x8A\x99",            3, 0},
+  {"subseteq",                         8, "\xE2\x8A\x86",            3, 0},
+  {"nsucc",                            5, "\xE2\x8A\x81",            3, 0},
+  {"SquareSubsetEqual",               17, "\xE2\x8A\x91",            3, 0},
+  {"ngeqq",                            5, "\xE2\x89\xA7\xCC\xB8",    5, 0},
+  {"prsim",                            5, "\xE2\x89\xBE",            3, 0},
+  {"succnapprox",                     11, "\xE2\xAA\xBA",            3, 0},
+  {"nsim",                             4, "\xE2\x89\x81",            3, 0},
+};
+
+static const unsigned short aHtmlEntitySeed[1063] = {
+        9,     6,    10,     6,     3,     0,     2,     1,     0,    10,
+        1,     0,     2,     4,     2,     1,     0,     6,     4,     2,
+        0,     1,    31,     3,     6,     2,     7,     1,     1,     3,
+        6,     1,    11,     7,     6,     5,     2,     6,     0,     1,
+        0,     5,    18,     1,    26,     0,     2,    27,     0,     2,
+        0,     0,     0,     4,     8,    15,     1,    11,    17,     0,
+       16,     2,    41,     5,     1,     3,    19,    12,    12,     0,
+        8,    12,     7,     0,     1,     0,     2,     6,     4,    19,
+        5,     1,     1,    27,     0,     4,     4,     1,     0,     5,
+       12,     5,     2,     5,     4,     5,     1,    21,     0,    10,
+       12,     1,     1,     4,     9,     2,    12,    13,     5,    21,
+        4,     2,     1,     8,     6,     9,    10,     1,     1,     2,
+        3,    10,     3,     1,     1,     4,     1,     0,    42,     1,
+        2,     2,     8,    15,     2,     2,    26,     1,     0,     1,
+        1,     7,     4,   126,    14,     2,     1,     6,     2,     3,
+        3,     3,     1,    11,     2,     1,    17,    54,    18,     2,
+        5,     4,     2,    10,     1,    43,     2,    23,     1,     1,
+        2,     9,    60,    25,     2,     2,    34,     0,     8,     2,
+        3,     6,     3,     2,     0,    11,     4,     2,    32,     3,
+        0,     4,     0,     9,     3,     0,    11,     3,     4,    11,
+       15,     1,    11,    48,     1,     1,    22,     7,     1,     6,
+        0,     0,     5,     3,     4,     0,     9,     6,     7,    16,
+        3,     9,     2,     0,     3,     3,     5,     7,     1,    16,
+        4,     2,     0,     3,     3,    24,     6,     3,     5,    65,
+       21,    21,     1,     2,     7,     4,     2,     7,     2,     0,
+        1,     2,     4,    28,     4,     0,    43,    27,    14,    18,
+        2,     4,     1,     0,     5,     0,    17,     3,     8,    21,
+       13,     2,     0,    10,    11,     1,     0,     6,     0,     3,
+        4,     1,     0,    82,     7,     0,    77,     6,     2,     5,
+        1,     7,     1,     2,     2,     3,     0,     7,    18,     0,
+        6,    20,     7,     0,     0,     2,    15,    79,     1,    65,
+       32,     4,     0,     0,     1,     1,    14,    22,     1,     2,
+        0,    21,     0,     6,     0,     5,     0,     1,    10,     1,
+        9,     0,     7,     0,     1,     6,     4,     7,     0,    17,
+        1,     2,     3,     4,    15,     7,     0,     2,     0,     0,
+       48,     3,     3,    69,    14,    17,    14,     0,    65,     9,
+        5,    15,     3,     9,    12,     0,     8,     1,    18,     1,
+        9,     2,    17,     2,    48,     1,     1,     0,    77,    54,
+       58,     5,    16,     6,     0,     0,     6,    15,     9,     3,
+      106,    28,     5,    10,     1,     6,     0,     1,    27,     5,
+        1,     2,     8,     7,    18,     5,     5,     5,     7,     1,
+       19,     1,    58,    18,     0,     0,     9,     5,     4,    85,
+        2,     0,     5,    76,     4,    56,     6,     5,     7,     4,
+        0,    24,     0,     7,     0,     2,     1,     0,     0,     3,
+       10,     0,   138,    69,    18,     1,    23,     9,     3,   131,
+       24,    13,     8,     0,     3,     5,     0,     0,     3,    34,
+       19,    36,    15,    10,     2,     1,     1,     3,     3,     3,
+        0,    34,     2,     1,     1,     5,    35,    41,     3,    15,
+        1,     5,     5,     0,     1,    13,    12,    20,    18,     5,
+        1,     3,     8,     7,    10,     2,    22,     8,    31,     5,
+        2,     2,     0,     0,    28,     1,     2,     6,     6,   140,
+        8,     2,     0,    19,    22,    88,    45,    21,    22,     6,
+        2,     0,     0,     1,     1,     1,    66,     6,    12,     7,
+        0,     9,    10,     1,     1,     2,     3,    33,    40,    25,
+        1,    16,    15,    93,     9,     9,    87,     1,     1,     1,
+       14,     1,     1,     0,     3,     2,     8,    23,    15,    23,
+       11,    11,     0,     1,     7,     5,     9,    11,     5,     1,
+        8,     3,    96,     2,     3,    19,     0,     9,    67,    29,
+       20,    17,    18,    24,    37,     2,    12,     5,    48,    79,
+        5,     1,     5,    27,     1,    18,    10,     2,     5,     4,
+       72,    24,     4,     9,     0,    12,     0,     6,     6,     4,
+        4,     4,    13,   176,    36,    45,     3,     1,    15,     3,
+        2,    23,    16,    46,     4,     0,     5,    13,    70,     1,
+       22,    24,     3,     8,   104,     0,     3,     0,    10,    16,
+       77,     6,    80,    33,    17,     6,    12,     3,     0,    12,
+        6,    13,     4,    78,     5,     4,    74,    22,     7,    15,
+       16,    18,    48,    72,    44,    35,    34,     4,    17,     6,
+        0,    19,    40,     4,   143,     1,    22,     5,     2,    10,
+       17,     0,    33,     0,    10,     6,     0,    63,     1,     5,
+       12,     0,     1,     2,     1,     1,     8,     0,    53,     2,
+        1,     5,     1,     2,    10,     4,     7,    10,    79,     2,
+        8,    60,     3,     0,     2,     6,     4,    93,     1,    17,
+       50,     0,     2,     7,    36,    18,     1,    89,     1,    11,
+        3,     0,     1,    44,     2,    72,     2,     2,    68,     0,
+        5,     0,    35,    45,    22,    10,     5,    20,     2,     5,
+       53,     6,     7,   100,    51,    44,     2,    43,    96,    26,
+        0,     0,     8,    17,    20,     9,    10,     4,    73,     0,
+        0,    28,     0,    28,    70,   101,     1,     4,    15,     2,
+        2,     2,     5,     9,    15,    10,    43,    10,    21,    18,
+       22,    25,     0,    11,     6,     4,    77,    79,     3,    12,
+        4,     0,     8,    46,   128,   109,     0,     1,    10,     2,
+        0,    28,     2,    10,     8,    39,     5,     0,    13,    83,
+       95,     2,    70,    41,    88,     0,    33,     0,     4,    17,
+        9,    18,     0,     1,    71,     3,    47,    16,     0,     0,
+        3,     0,    18,    57,    47,     1,     4,     3,     0,     6,
+       97,     1,   109,    86,    53,     0,     3,     8,     8,     7,
+       15,     4,    16,    23,     2,    19,     1,     5,     0,     1,
+       13,    11,    23,    38,   142,    25,    11,     5,    13,    54,
+        0,    26,     1,     4,    55,     9,     0,     0,    55,     2,
+        0,    15,    94,     3,    20,   213,    13,   100,     0,    34,
+        5,     1,     1,    20,     0,    12,    58,    10,    51,    75,
+       12,     1,    42,   130,   164,    79,     6,   197,     0,    78,
+       60,    40,    33,   122,     1,    37,     0,     6,     4,    27,
+        7,    31,   140,     0,    15,    64,    72,   134,     0,   329,
+        0,     3,     2,     6,     6,    24,    64,     1,     0,    64,
+       42,   234,   165,    13,     1,    65,     5,   204,    66,    60,
+        5,     0,     0,     0,     3,     0,    35,   147,   189,     5,
+      101,     8,    84,   139,   206,    15,     7,     4,   306,     1,
+        1,     6,    21,   223,   110,   166,     0,     3,    59,    25,
+       53,     4,     4,    37,    10,   104,     6,    19,    10,   222,
+        1,    18,     4,     0,    15,    16,    95,   128,    16,    11,
+      129,   126,    16,     2,   123,     1,     1,   153,    19,     6,
+       65,     1,    65,    20,     1,     0,     9,     0,     2,   132,
+       85,   159,    18,   262,     0,    39,    67,   181,   266,     0,
+      775,   188,   723,     5,   450,   135,   136,   171,     7,     0,
+       16,     3,     0,     0,   140,    17,   624,    13,    48,   147,
+       35,    23,     3,
+};
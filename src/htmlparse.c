@@ -38,8 +38,42 @@ static char const rcsid[] =
 #include <stdio.h>
 #include <ctype.h>
 #include <assert.h>
+#include <time.h>
 #include "html.h"
 
+#if defined(__SSE2__) && defined(__GNUC__)
+# include <emmintrin.h>
+# define TEXT_SCAN_SSE2 1
+#endif
+
+/*
+ * On systems that support it, [$html parse -file] memory-maps the file
+ * and tokenizes the mapping directly. Elsewhere the file is read into
+ * a Tcl object (see HtmlTokenizerAppendFile()).
+ */
+#ifndef WIN32
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <limits.h>
+# ifndef MAP_ANONYMOUS
+#  define MAP_ANONYMOUS MAP_ANON
+# endif
+# define HTML_MMAP_FILE 1
+#endif
+
+/*
+ * Tokenizing in a background thread (the -asyncparse option) requires a
+ * threaded Tcl build. It is also disabled if HTML_DEBUG is defined, as 
+ * the resource-tracking allocator used by debug builds is not 
+ * thread-safe.
+ */
+#if defined(TCL_THREADS) && !defined(HTML_DEBUG)
+# define HTML_ASYNC_PARSE 1
+#endif
+
 #define ISSPACE(x) isspace((unsigned char)(x))
 #define ISALPHA(x) isalpha((unsigned char)(x))
 
@@ -456,45 +490,12 @@ HtmlLiContent (HtmlTree *pTree, HtmlNode *pNode, int tag)
  * build process. It contains the HtmlMarkupMap constant array, declared as:
  *
  * HtmlTokenMap HtmlMarkupMap[] = {...};
+ *
+ * and the HtmlMarkupHashSeed[] and HtmlMarkupHashSlot[] arrays used by 
+ * HtmlHashLookup() in htmltagdb.c.
  */
 #include "htmltokens.c"
 
-#ifdef TEST
-
-/* 
-** Compute the longest and average collision chain length for the
-** markup hash table
-*/
-static void
-HtmlHashStats(void * htmlPtr)
-{
-    int i;
-    int sum = 0;
-    int max = 0;
-    int cnt;
-    int notempty = 0;
-    struct sgMap *p;
-
-    for (i = 0; i < HTML_MARKUP_COUNT; i++) {
-        cnt = 0;
-        p = apMap[i];
-        if (p)
-            notempty++;
-        while (p) {
-            cnt++;
-            p = p->pCollide;
-        }
-        sum += cnt;
-        if (cnt > max)
-            max = cnt;
-
-    }
-    printf("longest chain=%d  avg=%g  slots=%d  empty=%d (%g%%)\n",
-           max, (double) sum / (double) notempty, i, i - notempty,
-           100.0 * (i - notempty) / (double) i);
-}
-#endif
-
 /*
  *---------------------------------------------------------------------------
  *
@@ -632,6 +633,206 @@ executeScript(
     return rc;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * textLength --
+ *
+ *     Return the number of bytes in the nul-terminated string z before 
+ *     the first '<' or nul character. This is the length of the text
+ *     node (if any) that starts at z, and scanning for it is usually the
+ *     most expensive part of tokenizing a text-heavy document. 
+ *
+ *     Where SSE2 is available (always on x86-64), 16 bytes are tested at 
+ *     a time. Otherwise the string is scanned one machine word at a 
+ *     time. Either way, all loads are aligned to their own size, so the
+ *     scan never reads from a page that does not contain at least one 
+ *     byte of the string.
+ *
+ * Results:
+ *     Length of text in bytes.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+textLength (const char *z)
+{
+#ifdef TEXT_SCAN_SSE2
+    const __m128i lt = _mm_set1_epi8('<');
+    const __m128i nul = _mm_setzero_si128();
+    int iOff = (int)(((size_t)z) & 15);
+    const char *zBlock = &z[-iOff];
+    unsigned int mask;
+
+    /* The first block may start before z. Mask off those bytes. */
+    __m128i v = _mm_load_si128((const __m128i *)zBlock);
+    mask = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, nul))
+    );
+    mask &= (0xFFFF << iOff);
+
+    while (!mask) {
+        zBlock += 16;
+        v = _mm_load_si128((const __m128i *)zBlock);
+        mask = _mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(v, lt), _mm_cmpeq_epi8(v, nul))
+        );
+    }
+    return (int)(&zBlock[__builtin_ctz(mask)] - z);
+#else
+    /* The usual "has a zero byte" trick: (x - 0x01..01) & ~x & 0x80..80
+     * is non-zero if and only if word x contains a zero byte. A word 
+     * contains a '<' if (x ^ 0x3C..3C) contains a zero byte.
+     */
+    const unsigned long ones = ((unsigned long)-1) / 0xFF;
+    const unsigned long highs = ones * 0x80;
+    const unsigned long lts = ones * '<';
+    const char *zCsr = z;
+
+    while (((size_t)zCsr) & (sizeof(unsigned long) - 1)) {
+        if (*zCsr == '<' || *zCsr == 0) return (int)(zCsr - z);
+        zCsr++;
+    }
+    while (1) {
+        unsigned long x;
+        unsigned long y;
+        memcpy(&x, zCsr, sizeof(unsigned long));
+        y = x ^ lts;
+        if (((x - ones) & ~x & highs) || ((y - ones) & ~y & highs)) break;
+        zCsr += sizeof(unsigned long);
+    }
+    while (*zCsr != '<' && *zCsr != 0) zCsr++;
+    return (int)(zCsr - z);
+#endif
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * documentText --
+ *
+ *     Return a pointer to the text of the current document. This is
+ *     either the file mapped by [parse -file] (HtmlTree.zMapped) or the 
+ *     string representation of HtmlTree.pDocument. In both cases the 
+ *     text is followed by a nul byte. If pnDoc is not NULL, *pnDoc is 
+ *     set to the size of the document in bytes.
+ *
+ * Results:
+ *     Pointer to the document text, or NULL if there is no document.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static const char *
+documentText (HtmlTree *pTree, int *pnDoc)
+{
+    const char *zDoc = 0;
+    int nDoc = 0;
+
+    if (pTree->zMapped) {
+        assert(!pTree->pDocument);
+        zDoc = pTree->zMapped;
+        nDoc = pTree->nMapped;
+    } else if (pTree->pDocument) {
+        zDoc = Tcl_GetStringFromObj(pTree->pDocument, &nDoc);
+    }
+    if (pnDoc) *pnDoc = nDoc;
+    return zDoc;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * documentUnmap --
+ * documentMaterialize --
+ *
+ *     documentUnmap() releases the mapping created by [parse -file], if
+ *     any. documentMaterialize() copies the mapped text into a new
+ *     HtmlTree.pDocument object first. It is called before the document
+ *     text is modified, as the mapping is read-only.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May modify HtmlTree.zMapped, nMapped and pDocument.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+documentUnmap (HtmlTree *pTree)
+{
+#ifdef HTML_MMAP_FILE
+    if (pTree->zMapped) {
+        munmap(pTree->zMapped, (size_t)pTree->nMapped + 1);
+    }
+#endif
+    pTree->zMapped = 0;
+    pTree->nMapped = 0;
+}
+static void
+documentMaterialize (HtmlTree *pTree)
+{
+    if (pTree->zMapped) {
+        assert(!pTree->pDocument);
+        pTree->pDocument = Tcl_NewStringObj(pTree->zMapped, pTree->nMapped);
+        Tcl_IncrRefCount(pTree->pDocument);
+        documentUnmap(pTree);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerHasDocument --
+ *
+ *     Return true if there is any document text, mapped or not.
+ *
+ * Results:
+ *     Boolean.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+int
+HtmlTokenizerHasDocument (HtmlTree *pTree)
+{
+    return (pTree->pDocument || pTree->zMapped);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerRelease --
+ *
+ *     Free the document text. This is called by HtmlTreeClear() after 
+ *     any background tokenizer job has been cancelled.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Sets HtmlTree.pDocument and HtmlTree.zMapped to NULL.
+ *
+ *---------------------------------------------------------------------------
+ */
+void
+HtmlTokenizerRelease (HtmlTree *pTree)
+{
+    if (pTree->pDocument) {
+        Tcl_DecrRefCount(pTree->pDocument);
+        pTree->pDocument = 0;
+    }
+    documentUnmap(pTree);
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -684,6 +885,9 @@ HtmlTokenize (
      */
     int isTrimStart = 0;
 
+    /* Tokens processed since the clock was last checked (-parsebudget) */
+    int nSinceCheck = 0;
+
     if (zText) {
         /* This is an [$html fragment] command */
         n = 0;
@@ -691,18 +895,39 @@ HtmlTokenize (
     } else {
         /* This is an [$html parse] command */
         n = pTree->nParsed;
-        z = Tcl_GetString(pTree->pDocument);
+        z = (char *)documentText(pTree, 0);
     }
 
     while ((c = z[n]) != 0) {
         /* assert(n <= strlen(z)); */
+
+        /* If the -parsebudget option is set and the deadline set by 
+         * tokenizeWrapper() has passed, stop here and let the caller 
+         * schedule the rest. Only do this between tokens when there is 
+         * no pending leading-newline trim, as isTrimStart is not saved.
+         */
+        if (!zText && pTree->options.parsebudget > 0 && !isTrimStart && 
+            ++nSinceCheck >= 32
+        ) {
+            Tcl_Time now;
+            nSinceCheck = 0;
+            Tcl_GetTime(&now);
+            if (now.sec > pTree->parseDeadline.sec || (
+                now.sec == pTree->parseDeadline.sec && 
+                now.usec >= pTree->parseDeadline.usec
+            )) {
+                pTree->isParseYield = 1;
+                goto incomplete;
+            }
+        }
         
         /* TEXT, HTML Comment, TAG (opening or closing) */
 
         /* A text (or whitespace) node */
         if (c != '<' && c != 0) {
             int isTrimEnd = 0;
-            for (i = 0; (c = z[n + i]) != 0 && c != '<'; i++);
+            i = textLength(&z[n]);
+            c = z[n + i];
 
             /* If the next tag is a </PRE>, then skip the final newline
              * of this text node by setting isTrimEnd to true. TODO: It
@@ -812,8 +1037,13 @@ HtmlTokenize (
 
             /* Increment i until &z[n+i] is the first byte past the
              * end of the tag name. Then set arglen[0] to the length of
-             * argv[0].
+             * argv[0]. If the input ends immediately after the "<", 
+             * wait for more (the loop below would otherwise read past 
+             * the nul-terminator).
              */
+            if (z[n + i] == 0) {
+                goto incomplete;
+            }
             do {
                 i++;
                 c = z[n + i];
@@ -940,19 +1170,15 @@ HtmlTokenize (
              * HtmlHashLookup(). It would be easy enough to fix 
              * HtmlHashLookup() to understand a length argument.
              */
-            HtmlHashInit(0, 0);
             c = argv[0][arglen[0]];
             argv[0][arglen[0]] = 0;
             pMap = HtmlHashLookup(0, argv[0]);
             if (pMap == 0) {
-                Tcl_HashEntry *pEntry;
-                int dummy;
                 if (pTree->options.parsemode != HTML_PARSEMODE_XML){
                     argv[0][arglen[0]] = c;
                     continue;
                 }
-                pEntry = Tcl_CreateHashEntry(&pTree->aAtom, argv[0], &dummy);
-                zAtom = Tcl_GetHashKey(&pTree->aAtom, pEntry);
+                zAtom = HtmlAtom(pTree, argv[0]);
                 eType = 0;
             } else {
                 zAtom = pMap->zName;
@@ -1049,7 +1275,7 @@ HtmlTokenize (
                             pTree->eWriteState = HTML_WRITE_NONE;
                             return 0;
                     }
-                    z = Tcl_GetString(pTree->pDocument);
+                    z = (char *)documentText(pTree, 0);
 
                     HtmlFree(pAttr);
                     isTrimStart = 0;
@@ -1071,6 +1297,8 @@ HtmlTokenize (
 
 /************************** End HTML Tokenizer Code ***************************/
 
+static Tcl_IdleProc parseYieldCallback;
+
 static int 
 tokenizeWrapper (
     HtmlTree *pTree,             /* The HTML widget doing the parsing */
@@ -1082,14 +1310,45 @@ tokenizeWrapper (
 {
     int rc;
     HtmlNode *pCurrent = pTree->state.pCurrent;
+    int nParsed = pTree->nParsed;
+    clock_t parseClock;
 
     assert(pTree->eWriteState == HTML_WRITE_NONE);
     HtmlCheckRestylePoint(pTree);
 
+    /* If the -parsebudget option is set, HtmlTokenize() returns early 
+     * once the budget is used up, setting HtmlTree.isParseYield. Any
+     * continuation already scheduled is superseded by this call.
+     */
+    if (pTree->isParseYield) {
+        Tcl_CancelIdleCall(parseYieldCallback, (ClientData)pTree);
+        pTree->isParseYield = 0;
+    }
+    if (pTree->options.parsebudget > 0) {
+        Tcl_GetTime(&pTree->parseDeadline);
+        pTree->parseDeadline.usec += pTree->options.parsebudget * 1000;
+        pTree->parseDeadline.sec += pTree->parseDeadline.usec / 1000000;
+        pTree->parseDeadline.usec %= 1000000;
+    }
+
     HtmlCallbackRestyle(pTree, pCurrent ? pCurrent : pTree->pRoot);
     HtmlCallbackLayout(pTree, pCurrent);
+    parseClock = clock();
     rc = HtmlTokenize(pTree, 0, isFin, xAddText, xAddElement, xAddClosing);
-    if (pTree->isParseFinished && pTree->eWriteState==HTML_WRITE_NONE) {
+    parseClock = clock() - parseClock;
+
+    /* Log the parse throughput. The clicks include building the tree. */
+    HtmlTimer(pTree, "PARSE", "Tokenize: bytes=%d clicks=%d KB/s=%d", 
+        rc - nParsed, (int)parseClock, (parseClock <= 0) ? 0 : (int)(
+            ((double)(rc - nParsed) / 1024.0) * CLOCKS_PER_SEC / parseClock
+        )
+    );
+    if (pTree->isParseYield) {
+        Tcl_DoWhenIdle(parseYieldCallback, (ClientData)pTree);
+    } else if (
+        pTree->isParseFinished && pTree->eWriteState==HTML_WRITE_NONE
+    ) {
+        HtmlInitTree(pTree);
         HtmlFinishNodeHandlers(pTree);
     }
 
@@ -1116,54 +1375,158 @@ tokenizeWrapper (
 /*
  *---------------------------------------------------------------------------
  *
- * HtmlTokenizerAppend --
+ * parseYieldCallback --
  *
- *     Append text to the tokenizer engine.
+ *     Idle callback scheduled by tokenizeWrapper() when the tokenizer 
+ *     stopped because the -parsebudget time was used up. Tokenize the
+ *     next slice of the document.
+ *
+ *     If a script handler has called [write wait] in the meantime, do 
+ *     nothing. [write continue] resumes tokenizing in that case.
  *
  * Results:
  *     None.
  *
  * Side effects:
- *     This routine (actually the Tokenize() subroutine that is called
- *     by this routine) may invoke a callback procedure which could delete
- *     the HTML widget. 
+ *     Tokenizes document text, which may invoke handler scripts.
  *
  *---------------------------------------------------------------------------
  */
-void 
-HtmlTokenizerAppend (HtmlTree *pTree, const char *zText, int nText, int isFinal)
+static void
+parseYieldCallback (ClientData clientData)
 {
-    /* TODO: Add a flag to prevent recursive calls to this routine. */
-    const char *z = zText;
-    int n = nText;
-    /* Tcl_DString utf8; */
-
-    if (!pTree->pDocument) {
-        pTree->pDocument = Tcl_NewObj();
-        Tcl_IncrRefCount(pTree->pDocument);
-        assert(!Tcl_IsShared(pTree->pDocument));
-    }
-
-    assert(!Tcl_IsShared(pTree->pDocument));
-    Tcl_AppendToObj(pTree->pDocument, z, n);
+    HtmlTree *pTree = (HtmlTree *)clientData;
 
+    pTree->isParseYield = 0;
     if (pTree->eWriteState == HTML_WRITE_NONE) {
-        tokenizeWrapper(pTree, isFinal, 
+        tokenizeWrapper(pTree, pTree->isParseFinished, 
             HtmlTreeAddText,
             HtmlTreeAddElement,
             HtmlTreeAddClosingTag
         );
+
+        /* A node handler called [reset], and possibly [parse]. Start
+         * again with the new document in the next slice, as parseCmd() 
+         * would have done synchronously.
+         */
+        if (pTree->eWriteState == HTML_WRITE_INHANDLERRESET) {
+            pTree->eWriteState = HTML_WRITE_NONE;
+            if (HtmlTokenizerHasDocument(pTree) && !pTree->isParseYield) {
+                pTree->isParseYield = 1;
+                Tcl_DoWhenIdle(parseYieldCallback, (ClientData)pTree);
+            }
+        }
     }
 }
 
+#ifdef HTML_ASYNC_PARSE
+
+/*
+ * Background tokenizer.
+ *
+ * If the -asyncparse option is true, large documents are tokenized by a 
+ * worker thread instead of by the [parse] command. The worker runs 
+ * HtmlTokenize() over a private copy of the unparsed document text, 
+ * recording each token as an HtmlParseRecord instead of adding it to the
+ * tree. Records are passed to the Tk thread in blocks of 
+ * HTML_PARSE_BLOCKSIZE. The Tk thread is notified via the Tcl event queue
+ * and adds the tokens to the tree (HtmlTreeAddText() etc.) in slices of at
+ * most -parsebudget (default HTML_PARSE_SLICE) milliseconds, so that the 
+ * event loop continues to service user input while a large document is 
+ * loading.
+ *
+ * Script handlers must be run in document order, synchronously with 
+ * tokenization (a script may call [write] to insert text at the current
+ * point). So if any are configured the document is tokenized in the 
+ * foreground as usual. The same applies to the "xml" parse mode, which 
+ * adds unknown tag names to the shared atom table while tokenizing.
+ *
+ * HtmlTokenize() is passed a pointer to HtmlParseJob.sTree, a zeroed 
+ * HtmlTree structure with only the options.parsemode and eWriteState 
+ * fields set. The queueXXX() callbacks cast this back to the HtmlParseJob.
+ */
+#define HTML_PARSE_BLOCKSIZE 256       /* Records per HtmlParseBlock */
+#define HTML_PARSE_SLICE     16        /* Default ms of tree building */
+#define HTML_PARSE_MINIMUM   65536     /* Smaller inputs parse in foreground */
+
+#define PARSE_RECORD_TEXT    1
+#define PARSE_RECORD_ELEMENT 2
+#define PARSE_RECORD_CLOSING 3
+
+typedef struct HtmlParseRecord HtmlParseRecord;
+typedef struct HtmlParseBlock HtmlParseBlock;
+typedef struct HtmlParseEvent HtmlParseEvent;
+
+struct HtmlParseRecord {
+    int eRecord;                  /* One of the PARSE_RECORD_XXX values */
+    int eType;                    /* Tag type (ELEMENT and CLOSING) */
+    const char *zType;            /* Tag name atom (ELEMENT and CLOSING) */
+    HtmlAttributes *pAttr;        /* Attributes (ELEMENT) */
+    HtmlTextNode *pTextNode;      /* Text node (TEXT) */
+    int iOffset;                  /* Offset within HtmlParseJob.zText */
+};
+
+struct HtmlParseBlock {
+    int nRecord;                  /* Number of valid entries in aRecord[] */
+    int iRead;                    /* Records already added to the tree */
+    HtmlParseBlock *pNext;        /* Next block in queue */
+    HtmlParseRecord aRecord[HTML_PARSE_BLOCKSIZE];
+};
+
+struct HtmlParseJob {
+    HtmlTree sTree;               /* Passed to HtmlTokenize(). Must be first */
+
+    /* Read-only once the worker thread has started. */
+    char *zText;                  /* Copy of the unparsed document text */
+    int nText;                    /* Length of zText in bytes */
+    int iBase;                    /* HtmlTree.nParsed when the job started */
+    int isFinal;                  /* True to tokenize with isFinal set */
+    Tcl_ThreadId mainThread;      /* Thread that owns the widget */
+
+    /* Used by the worker thread only. */
+    HtmlParseBlock *pWrite;       /* Block being filled */
+
+    /* Protected by HtmlParseJob.mutex. */
+    Tcl_Mutex mutex;
+    int nRef;                     /* Worker, widget and queued events */
+    int isCancelled;              /* True once the widget drops the job */
+    int isEventPending;           /* True if an HtmlParseEvent is queued */
+    int nConsumed;                /* Bytes consumed, or -1 while running */
+    HtmlParseBlock *pFirst;       /* Queue of filled blocks */
+    HtmlParseBlock **ppLast;      /* Pointer to last pNext field in queue */
+
+    /* Used by the Tk thread only. */
+    HtmlTree *pTree;              /* Widget, or NULL after cancellation */
+    HtmlParseBlock *pRead;        /* Block being added to the tree */
+    int isDraining;               /* True while in asyncParseDrain() */
+    int isDeleted;                /* True if cancelled by widget deletion */
+    int isDiscard;                /* Run HtmlTokenizerDiscard() when done */
+    int nRecord;                  /* Records added to the tree so far */
+    int nSlice;                   /* Number of calls to asyncParseDrain() */
+    int iMaxSlice;                /* Longest asyncParseDrain() in ms */
+    Tcl_Time tStart;              /* Time the job was started */
+};
+
+struct HtmlParseEvent {
+    Tcl_Event header;             /* Must be first */
+    HtmlParseJob *pJob;
+};
+
+static int asyncParseEventProc(Tcl_Event *, int);
+
+static int
+timeDiffMs(Tcl_Time *p1, Tcl_Time *p2)
+{
+    return (p2->sec - p1->sec) * 1000 + (p2->usec - p1->usec) / 1000;
+}
+
 /*
  *---------------------------------------------------------------------------
  *
- * HtmlMarkupArg --
+ * asyncParseBlockFree --
  *
- *     Lookup an argument in the given markup with the name given.
- *     Return a pointer to its value, or the given default
- *     value if it doesn't appear.
+ *     Free a block of records, along with any text nodes and attributes
+ *     not yet added to the document tree. Argument pBlock may be NULL.
  *
  * Results:
  *     None.
@@ -1173,88 +1536,1369 @@ HtmlTokenizerAppend (HtmlTree *pTree, const char *zText, int nText, int isFinal)
  *
  *---------------------------------------------------------------------------
  */
-char *
-HtmlMarkupArg (HtmlAttributes *pAttr, const char *zTag, char *zDefault)
+static void
+asyncParseBlockFree (HtmlParseBlock *pBlock)
 {
-    int i;
-    if (pAttr) {
-        for (i = 0; i < pAttr->nAttr; i++) {
-            if (strcmp(pAttr->a[i].zName, zTag) == 0) {
-                return pAttr->a[i].zValue;
-            }
+    if (pBlock) {
+        int ii;
+        for (ii = pBlock->iRead; ii < pBlock->nRecord; ii++) {
+            HtmlParseRecord *p = &pBlock->aRecord[ii];
+            if (p->pTextNode) HtmlTextFree(p->pTextNode);
+            if (p->pAttr) HtmlFree(p->pAttr);
         }
+        HtmlFree(pBlock);
     }
-    return zDefault;
 }
 
 /*
  *---------------------------------------------------------------------------
  *
- * HtmlWriteWait --
+ * asyncParseRelease --
  *
- *     $widget write wait
+ *     Decrement the reference count of an HtmlParseJob. If it reaches
+ *     zero, free the job. This may be called from either thread.
  *
  * Results:
  *     None.
  *
  * Side effects:
+ *     May free pJob.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+asyncParseRelease (HtmlParseJob *pJob)
+{
+    int nRef;
+
+    Tcl_MutexLock(&pJob->mutex);
+    nRef = --pJob->nRef;
+    Tcl_MutexUnlock(&pJob->mutex);
+
+    if (nRef == 0) {
+        HtmlParseBlock *pBlock;
+        asyncParseBlockFree(pJob->pRead);
+        asyncParseBlockFree(pJob->pWrite);
+        while ((pBlock = pJob->pFirst)) {
+            pJob->pFirst = pBlock->pNext;
+            asyncParseBlockFree(pBlock);
+        }
+        Tcl_MutexFinalize(&pJob->mutex);
+        HtmlFree(pJob->zText);
+        HtmlFree(pJob);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParsePublish --
+ *
+ *     Called by the worker thread to append the block it has been filling
+ *     (if any) to the queue read by the Tk thread. If nConsumed is not
+ *     negative, tokenization is finished and nConsumed is the number of 
+ *     bytes of HtmlParseJob.zText consumed.
+ *
+ *     The Tk thread is sent an HtmlParseEvent unless one is already 
+ *     queued. If the job has been cancelled, the block is freed instead
+ *     and HtmlTokenize() is asked to stop.
+ *
+ * Results:
  *     None.
  *
+ * Side effects:
+ *     See above.
+ *
  *---------------------------------------------------------------------------
  */
-int 
-HtmlWriteWait (HtmlTree *pTree)
+static void
+asyncParsePublish (HtmlParseJob *pJob, int nConsumed)
 {
-    if (pTree->eWriteState != HTML_WRITE_INHANDLER) {
-        char *zErr = "Cannot call [write wait] here";
-        Tcl_SetResult(pTree->interp, zErr, TCL_STATIC);
-        return TCL_ERROR;
+    HtmlParseBlock *pBlock = pJob->pWrite;
+    int isCancelled;
+
+    pJob->pWrite = 0;
+    Tcl_MutexLock(&pJob->mutex);
+    isCancelled = pJob->isCancelled;
+    if (!isCancelled) {
+        if (pBlock) {
+            *pJob->ppLast = pBlock;
+            pJob->ppLast = &pBlock->pNext;
+        }
+        if (nConsumed >= 0) {
+            pJob->nConsumed = nConsumed;
+        }
+        if (!pJob->isEventPending) {
+            HtmlParseEvent *pEvent;
+            pEvent = (HtmlParseEvent *)ckalloc(sizeof(HtmlParseEvent));
+            pEvent->header.proc = asyncParseEventProc;
+            pEvent->pJob = pJob;
+            pJob->isEventPending = 1;
+            pJob->nRef++;
+            Tcl_ThreadQueueEvent(
+                pJob->mainThread, (Tcl_Event *)pEvent, TCL_QUEUE_TAIL
+            );
+            Tcl_ThreadAlert(pJob->mainThread);
+        }
     }
+    Tcl_MutexUnlock(&pJob->mutex);
 
-    pTree->eWriteState = HTML_WRITE_INHANDLERWAIT;
-    return TCL_OK;
+    if (isCancelled) {
+        asyncParseBlockFree(pBlock);
+        pJob->sTree.eWriteState = HTML_WRITE_INHANDLERRESET;
+    }
 }
 
 /*
  *---------------------------------------------------------------------------
  *
- * HtmlWriteText --
+ * queueText --
+ * queueElement --
+ * queueClosing --
  *
- *     $widget write text HTML
+ *     Tokenizer callbacks used by the worker thread. Each appends a record
+ *     to the block being filled, first publishing the block if it is full.
  *
  * Results:
  *     None.
  *
  * Side effects:
- *     None.
+ *     See above.
  *
  *---------------------------------------------------------------------------
  */
-int 
-HtmlWriteText(HtmlTree *pTree, Tcl_Obj *pText)
+static HtmlParseRecord *
+queueRecord (HtmlTree *p, int eRecord, int iOffset)
 {
-    int iInsert = pTree->iWriteInsert;
-  
-    Tcl_Obj *pDocument = pTree->pDocument;
-    Tcl_Obj *pHead;
-    Tcl_Obj *pTail;
+    HtmlParseJob *pJob = (HtmlParseJob *)p;
+    HtmlParseBlock *pBlock = pJob->pWrite;
+    HtmlParseRecord *pRecord;
 
-    if (pTree->eWriteState == HTML_WRITE_NONE) {
-        char *zErr = "Cannot call [write text] here";
-        Tcl_SetResult(pTree->interp, zErr, TCL_STATIC);
-        return TCL_ERROR;
+    if (pBlock && pBlock->nRecord == HTML_PARSE_BLOCKSIZE) {
+        asyncParsePublish(pJob, -1);
+        pBlock = 0;
+    }
+    if (!pBlock) {
+        pBlock = (HtmlParseBlock *)HtmlAlloc(
+            "HtmlParseBlock", sizeof(HtmlParseBlock)
+        );
+        pBlock->nRecord = 0;
+        pBlock->iRead = 0;
+        pBlock->pNext = 0;
+        pJob->pWrite = pBlock;
     }
 
-    pHead = Tcl_NewStringObj(Tcl_GetString(pDocument), iInsert);
-    pTail = Tcl_NewStringObj(&(Tcl_GetString(pDocument)[iInsert]), -1);
+    pRecord = &pBlock->aRecord[pBlock->nRecord++];
+    memset(pRecord, 0, sizeof(HtmlParseRecord));
+    pRecord->eRecord = eRecord;
+    pRecord->iOffset = iOffset;
+    return pRecord;
+}
+static void
+queueText (HtmlTree *p, HtmlTextNode *pTextNode, int iOffset)
+{
+    HtmlParseRecord *pRecord = queueRecord(p, PARSE_RECORD_TEXT, iOffset);
+    pRecord->pTextNode = pTextNode;
+}
+static void
+queueElement (
+    HtmlTree *p, 
+    int eType, 
+    const char *zType, 
+    HtmlAttributes *pAttr, 
+    int iOffset
+)
+{
+    HtmlParseRecord *pRecord = queueRecord(p, PARSE_RECORD_ELEMENT, iOffset);
+    pRecord->eType = eType;
+    pRecord->zType = zType;
+    pRecord->pAttr = pAttr;
+}
+static void
+queueClosing (HtmlTree *p, int eType, const char *zType, int iOffset)
+{
+    HtmlParseRecord *pRecord = queueRecord(p, PARSE_RECORD_CLOSING, iOffset);
+    pRecord->eType = eType;
+    pRecord->zType = zType;
+}
 
-    Tcl_IncrRefCount(pHead);
-    Tcl_AppendObjToObj(pHead, pText);
-    Tcl_GetStringFromObj(pHead, &pTree->iWriteInsert);
-    Tcl_AppendObjToObj(pHead, pTail);
+static Tcl_ThreadCreateType
+asyncParseThread (ClientData clientData)
+{
+    HtmlParseJob *pJob = (HtmlParseJob *)clientData;
+    int n;
 
-    Tcl_DecrRefCount(pDocument);
-    pTree->pDocument = pHead;
+    n = HtmlTokenize(&pJob->sTree, pJob->zText, pJob->isFinal, 
+        queueText, queueElement, queueClosing
+    );
+    asyncParsePublish(pJob, n);
+    asyncParseRelease(pJob);
+
+    TCL_THREAD_CREATE_RETURN;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParseStart --
+ *
+ *     Try to start a background tokenizer job for the unparsed part of
+ *     the document (the bytes of HtmlTree.pDocument after 
+ *     HtmlTree.nParsed).
+ *
+ * Results:
+ *     True if a job was started, or false if the caller should tokenize
+ *     the document in the foreground.
+ *
+ * Side effects:
+ *     May set HtmlTree.pParseJob and start a thread.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+asyncParseStart (HtmlTree *pTree, int isFinal)
+{
+    HtmlParseJob *pJob;
+    Tcl_ThreadId thread;
+    const char *zDoc;
+    int nDoc;
+    int nText;
+
+    assert(!pTree->pParseJob);
+    if (
+        !pTree->options.asyncparse || 
+        pTree->options.parsemode == HTML_PARSEMODE_XML ||
+        pTree->eWriteState != HTML_WRITE_NONE ||
+        pTree->aScriptHandler.numEntries > 0 ||
+        !HtmlTokenizerHasDocument(pTree)
+    ) {
+        return 0;
+    }
+    zDoc = documentText(pTree, &nDoc);
+    nText = nDoc - pTree->nParsed;
+    if (nText < HTML_PARSE_MINIMUM) {
+        return 0;
+    }
+
+    pJob = HtmlNew(HtmlParseJob);
+    pJob->sTree.options.parsemode = pTree->options.parsemode;
+    pJob->sTree.eWriteState = HTML_WRITE_NONE;
+    pJob->zText = (char *)HtmlAlloc("HtmlParseJob.zText", nText + 1);
+    memcpy(pJob->zText, &zDoc[pTree->nParsed], nText + 1);
+    pJob->nText = nText;
+    pJob->iBase = pTree->nParsed;
+    pJob->isFinal = isFinal;
+    pJob->mainThread = Tcl_GetCurrentThread();
+    pJob->nRef = 2;
+    pJob->nConsumed = -1;
+    pJob->ppLast = &pJob->pFirst;
+    pJob->pTree = pTree;
+    Tcl_GetTime(&pJob->tStart);
+
+    if (TCL_OK != Tcl_CreateThread(&thread, asyncParseThread, 
+            (ClientData)pJob, TCL_THREAD_STACK_DEFAULT, TCL_THREAD_NOFLAGS)
+    ) {
+        pJob->nRef = 1;
+        asyncParseRelease(pJob);
+        return 0;
+    }
+
+    pTree->pParseJob = pJob;
+    if (pTree->isParseYield) {
+        Tcl_CancelIdleCall(parseYieldCallback, (ClientData)pTree);
+        pTree->isParseYield = 0;
+    }
+    HtmlLog(pTree, "PARSE", "Started background tokenizer: bytes=%d", nText);
+    return 1;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParseContinue --
+ *
+ *     Called on the Tk thread when a background job has finished, or was 
+ *     cancelled by a node-handler that called [reset]. If isMore is true,
+ *     there is more document text to tokenize, either in the background
+ *     or, if a job cannot be started, in the foreground. If the document
+ *     is complete ([parse -final] has been called), finish it as 
+ *     parseCmd() would have.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See above.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+asyncParseContinue (HtmlTree *pTree, int isMore)
+{
+    int isFinal = pTree->isParseFinished;
+
+    if (isMore && asyncParseStart(pTree, isFinal)) {
+        return;
+    }
+    if (isMore && pTree->eWriteState == HTML_WRITE_NONE) {
+        /* tokenizeWrapper() runs the outstanding node-handlers itself if
+         * HtmlTree.isParseFinished is set. 
+         */
+        tokenizeWrapper(pTree, isFinal, 
+            HtmlTreeAddText,
+            HtmlTreeAddElement,
+            HtmlTreeAddClosingTag
+        );
+        if (pTree->eWriteState == HTML_WRITE_INHANDLERRESET) {
+            pTree->eWriteState = HTML_WRITE_NONE;
+        }
+    } else if (isFinal && pTree->eWriteState == HTML_WRITE_NONE) {
+        HtmlInitTree(pTree);
+        HtmlFinishNodeHandlers(pTree);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParseComplete --
+ *
+ *     Called on the Tk thread once all records produced by a background
+ *     job have been added to the tree.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Updates HtmlTree.nParsed and clears HtmlTree.pParseJob. 
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+asyncParseComplete (HtmlParseJob *pJob)
+{
+    HtmlTree *pTree = pJob->pTree;
+    Tcl_Time tEnd;
+    int nDoc;
+    int isMore;
+
+    assert(pTree->pParseJob == pJob);
+    pTree->nParsed = pJob->iBase + pJob->nConsumed;
+    pTree->pParseJob = 0;
+    pJob->pTree = 0;
+
+    Tcl_GetTime(&tEnd);
+    HtmlTimer(pTree, "PARSE", 
+        "Background tokenize: bytes=%d records=%d slices=%d "
+        "max-slice=%dms total=%dms", 
+        pJob->nConsumed, pJob->nRecord, pJob->nSlice, pJob->iMaxSlice,
+        timeDiffMs(&pJob->tStart, &tEnd)
+    );
+
+    /* There is more to do if text was appended to the document while the
+     * job was running, or if the job tokenized a non-final chunk and
+     * [parse -final] has since been called.
+     */
+    documentText(pTree, &nDoc);
+    isMore = (nDoc > pTree->nParsed) && (
+        nDoc > pJob->iBase + pJob->nText ||
+        (pTree->isParseFinished && !pJob->isFinal)
+    );
+    if (pJob->isDiscard) {
+        HtmlTokenizerDiscard(pTree);
+    }
+    asyncParseRelease(pJob);
+
+    asyncParseContinue(pTree, isMore);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParseDrain --
+ *
+ *     Add queued records to the document tree until either the queue is 
+ *     empty or the time budget (the -parsebudget option, or 
+ *     HTML_PARSE_SLICE milliseconds if it is not set) is used up. In the 
+ *     second case another HtmlParseEvent is queued to continue later.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Builds the document tree. Node-handler and parse-handler scripts 
+ *     may be invoked.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+asyncParseDrain (HtmlParseJob *pJob)
+{
+    HtmlTree *pTree = pJob->pTree;
+    HtmlNode *pCurrent = pTree->state.pCurrent;
+    HtmlParseBlock *pBlock = 0;
+    Tcl_Time t1;
+    Tcl_Time t2;
+    int isDone = 0;
+    int nRecord = 0;
+    int iSlice;
+    int iBudget = pTree->options.parsebudget;
+
+    if (iBudget <= 0) iBudget = HTML_PARSE_SLICE;
+
+    Tcl_GetTime(&t1);
+    pJob->isDraining = 1;
+
+    HtmlCheckRestylePoint(pTree);
+    HtmlCallbackRestyle(pTree, pCurrent ? pCurrent : pTree->pRoot);
+    HtmlCallbackLayout(pTree, pCurrent);
+
+    while (1) {
+        HtmlParseRecord *p;
+        int iOffset;
+
+        pBlock = pJob->pRead;
+        if (!pBlock || pBlock->iRead == pBlock->nRecord) {
+            asyncParseBlockFree(pBlock);
+            Tcl_MutexLock(&pJob->mutex);
+            pBlock = pJob->pFirst;
+            if (pBlock) {
+                pJob->pFirst = pBlock->pNext;
+                if (!pJob->pFirst) pJob->ppLast = &pJob->pFirst;
+            } else {
+                isDone = (pJob->nConsumed >= 0);
+            }
+            Tcl_MutexUnlock(&pJob->mutex);
+            pJob->pRead = pBlock;
+            if (!pBlock) break;
+        }
+
+        /* Mark the record as consumed before adding it to the tree, in
+         * case the job is cancelled (and the remaining records freed) by
+         * a script invoked from within HtmlTreeAddElement() etc.
+         */
+        p = &pBlock->aRecord[pBlock->iRead++];
+        iOffset = pJob->iBase + p->iOffset;
+        switch (p->eRecord) {
+            case PARSE_RECORD_TEXT:
+                HtmlTreeAddText(pTree, p->pTextNode, iOffset);
+                break;
+            case PARSE_RECORD_ELEMENT:
+                HtmlTreeAddElement(pTree, p->eType, p->zType, p->pAttr,iOffset);
+                break;
+            case PARSE_RECORD_CLOSING:
+                HtmlTreeAddClosingTag(pTree, p->eType, p->zType, iOffset);
+                break;
+        }
+        pJob->nRecord++;
+
+        if (!pJob->pTree) {
+            /* The job was cancelled by a script. If the script was a 
+             * node-handler that called [reset] (and possibly [parse]), 
+             * carry on as parseCmd() does in the same situation.
+             */
+            pJob->isDraining = 0;
+            if (
+                !pJob->isDeleted && 
+                pTree->eWriteState == HTML_WRITE_INHANDLERRESET
+            ) {
+                pTree->eWriteState = HTML_WRITE_NONE;
+                asyncParseContinue(pTree, HtmlTokenizerHasDocument(pTree));
+            }
+            return;
+        }
+
+        if ((++nRecord % 16) == 0) {
+            Tcl_GetTime(&t2);
+            if (timeDiffMs(&t1, &t2) >= iBudget) break;
+        }
+    }
+    pJob->isDraining = 0;
+
+    pCurrent = pTree->state.pCurrent;
+    HtmlCallbackRestyle(pTree, pCurrent ? pCurrent : pTree->pRoot);
+    HtmlCheckRestylePoint(pTree);
+
+    Tcl_GetTime(&t2);
+    iSlice = timeDiffMs(&t1, &t2);
+    pJob->iMaxSlice = MAX(pJob->iMaxSlice, iSlice);
+    pJob->nSlice++;
+
+    if (isDone) {
+        asyncParseComplete(pJob);
+    } else if (pBlock) {
+        /* Out of time. Continue after any other pending events. */
+        HtmlParseEvent *pEvent;
+        pEvent = (HtmlParseEvent *)ckalloc(sizeof(HtmlParseEvent));
+        pEvent->header.proc = asyncParseEventProc;
+        pEvent->pJob = pJob;
+        Tcl_MutexLock(&pJob->mutex);
+        pJob->isEventPending = 1;
+        pJob->nRef++;
+        Tcl_MutexUnlock(&pJob->mutex);
+        Tcl_QueueEvent((Tcl_Event *)pEvent, TCL_QUEUE_TAIL);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * asyncParseEventProc --
+ *
+ *     Tcl event handler for an HtmlParseEvent.
+ *
+ * Results:
+ *     1 if the event was handled, or 0 to leave it on the queue.
+ *
+ * Side effects:
+ *     See asyncParseDrain().
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+asyncParseEventProc (Tcl_Event *pEvent, int flags)
+{
+    HtmlParseJob *pJob = ((HtmlParseEvent *)pEvent)->pJob;
+    HtmlTree *pTree = pJob->pTree;
+
+    if (!(flags & TCL_WINDOW_EVENTS)) {
+        return 0;
+    }
+
+    /* If a script invoked while adding records to the tree, or while 
+     * running a script handler, enters the event loop (i.e. [update]), 
+     * leave the event on the queue until the script has returned.
+     */
+    if (pTree && (pJob->isDraining || pTree->eWriteState!=HTML_WRITE_NONE)) {
+        return 0;
+    }
+
+    Tcl_MutexLock(&pJob->mutex);
+    pJob->isEventPending = 0;
+    Tcl_MutexUnlock(&pJob->mutex);
+
+    if (pTree) {
+        asyncParseDrain(pJob);
+    }
+    asyncParseRelease(pJob);
+    return 1;
+}
+
+#else
+# define asyncParseStart(pTree, isFinal) 0
+#endif /* HTML_ASYNC_PARSE */
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerCancel --
+ *
+ *     Abandon any background tokenizer job started for the current 
+ *     document, and any pending -parsebudget continuation. This is called
+ *     when the document is cleared, by [reset] or when the widget is 
+ *     deleted. Records already queued by the worker thread are discarded.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Clears HtmlTree.pParseJob and HtmlTree.isParseYield.
+ *
+ *---------------------------------------------------------------------------
+ */
+void
+HtmlTokenizerCancel (HtmlTree *pTree)
+{
+#ifdef HTML_ASYNC_PARSE
+    HtmlParseJob *pJob;
+#endif
+
+    if (pTree->isParseYield) {
+        Tcl_CancelIdleCall(parseYieldCallback, (ClientData)pTree);
+        pTree->isParseYield = 0;
+    }
+#ifdef HTML_ASYNC_PARSE
+    pJob = pTree->pParseJob;
+    if (pJob) {
+        pTree->pParseJob = 0;
+        pJob->pTree = 0;
+        pJob->isDeleted = pTree->isDeleted;
+        Tcl_MutexLock(&pJob->mutex);
+        pJob->isCancelled = 1;
+        Tcl_MutexUnlock(&pJob->mutex);
+        asyncParseRelease(pJob);
+    }
+#endif
+}
+
+/*
+ * Preload scanner.
+ *
+ * If the -preloadcmd option is set, each chunk of text passed to [parse]
+ * is scanned for the URIs of resources the document will need, before it
+ * is tokenized. The following are recognized:
+ *
+ *     <img src=URI>                          "image"
+ *     <link rel=stylesheet href=URI>         "stylesheet"
+ *     <script src=URI>                       "script"
+ *     url(URI) in <style> or style="..."     "url"
+ *
+ * The scanner is much simpler than HtmlTokenize(). It does not build 
+ * anything, and it only needs to be good enough to find most of the URIs
+ * most of the time. URIs the application has already been told about 
+ * are stored in the HtmlTree.pPreload hash table and not reported again.
+ * HtmlTree.nPreloaded is the offset in HtmlTree.pDocument at which the 
+ * next scan starts - usually the start of an incomplete tag. If the 
+ * incomplete construct is a comment or the content of a <script> or 
+ * <style> element, HtmlTree.iPreloadResume is the offset at which the 
+ * search for its end resumes, so that each chunk of a long script is 
+ * only searched once.
+ */
+/*
+ *---------------------------------------------------------------------------
+ *
+ * preloadAdd --
+ *
+ *     Append the pair (zType, URI) to the list pBatch, unless the URI is 
+ *     empty, is a "data:" URI or has already been reported. If doEscape is
+ *     true, the URI is an attribute value and HTML escapes are translated.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May add an entry to HtmlTree.pPreload.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+preloadAdd (
+    HtmlTree *pTree,
+    Tcl_Obj *pBatch,
+    const char *zType,
+    const char *zUri,
+    int nUri,
+    int doEscape
+)
+{
+    char *zCopy;
+    int isNew;
+
+    while (nUri > 0 && ISSPACE(zUri[0])) {
+        zUri++;
+        nUri--;
+    }
+    while (nUri > 0 && ISSPACE(zUri[nUri - 1])) {
+        nUri--;
+    }
+    if (nUri == 0 || (nUri >= 5 && 0 == strnicmp(zUri, "data:", 5))) {
+        return;
+    }
+
+    zCopy = (char *)HtmlAlloc("temp", nUri + 1);
+    memcpy(zCopy, zUri, nUri);
+    zCopy[nUri] = '\0';
+    if (doEscape) {
+        HtmlTranslateAttrEscapes(zCopy);
+    }
+
+    if (!pTree->pPreload) {
+        pTree->pPreload = HtmlNew(Tcl_HashTable);
+        Tcl_InitHashTable(pTree->pPreload, TCL_STRING_KEYS);
+    }
+    Tcl_CreateHashEntry(pTree->pPreload, zCopy, &isNew);
+    if (isNew) {
+        Tcl_ListObjAppendElement(0, pBatch, Tcl_NewStringObj(zType, -1));
+        Tcl_ListObjAppendElement(0, pBatch, Tcl_NewStringObj(zCopy, -1));
+    }
+    HtmlFree(zCopy);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * preloadCssUrls --
+ *
+ *     Report each url(...) reference in the n bytes of CSS text at z.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     See preloadAdd().
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+preloadCssUrls (
+    HtmlTree *pTree,
+    Tcl_Obj *pBatch,
+    const char *z,
+    int n,
+    int doEscape
+)
+{
+    int i;
+    for (i = 0; i < n - 4; i++) {
+        if ((z[i] == 'u' || z[i] == 'U') && 0 == strnicmp(&z[i], "url(", 4)) {
+            int iStart;
+            int iEnd;
+            char cEnd = ')';
+
+            i += 4;
+            while (i < n && ISSPACE(z[i])) i++;
+            if (i < n && (z[i] == '"' || z[i] == '\'')) {
+                cEnd = z[i++];
+            }
+            iStart = i;
+            for (iEnd = iStart; iEnd < n && z[iEnd] != cEnd; iEnd++);
+            if (iEnd == n) break;
+            preloadAdd(pTree, pBatch, "url", &z[iStart], iEnd-iStart, doEscape);
+            i = iEnd;
+        }
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * preloadFindClose --
+ *
+ *     Search the nul-terminated text z, starting at offset i, for the 
+ *     closing tag zClose (i.e. "</script"), ignoring case. 
+ *
+ * Results:
+ *     The offset of the closing tag, or -1 if it is not found.
+ *
+ * Side effects:
+ *     If the closing tag is not found, *piResume is set to the offset 
+ *     at which the search should resume once more text is appended (the
+ *     last '<' character, which may begin a partial closing tag, or the 
+ *     end of the text).
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+preloadFindClose (const char *z, int i, const char *zClose, int *piResume)
+{
+    int nClose = strlen(zClose);
+    const char *zCsr;
+    const char *zLast = 0;
+    for (zCsr = strchr(&z[i], '<'); zCsr; zCsr = strchr(&zCsr[1], '<')) {
+        if (0 == strnicmp(zCsr, zClose, nClose)) {
+            return (int)(zCsr - z);
+        }
+        zLast = zCsr;
+    }
+    *piResume = zLast ? (int)(zLast - z) : i + strlen(&z[i]);
+    return -1;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * preloadScanTag --
+ *
+ *     Scan the markup tag beginning at offset i of the nul-terminated 
+ *     text z (z[i] is a '<' character that is followed by a tag name) and
+ *     report any resource URIs it contains.
+ *
+ *     If the tag is a <script> or <style> whose content was found to be
+ *     incomplete by an earlier scan, *piResume is the offset at which to 
+ *     resume the search for the closing tag. Otherwise it is 0.
+ *
+ * Results:
+ *     The offset of the first byte following the tag, including the 
+ *     content of <script> and <style> elements. Or -1 if the tag (or the
+ *     content) is incomplete.
+ *
+ * Side effects:
+ *     See preloadAdd(). If the content of a <script> or <style> element
+ *     is incomplete, *piResume is set as described for preloadFindClose().
+ *     Otherwise it is set to 0.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+preloadScanTag (
+    HtmlTree *pTree, 
+    Tcl_Obj *pBatch, 
+    const char *z, 
+    int i,
+    int *piResume                  /* IN/OUT: Offset to resume search at */
+){
+    /* Attributes of interest. Values are stored in azValue[]/anValue[] */
+    static const char *azAttr[] = {"src", "href", "rel", "style"};
+    const char *azValue[4] = {0, 0, 0, 0};
+    int anValue[4] = {0, 0, 0, 0};
+
+    const char *zSrc;
+    const char *zHref;
+    const char *zRel;
+
+    const char *zTag = &z[i + 1];
+    int nTag = 0;
+    int iResume = *piResume;
+    int j;
+
+    *piResume = 0;
+    while (ISALPHA(zTag[nTag]) || isdigit((unsigned char)zTag[nTag])) nTag++;
+    j = i + 1 + nTag;
+
+    while (1) {
+        const char *zName;
+        int nName;
+        const char *zValue = "";
+        int nValue = 0;
+        int k;
+
+        while (ISSPACE(z[j]) || z[j] == '/') j++;
+        if (z[j] == '\0') return -1;
+        if (z[j] == '>') break;
+
+        zName = &z[j];
+        for (nName = 0; 
+            z[j] && !ISSPACE(z[j]) && z[j] != '=' && z[j] != '>'; 
+            j++, nName++
+        );
+        while (ISSPACE(z[j])) j++;
+        if (z[j] == '=') {
+            j++;
+            while (ISSPACE(z[j])) j++;
+            if (z[j] == '"' || z[j] == '\'') {
+                const char *zEnd = strchr(&z[j + 1], z[j]);
+                if (!zEnd) return -1;
+                zValue = &z[j + 1];
+                nValue = (int)(zEnd - zValue);
+                j = (int)(zEnd - z) + 1;
+            } else {
+                zValue = &z[j];
+                while (z[j] && !ISSPACE(z[j]) && z[j] != '>') j++;
+                nValue = (int)(&z[j] - zValue);
+            }
+        }
+        if (z[j] == '\0') return -1;
+
+        for (k = 0; k < 4; k++) {
+            if ((int)strlen(azAttr[k]) == nName && 
+                0 == strnicmp(zName, azAttr[k], nName)
+            ){
+                azValue[k] = zValue;
+                anValue[k] = nValue;
+            }
+        }
+    }
+    j++;
+
+    zSrc = azValue[0];
+    zHref = azValue[1];
+    zRel = azValue[2];
+    if (azValue[3]) {
+        preloadCssUrls(pTree, pBatch, azValue[3], anValue[3], 1);
+    }
+
+    if (nTag == 3 && 0 == strnicmp(zTag, "img", 3) && zSrc) {
+        preloadAdd(pTree, pBatch, "image", zSrc, anValue[0], 1);
+    }
+    else if (nTag == 4 && 0 == strnicmp(zTag, "link", 4) && zHref && zRel) {
+        /* The rel attribute is a space separated list of link types */
+        int nRel = anValue[2];
+        int k;
+        for (k = 0; k + 10 <= nRel; k++) {
+            if (0 == strnicmp(&zRel[k], "stylesheet", 10) &&
+                (k == 0 || ISSPACE(zRel[k - 1])) &&
+                (k + 10 == nRel || ISSPACE(zRel[k + 10]))
+            ) {
+                preloadAdd(pTree, pBatch, "stylesheet", zHref, anValue[1], 1);
+                break;
+            }
+        }
+    }
+    else if (nTag == 6 && 0 == strnicmp(zTag, "script", 6)) {
+        /* Skip the script content so that any markup-like text it 
+         * contains is not mistaken for document markup. 
+         */
+        if (zSrc) {
+            preloadAdd(pTree, pBatch, "script", zSrc, anValue[0], 1);
+        }
+        j = preloadFindClose(z, MAX(j, iResume), "</script", piResume);
+    }
+    else if (nTag == 5 && 0 == strnicmp(zTag, "style", 5)) {
+        int iClose = preloadFindClose(z, MAX(j, iResume), "</style", piResume);
+        if (iClose >= 0) {
+            preloadCssUrls(pTree, pBatch, &z[j], iClose - j, 0);
+        }
+        j = iClose;
+    }
+
+    return j;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * preloadScan --
+ *
+ *     Scan the document text that has not yet been scanned for resource
+ *     URIs. If any new URIs are found, invoke the -preloadcmd script with
+ *     a single argument appended - a list of alternating types and URIs 
+ *     (e.g. "image a.png stylesheet b.css").
+ *
+ *     If isFinal is false, scanning stops at the first incomplete tag.
+ *
+ * Results:
+ *     Zero if the -preloadcmd script replaced the document (by invoking 
+ *     the [reset] command), or non-zero otherwise.
+ *
+ * Side effects:
+ *     May invoke the -preloadcmd script.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+preloadScan (HtmlTree *pTree, int isFinal)
+{
+    int iDocument = pTree->iDocument;
+    Tcl_Obj *pBatch;
+    const char *z;
+    int nDoc;
+    int i;
+    int nUri;
+    int rc = 1;
+    int iResume;
+
+    z = documentText(pTree, &nDoc);
+    i = pTree->nPreloaded;
+    iResume = pTree->iPreloadResume;
+
+    pBatch = Tcl_NewObj();
+    Tcl_IncrRefCount(pBatch);
+    while (i < nDoc) {
+        const char *zLt = memchr(&z[i], '<', nDoc - i);
+        int iNext;
+
+        if (!zLt) {
+            i = nDoc;
+            break;
+        }
+        i = (int)(zLt - z);
+
+        /* iResume applies only to the construct at HtmlTree.nPreloaded */
+        if (i != pTree->nPreloaded) iResume = 0;
+
+        if (0 == strncmp(&z[i], "<!--", 4)) {
+            const char *zEnd = strstr(&z[MAX(i + 4, iResume)], "-->");
+            iNext = zEnd ? (int)(zEnd - z) + 3 : -1;
+            iResume = zEnd ? 0 : MAX(i + 4, nDoc - 2);
+        } else if (ISALPHA(z[i + 1])) {
+            iNext = preloadScanTag(pTree, pBatch, z, i, &iResume);
+        } else if (nDoc - i < 4 && 0 == strncmp(&z[i], "<!--", nDoc - i)) {
+            /* Possibly the start of a comment */
+            iNext = -1;
+        } else {
+            iNext = i + 1;
+        }
+
+        if (iNext < 0) {
+            /* Incomplete. Unless this is the end of the document, pick 
+             * up from here after the next chunk is appended. 
+             */
+            if (isFinal) i = nDoc;
+            break;
+        }
+        i = iNext;
+    }
+    pTree->iPreloadResume = (i < nDoc) ? iResume : 0;
+    pTree->nPreloaded = i;
+
+    Tcl_ListObjLength(0, pBatch, &nUri);
+    if (nUri > 0) {
+        Tcl_Interp *interp = pTree->interp;
+        Tcl_Obj *pScript = Tcl_DuplicateObj(pTree->options.preloadcmd);
+        Tcl_IncrRefCount(pScript);
+        Tcl_ListObjAppendElement(0, pScript, pBatch);
+        HtmlLog(pTree, "PARSE", "Preload scanner: %d new URIs", nUri / 2);
+        if (TCL_OK != Tcl_EvalObjEx(interp, pScript, TCL_EVAL_GLOBAL)) {
+            Tcl_BackgroundError(interp);
+        }
+        Tcl_DecrRefCount(pScript);
+        /* Compare document generations, not text pointers. If the script 
+         * calls [reset] and then [parse], the new text may be allocated
+         * at the same address as the old.
+         */
+        rc = (pTree->iDocument == iDocument);
+    }
+    Tcl_DecrRefCount(pBatch);
+    return rc;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * tokenizeAppended --
+ *
+ *     This is called after text has been added to the document by 
+ *     HtmlTokenizerAppend() or HtmlTokenizerAppendFile(). Run the preload 
+ *     scanner over the new text, then tokenize it (in the background if
+ *     -asyncparse allows).
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May invoke the -preloadcmd script, node-handler scripts etc.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+tokenizeAppended (HtmlTree *pTree, int isFinal)
+{
+    /* Report resource URIs in the new text before tokenizing it. If the
+     * -preloadcmd script calls [reset], the text is gone.
+     */
+    if (pTree->options.preloadcmd && !preloadScan(pTree, isFinal)) {
+        return;
+    }
+
+    /* If a background tokenizer job is running, the new text is picked
+     * up when it finishes. 
+     */
+    if (pTree->pParseJob) return;
+
+    if (
+        pTree->eWriteState == HTML_WRITE_NONE && 
+        !asyncParseStart(pTree, isFinal)
+    ) {
+        tokenizeWrapper(pTree, isFinal, 
+            HtmlTreeAddText,
+            HtmlTreeAddElement,
+            HtmlTreeAddClosingTag
+        );
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerAppend --
+ *
+ *     Append text to the tokenizer engine.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     This routine (actually the Tokenize() subroutine that is called
+ *     by this routine) may invoke a callback procedure which could delete
+ *     the HTML widget. 
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlTokenizerAppend (HtmlTree *pTree, const char *zText, int nText, int isFinal)
+{
+    /* TODO: Add a flag to prevent recursive calls to this routine. */
+    const char *z = zText;
+    int n = nText;
+    /* Tcl_DString utf8; */
+
+    documentMaterialize(pTree);
+    if (!pTree->pDocument) {
+        pTree->pDocument = Tcl_NewObj();
+        Tcl_IncrRefCount(pTree->pDocument);
+        assert(!Tcl_IsShared(pTree->pDocument));
+    }
+
+    assert(!Tcl_IsShared(pTree->pDocument));
+    Tcl_AppendToObj(pTree->pDocument, z, n);
+
+    tokenizeAppended(pTree, isFinal);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerAppendFile --
+ *
+ *     Append the contents of file zFile to the document, as for 
+ *     [$html parse -file]. The file is assumed to be encoded in UTF-8.
+ *
+ *     If there is no document text yet, the file is memory-mapped and 
+ *     tokenized in place. This avoids both the copy made by reading the
+ *     file into a Tcl object and the copy made by appending that object
+ *     to HtmlTree.pDocument. Text nodes and attributes copy the parts of
+ *     the file they need, as usual. The mapping is followed by at least 
+ *     one zero byte (from an anonymous mapping), so the text is 
+ *     nul-terminated like a Tcl string. A nul byte in the file therefore
+ *     ends the document. The file must not be truncated while it is 
+ *     mapped - accessing a page beyond the new end of file raises SIGBUS.
+ *
+ *     Otherwise (or if the file cannot be mapped) the file is read into
+ *     a Tcl object and passed to HtmlTokenizerAppend(). The channel is 
+ *     configured for binary input and the text is truncated at the first
+ *     nul byte, so that the tokenizer sees exactly the same bytes as it
+ *     would if the file were mapped.
+ *
+ * Results:
+ *     TCL_OK, or TCL_ERROR if the file cannot be read (an error message
+ *     is left in the interpreter).
+ *
+ * Side effects:
+ *     See HtmlTokenizerAppend().
+ *
+ *---------------------------------------------------------------------------
+ */
+int 
+HtmlTokenizerAppendFile (HtmlTree *pTree, const char *zFile, int isFinal)
+{
+    Tcl_Interp *interp = pTree->interp;
+    Tcl_Channel chan;
+    Tcl_Obj *pText;
+    const char *zText;
+    const char *zNul;
+    int nText;
+
+#ifdef HTML_MMAP_FILE
+    if (!HtmlTokenizerHasDocument(pTree)) {
+        Tcl_DString path;
+        const char *zNative = Tcl_TranslateFileName(0, zFile, &path);
+        char *zMap = MAP_FAILED;
+        struct stat sStat;
+        int fd = (zNative ? open(zNative, O_RDONLY) : -1);
+
+        if (fd >= 0 && 
+            0 == fstat(fd, &sStat) && 
+            S_ISREG(sStat.st_mode) &&
+            sStat.st_size > 0 && 
+            sStat.st_size < INT_MAX
+        ) {
+            size_t nMap = (size_t)sStat.st_size;
+
+            /* Reserve nMap+1 bytes of zeroed memory, then map the file
+             * over the start of the reservation. 
+             */
+            zMap = mmap(0, nMap+1, PROT_READ, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+            if (zMap != MAP_FAILED && MAP_FAILED == mmap(
+                    zMap, nMap, PROT_READ, MAP_PRIVATE|MAP_FIXED, fd, 0
+            )) {
+                munmap(zMap, nMap + 1);
+                zMap = MAP_FAILED;
+            }
+        }
+        if (fd >= 0) close(fd);
+        if (zNative) Tcl_DStringFree(&path);
+
+        if (zMap != MAP_FAILED) {
+            pTree->zMapped = zMap;
+            pTree->nMapped = (int)sStat.st_size;
+            HtmlLog(pTree, "PARSE", "Mapped %d bytes from %s", 
+                pTree->nMapped, zFile
+            );
+            tokenizeAppended(pTree, isFinal);
+            return TCL_OK;
+        }
+    }
+#endif
+
+    chan = Tcl_OpenFileChannel(interp, zFile, "r", 0);
+    if (!chan) {
+        return TCL_ERROR;
+    }
+    Tcl_SetChannelOption(0, chan, "-translation", "binary");
+    pText = Tcl_NewObj();
+    Tcl_IncrRefCount(pText);
+    if (Tcl_ReadChars(chan, pText, -1, 0) < 0) {
+        Tcl_AppendResult(interp, "error reading \"", zFile, "\": ",
+            Tcl_PosixError(interp), 0
+        );
+        Tcl_Close(0, chan);
+        Tcl_DecrRefCount(pText);
+        return TCL_ERROR;
+    }
+    Tcl_Close(0, chan);
+
+    zText = (const char *)Tcl_GetByteArrayFromObj(pText, &nText);
+    if ((zNul = memchr(zText, 0, nText))) {
+        nText = (int)(zNul - zText);
+    }
+    HtmlTokenizerAppend(pTree, zText, nText, isFinal);
+    Tcl_DecrRefCount(pText);
+    return TCL_OK;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTokenizerDiscard --
+ *
+ *     Discard the part of the document text (HtmlTree.pDocument) that has
+ *     already been tokenized. This is called by [$html parse -discard] 
+ *     so that the memory used to store the document text is bounded by
+ *     the size of the unparsed tail (usually an incomplete tag or text 
+ *     node at the end of the last chunk), not the size of the document. 
+ *     The tree does not refer to the document text - text nodes and 
+ *     attributes store their own copies.
+ *
+ *     Nothing is discarded while a script handler is running or a 
+ *     [write wait] is pending, as [write text] inserts text at an offset
+ *     within the stored document. If a background tokenizer job is 
+ *     running, the text is discarded when it finishes.
+ *
+ *     HtmlTree.nDiscarded accumulates the number of bytes discarded, so
+ *     that the offsets passed to parse handler scripts are still relative
+ *     to the start of the document.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May replace HtmlTree.pDocument and modify HtmlTree.nParsed.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlTokenizerDiscard (HtmlTree *pTree)
+{
+#ifdef HTML_ASYNC_PARSE
+    if (pTree->pParseJob) {
+        pTree->pParseJob->isDiscard = 1;
+        return;
+    }
+#endif
+    if (HtmlTokenizerHasDocument(pTree) && 
+        pTree->nParsed > 0 && 
+        pTree->eWriteState == HTML_WRITE_NONE
+    ) {
+        int nDoc;
+        const char *zDoc = documentText(pTree, &nDoc);
+        Tcl_Obj *pTail;
+
+        assert(pTree->nParsed <= nDoc);
+        pTail = Tcl_NewStringObj(&zDoc[pTree->nParsed], nDoc-pTree->nParsed);
+        Tcl_IncrRefCount(pTail);
+        HtmlTokenizerRelease(pTree);
+        pTree->pDocument = pTail;
+
+        pTree->nDiscarded += pTree->nParsed;
+        if (pTree->nPreloaded < pTree->nParsed) {
+            pTree->iPreloadResume = 0;
+        } else if (pTree->iPreloadResume > 0) {
+            pTree->iPreloadResume -= pTree->nParsed;
+        }
+        pTree->nPreloaded = MAX(0, pTree->nPreloaded - pTree->nParsed);
+        pTree->nParsed = 0;
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlMarkupArg --
+ *
+ *     Lookup an argument in the given markup with the name given.
+ *     Return a pointer to its value, or the given default
+ *     value if it doesn't appear.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+char *
+HtmlMarkupArg (HtmlAttributes *pAttr, const char *zTag, char *zDefault)
+{
+    if (pAttr && pAttr->nAttr > 0) {
+        /* Look up the name atom once, then compare names by pointer (using
+         * the hash index for elements with many attributes). If there is 
+         * no atom for zTag, then no element has an attribute of that name.
+         */
+        const char *zAtom = HtmlAttrAtom(zTag, 0);
+        if (zAtom) {
+            return HtmlMarkupArgAtom(pAttr, zAtom, zDefault);
+        }
+    }
+    return zDefault;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlWriteWait --
+ *
+ *     $widget write wait
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+int 
+HtmlWriteWait (HtmlTree *pTree)
+{
+    if (pTree->eWriteState != HTML_WRITE_INHANDLER) {
+        char *zErr = "Cannot call [write wait] here";
+        Tcl_SetResult(pTree->interp, zErr, TCL_STATIC);
+        return TCL_ERROR;
+    }
+
+    pTree->eWriteState = HTML_WRITE_INHANDLERWAIT;
+    return TCL_OK;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlWriteText --
+ *
+ *     $widget write text HTML
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+int 
+HtmlWriteText(HtmlTree *pTree, Tcl_Obj *pText)
+{
+    int iInsert = pTree->iWriteInsert;
+  
+    Tcl_Obj *pDocument;
+    Tcl_Obj *pHead;
+    Tcl_Obj *pTail;
+
+    if (pTree->eWriteState == HTML_WRITE_NONE) {
+        char *zErr = "Cannot call [write text] here";
+        Tcl_SetResult(pTree->interp, zErr, TCL_STATIC);
+        return TCL_ERROR;
+    }
+    documentMaterialize(pTree);
+    pDocument = pTree->pDocument;
+
+    pHead = Tcl_NewStringObj(Tcl_GetString(pDocument), iInsert);
+    pTail = Tcl_NewStringObj(&(Tcl_GetString(pDocument)[iInsert]), -1);
+
+    Tcl_IncrRefCount(pHead);
+    Tcl_AppendObjToObj(pHead, pText);
+    Tcl_GetStringFromObj(pHead, &pTree->iWriteInsert);
+    Tcl_AppendObjToObj(pHead, pTail);
+
+    Tcl_DecrRefCount(pDocument);
+    pTree->pDocument = pHead;
+
+    /* Have the preload scanner look at the inserted text too */
+    pTree->nPreloaded = MIN(pTree->nPreloaded, iInsert);
+    if (pTree->iPreloadResume > iInsert) {
+        pTree->iPreloadResume = 0;
+    }
  
     return TCL_OK;
 }
@@ -82,6 +82,7 @@ struct PropertyDef {
     Tcl_Obj *(*xObj)(HtmlComputedValues *);
     int isInherit;             /* True to inherit by default */
     int isNolayout;            /* Can be changed without relayout */
+    int isParentLayout;        /* Changes require relayout of parent only */
 };
 
 #define PROPDEF(w, x, y) {                                   \
@@ -283,7 +284,30 @@ static int nolayoutlist[] = {
     CSS_PROPERTY_BACKGROUND_REPEAT,
     CSS_PROPERTY_VISIBILITY,
     CSS_PROPERTY_BACKGROUND_POSITION_X,
-    CSS_PROPERTY_BACKGROUND_POSITION_Y
+    CSS_PROPERTY_BACKGROUND_POSITION_Y,
+    CSS_PROPERTY_OUTLINE_STYLE,
+    CSS_PROPERTY_OUTLINE_WIDTH,
+    CSS_PROPERTY_CURSOR
+};
+
+/*
+ * The following properties change the position of a box within its
+ * containing block, but not the layout of the box content. When they
+ * change the layout caches of the ancestors of the node must be
+ * discarded, but the layout cache belonging to the node itself may be 
+ * reused (it is only used if the width available for content and the
+ * collapsing margins are the same as when it was created).
+ */
+static int parentlayoutlist[] = {
+    CSS_PROPERTY_MARGIN_TOP,
+    CSS_PROPERTY_MARGIN_RIGHT,
+    CSS_PROPERTY_MARGIN_BOTTOM,
+    CSS_PROPERTY_MARGIN_LEFT,
+    CSS_PROPERTY_TOP,
+    CSS_PROPERTY_RIGHT,
+    CSS_PROPERTY_BOTTOM,
+    CSS_PROPERTY_LEFT,
+    CSS_PROPERTY_CLEAR
 };
 
 
@@ -331,6 +355,11 @@ static PropertyDef *getPropertyDef(int eProp){
                 a[nolayoutlist[i]]->isNolayout = 1;
             }
         }
+        for (i = 0; i < sizeof(parentlayoutlist)/sizeof(int); i++){
+            if (a[parentlayoutlist[i]]) {
+                a[parentlayoutlist[i]]->isParentLayout = 1;
+            }
+        }
         isInit = 1;
     }
     return a[eProp];
@@ -1956,6 +1985,7 @@ HtmlComputedValuesInit (
     p->pTree = pTree;
     p->pParent = pParent;
     p->pNode = pNode;
+    p->isTclScript = 0;
 
     /* Copy property values that are inherited by default from the 
      * properties of the parent node, if there is one.
@@ -2001,6 +2031,12 @@ propertyValuesTclScript (HtmlComputedValuesCreator *p, int eProp, const char *zS
     Tcl_Interp *interp = p->pTree->interp;
     Tcl_Obj *pCommand = HtmlNodeCommand(p->pTree, p->pNode);
 
+    /* The result of a tcl() script may depend on anything at all, so the
+     * computed values of this node may not be shared with other nodes 
+     * (see HtmlCssStyleSheetApply() and styleNode()). 
+     */
+    p->isTclScript = 1;
+
     Tcl_SetVar2Ex(interp, "N", 0, pCommand, 0);
     rc = Tcl_Eval(interp, zScript);
     zRes = Tcl_GetStringResult(interp);
@@ -3309,19 +3345,34 @@ HtmlNodeProperties(Tcl_Interp *interp, HtmlComputedValues *pValues)
     return TCL_OK;
 }
 
-#define HTML_REQUIRE_CONTENT 3
-#define HTML_REQUIRE_LAYOUT 2
-#define HTML_REQUIRE_PAINT  1
-#define HTML_OK     0
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlComputedValuesCompare --
+ *
+ *     Compare two sets of computed values for the same node, the new
+ *     values pV1 and the old values pV2 (either of which may be NULL),
+ *     and classify the change according to the work required to update
+ *     the display.
+ *
+ * Results:
+ *     One of the HTML_STYLE_XXX values defined in htmlprop.h. 
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
 int 
 HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
 {
     unsigned char *v1 = (unsigned char *)pV1;
     unsigned char *v2 = (unsigned char *)pV2;
+    int eRet = HTML_STYLE_REPAINT;
     int ii;
 
     if (pV1 == pV2) {
-        return HTML_OK;
+        return HTML_STYLE_SAME;
     }
 
     /* 
@@ -3337,7 +3388,7 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
         (pV1 && pV2 && pV2->clCounterIncrement != pV1->clCounterIncrement) ||
         (pV1 && pV2 && pV2->clCounterReset != pV1->clCounterReset)
     ) {
-        return HTML_REQUIRE_CONTENT;
+        return HTML_STYLE_CONTENT;
     }
 
     /* 
@@ -3347,6 +3398,7 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
      *     'list-style-image'
      *     'font'
      *     'vertical-align'
+     *     'line-height'
      */
     if (
         !pV1 || !pV2 ||
@@ -3354,20 +3406,20 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
         pV1->imListStyleImage != pV2->imListStyleImage     ||
         pV1->fFont != pV2->fFont ||
         pV1->eVerticalAlign != pV2->eVerticalAlign ||
-        (!pV1->eVerticalAlign && pV1->iVerticalAlign != pV1->iVerticalAlign)
+        (!pV1->eVerticalAlign && pV1->iVerticalAlign != pV2->iVerticalAlign) ||
+        pV1->iLineHeight != pV2->iLineHeight
     ) {
-        return HTML_REQUIRE_LAYOUT;
+        return HTML_STYLE_LAYOUT;
     }
 
     for (ii = 0; ii < sizeof(propdef) / sizeof(propdef[0]); ii++){
         PropertyDef *pDef = &propdef[ii];
+        int isDiff = 0;
         if (pDef->isNolayout) continue;
         switch (pDef->eType) {
 
             case ENUM: {
-                if (*(v1 + pDef->iOffset) != *(v2 + pDef->iOffset)) {
-                    return HTML_REQUIRE_LAYOUT;
-                }
+                isDiff = (*(v1 + pDef->iOffset) != *(v2 + pDef->iOffset));
                 break;
             }
 
@@ -3375,14 +3427,10 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
             case LENGTH: {
                 int *pL1 = (int *)(v1 + pDef->iOffset);
                 int *pL2 = (int *)(v2 + pDef->iOffset);
- 
-                if (
+                isDiff = (
                     *pL1 != *pL2 || 
                     ((pDef->mask & pV1->mask) != (pDef->mask & pV2->mask))
-                ) {
-                    return HTML_REQUIRE_LAYOUT;
-                }
- 
+                );
                 break;
             }
 
@@ -3393,9 +3441,7 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
             case AUTOINTEGER: {
                 int *pI1 = (int *)(v1 + pDef->iOffset);
                 int *pI2 = (int *)(v2 + pDef->iOffset);
-                if (*pI1 != *pI2) {
-                    return HTML_REQUIRE_LAYOUT;
-                }
+                isDiff = (*pI1 != *pI2);
                 break;
             }
 
@@ -3407,8 +3453,21 @@ HtmlComputedValuesCompare (HtmlComputedValues *pV1, HtmlComputedValues *pV2)
                 /* TODO */
                 break;
         }
+
+        if (isDiff) {
+            if (pDef->eProp == CSS_PROPERTY_Z_INDEX) {
+                /* The stacking order is recalculated by HtmlRestackNodes()
+                 * if the 'z-index' of a stacking context changes.  
+                 */
+                eRet = MAX(eRet, HTML_STYLE_RESTACK);
+            } else if (pDef->isParentLayout) {
+                eRet = MAX(eRet, HTML_STYLE_ANCESTORS);
+            } else {
+                return HTML_STYLE_LAYOUT;
+            }
+        }
     }
 
-    return HTML_REQUIRE_PAINT;
+    return eRet;
 }
 
@@ -330,6 +330,8 @@ struct HtmlComputedValuesCreator {
 
     CssProperty *pContent;
     char **pzContent;
+
+    int isTclScript;                 /* True if a tcl() value was evaluated */
 };
 
 /*
@@ -472,10 +474,26 @@ int HtmlNodeProperties(Tcl_Interp *, HtmlComputedValues *);
 int HtmlNodeGetProperty(Tcl_Interp *, Tcl_Obj *, HtmlComputedValues *);
 
 /*
- * Determine if changing the computed properties of a node from one
- * argument structure to the other requires a re-layout. Return 1 if it
- * does, or 0 otherwise.
+ * Determine the work required to update the display when the computed 
+ * properties of a node change from one argument structure to the other.
+ * Returns one of the following values, in order of increasing cost:
+ *
+ *     HTML_STYLE_SAME       - Nothing that affects rendering has changed.
+ *     HTML_STYLE_REPAINT    - Repaint the node only (i.e. 'color').
+ *     HTML_STYLE_RESTACK    - Recalculate the stacking order and repaint
+ *                             (i.e. 'z-index').
+ *     HTML_STYLE_ANCESTORS  - Relayout the ancestors of the node, but not 
+ *                             the node content (i.e. 'margin-top').
+ *     HTML_STYLE_LAYOUT     - Relayout the node and its ancestors.
+ *     HTML_STYLE_CONTENT    - Relayout, and regenerate the content of the
+ *                             nodes that follow (counters have changed).
  */
+#define HTML_STYLE_SAME       0
+#define HTML_STYLE_REPAINT    1
+#define HTML_STYLE_RESTACK    2
+#define HTML_STYLE_ANCESTORS  3
+#define HTML_STYLE_LAYOUT     4
+#define HTML_STYLE_CONTENT    5
 int HtmlComputedValuesCompare(HtmlComputedValues *, HtmlComputedValues *);
 
 
@@ -113,10 +113,8 @@ HtmlDelStackingInfo (HtmlTree *pTree, HtmlElementNode *pElem)
 #define STACK_AUTO      2
 #define STACK_CONTEXT   3
 static int 
-stackType (HtmlNode *p)
+stackType (HtmlNode *p, HtmlComputedValues *pV)
 {
-    HtmlComputedValues *pV = HtmlNodeComputedValues(p);
-
     /* STACK_CONTEXT is created by the root element and any
      * positioned block with (z-index!='auto).
      */
@@ -141,10 +139,30 @@ stackType (HtmlNode *p)
 }
 
 static void 
-addStackingInfo (HtmlTree *pTree, HtmlElementNode *pElem)
+addStackingInfo (
+    HtmlTree *pTree, 
+    HtmlElementNode *pElem,
+    HtmlNodeStack *pOld,              /* Stack previously owned by pElem */
+    HtmlComputedValues *pOldValues    /* Previous computed values of pElem */
+)
 {
     HtmlNode *pNode = (HtmlNode *)pElem;
-    int eStack = stackType(pNode);
+    int eStack = stackType(pNode, pElem->pPropertyValues);
+
+    /* If pElem already owned an HtmlNodeStack of the same type, and the
+     * 'z-index' has not changed, reuse it. Its position in the stacking
+     * order is the same, so there is no need to run HtmlRestackNodes().
+     */
+    if (pOld) {
+        pElem->pStack = pOld;
+        if (
+            pOld->eType == eStack && 
+            pOldValues->iZIndex == pElem->pPropertyValues->iZIndex
+        ) {
+            return;
+        }
+        HtmlDelStackingInfo(pTree, pElem);
+    }
     
     /* A node forms a new stacking context if it is positioned or floating.
      * Or if it is the root node. We only need create an HtmlNodeStack if this
@@ -449,6 +467,161 @@ printf("Stack %d: %s %s\n", iTmp,
     HtmlFree(apTmp);
 }
 
+/*
+ * The style sharing cache. While the children of a node are being styled,
+ * the StyleApply.pShare variable points to an instance of the following
+ * structure, which stores the most recently styled children whose computed
+ * values may be shared. A node with the same tag, attributes and dynamic 
+ * flags as one of these reuses the HtmlComputedValues structure instead
+ * of having the stylesheet applied to it (see styleNode()).
+ *
+ * Only siblings share computed values, as cousins with identical parent
+ * computed values may still match different descendant selectors.
+ */
+#define STYLE_SHARE_SIZE 8
+typedef struct StyleShare StyleShare;
+struct StyleShare {
+  int iNext;                                 /* Next slot in apElem to use */
+  HtmlElementNode *apElem[STYLE_SHARE_SIZE]; /* Recently styled siblings */
+};
+
+typedef struct StyleCounter StyleCounter;
+struct StyleCounter {
+  char *zName;
+  int iValue;
+};
+
+struct StyleApply {
+  /* Set of nodes to begin recalculating style at */
+  Tcl_HashTable *pRestyle;
+
+  /* True if currently traversing a member of pRestyle or a descendent
+   * of a member. If isSiblingRules is true, this also covers the 
+   * right-siblings of a member and their descendents.
+   */
+  int doStyle;
+
+  /* True if the stylesheets contain rules that depend on the siblings
+   * of a node (see HtmlCssHasSiblingRules()). A restyled node may then
+   * change the computed style of its right-siblings.
+   */
+  int isSiblingRules;
+
+  int doContent;
+
+  /* True if the whole tree is being restyled. */
+  int isRoot;
+
+  StyleCounter **apCounter;
+  int nCounter;
+  int nCounterAlloc;
+  int nCounterStartScope;
+
+  /* True if we have seen one or more "fixed" items */
+  int isFixed;
+
+  /* Tag names, ids and classes of the ancestors of the current node */
+  CssAncestorFilter filter;
+
+  /* Style sharing cache for the children of the current parent node, and
+   * the number of nodes styled and the number that shared computed 
+   * values with a sibling (for logging).
+   */
+  StyleShare *pShare;
+  int nShareTest;
+  int nShareHit;
+
+  /* Number of nodes styled for each HTML_STYLE_XXX class of change. */
+  int aClass[HTML_STYLE_CONTENT+1];
+};
+typedef struct StyleApply StyleApply;
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * styleShareEligible --
+ *
+ *     Return true if node pElem may share computed values with a sibling.
+ *     Nodes with an "id" attribute are excluded (they are unlikely to 
+ *     have an identical sibling), as are nodes with property overrides 
+ *     and the root node. 
+ *
+ * Results:
+ *     True if pElem may share computed values.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+styleShareEligible (HtmlElementNode *pElem)
+{
+    return (
+        pElem->node.pParent && 
+        !pElem->pOverride && 
+        !HtmlNodeAttr(&pElem->node, "id")
+    );
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * styleShareLookup --
+ *
+ *     Search the style sharing cache p->pShare for a sibling of pElem 
+ *     with the same tag, attributes (including any "style" attribute) 
+ *     and dynamic flags as pElem. Attribute names are atoms, so they are
+ *     compared by pointer.
+ *
+ * Results:
+ *     Pointer to the matching sibling, or NULL if there is no match.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static HtmlElementNode *
+styleShareLookup (StyleApply *p, HtmlElementNode *pElem)
+{
+    StyleShare *pShare = p->pShare;
+    HtmlAttributes *pAttr = pElem->pAttributes;
+    int nAttr = (pAttr ? pAttr->nAttr : 0);
+    int ii;
+
+    if (!pShare || !styleShareEligible(pElem)) return 0;
+
+    for (ii = 0; ii < STYLE_SHARE_SIZE; ii++) {
+        HtmlElementNode *pOther = pShare->apElem[ii];
+        HtmlAttributes *pOtherAttr;
+        int jj;
+
+        if (!pOther) continue;
+        pOtherAttr = pOther->pAttributes;
+        if (
+            pOther->node.eTag != pElem->node.eTag ||
+            strcmp(pOther->node.zTag, pElem->node.zTag) ||
+            pOther->flags != pElem->flags ||
+            (pOtherAttr ? pOtherAttr->nAttr : 0) != nAttr
+        ) {
+            continue;
+        }
+        for (jj = 0; jj < nAttr; jj++) {
+            if (
+                pAttr->a[jj].zName != pOtherAttr->a[jj].zName ||
+                strcmp(pAttr->a[jj].zValue, pOtherAttr->a[jj].zValue)
+            ) {
+                break;
+            }
+        }
+        if (jj == nAttr) {
+            return pOther;
+        }
+    }
+    return 0;
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -466,23 +639,35 @@ static int
 styleNode(
     HtmlTree *pTree,
     HtmlNode *pNode,
-    ClientData clientData
+    StyleApply *p
     )
 {
     CONST char *zStyle;      /* Value of "style" attribute for node */
-    int trashDynamics = (int)((size_t) clientData);
+    int trashDynamics = p->isRoot;
+    HtmlElementNode *pSibling;
 
     HtmlElementNode *pElem = (HtmlElementNode *)pNode;
     HtmlComputedValues *pV = pElem->pPropertyValues;
+    HtmlNodeStack *pStack = 0;
+
+    /* Detach the stacking context owned by this node, if any. It is
+     * either reused or deleted by addStackingInfo() below. If this node
+     * does not own a stacking context, pElem->pStack may point to the 
+     * (already deleted) context of an ancestor, so it is not dereferenced.
+     */
+    if (pV && stackType(pNode, pV) != STACK_NONE) {
+        pStack = pElem->pStack;
+        assert(pStack && pStack->pElem == pElem);
+    }
     pElem->pPropertyValues = 0;
-    HtmlDelStackingInfo(pTree, pElem);
+    pElem->pStack = 0;
 
-    /* If the clientData was set to a non-zero value, then the 
+    /* If the whole tree is being restyled, then the 
      * stylesheet configuration has changed. In this case we need to
      * recalculate the nodes list of dynamic conditions.
      */
     if (trashDynamics) {
-        HtmlCssFreeDynamics(pElem);
+        HtmlCssFreeDynamics(pTree, pElem);
     }
 
     /* If there is a "style" attribute on this node, parse the attribute
@@ -505,72 +690,71 @@ styleNode(
         }
     }
 
-    /* Recalculate the properties for this node */
-    HtmlCssStyleSheetApply(pTree, pNode);
+    /* Recalculate the properties for this node. If a recently styled
+     * sibling has the same tag, attributes and dynamic flags, use its
+     * computed values instead of applying the stylesheet again. Otherwise
+     * apply the stylesheet and, if the result is shareable, add this node
+     * to the style sharing cache.
+     */
+    p->nShareTest++;
+    pSibling = styleShareLookup(p, pElem);
+    if (pSibling) {
+        pElem->pPropertyValues = pSibling->pPropertyValues;
+        HtmlComputedValuesReference(pElem->pPropertyValues);
+        HtmlCssShareDynamics(pTree, pElem, pSibling);
+        p->nShareHit++;
+    } else {
+        int isShareable = HtmlCssStyleSheetApply(pTree, pNode, &p->filter);
+        if (isShareable && p->pShare && styleShareEligible(pElem)) {
+            StyleShare *pShare = p->pShare;
+            pShare->apElem[pShare->iNext] = pElem;
+            pShare->iNext = (pShare->iNext + 1) % STYLE_SHARE_SIZE;
+        }
+    }
     HtmlComputedValuesRelease(pTree, pElem->pPreviousValues);
     pElem->pPreviousValues = pV;
 
-    addStackingInfo(pTree, pElem);
+    addStackingInfo(pTree, pElem, pStack, pV);
 
-    /* Compare the new computed property set with the old. If
-     * ComputedValuesCompare() returns 0, then the properties have
-     * not changed (in any way that affects rendering). If it
-     * returns 1, then some aspect has changed that does not
-     * require a relayout (i.e. 'color', or 'text-decoration'). 
-     * If it returns 2, then something has changed that does require
-     * relayout (i.e. 'display', 'font-size').
+    /* Compare the new computed property set with the old. The return
+     * value is one of the HTML_STYLE_XXX constants, indicating whether 
+     * the change requires no work (i.e. nothing that affects rendering 
+     * has changed), a repaint only (i.e. 'color', or 'text-decoration')
+     * or some level of relayout (i.e. 'display', 'font-size').
      */
     return HtmlComputedValuesCompare(pElem->pPropertyValues, pV);
 }
 
-typedef struct StyleCounter StyleCounter;
-struct StyleCounter {
-  char *zName;
-  int iValue;
-};
-
-struct StyleApply {
-  /* Node to begin recalculating style at */
-  HtmlNode *pRestyle;
-
-  /* True if currently traversing pRestyle, or a descendent, right-sibling
-   * or descendent of a right-sibling of pRestyle.
-   */
-  int doStyle;
-
-  int doContent;
-
-  /* True if the whole tree is being restyled. */
-  int isRoot;
-
-  StyleCounter **apCounter;
-  int nCounter;
-  int nCounterAlloc;
-  int nCounterStartScope;
-
-  /* True if we have seen one or more "fixed" items */
-  int isFixed;
-};
-typedef struct StyleApply StyleApply;
-
 static void 
 styleApply (HtmlTree *pTree, HtmlNode *pNode, StyleApply *p)
 {
     int i;
     int doStyle;
+    int doStyleIn;
     int nCounterStartScope;
     int redrawmode = 0;
+    StyleShare sShare;
+    StyleShare *pShare;
     HtmlElementNode *pElem = HtmlNodeAsElement(pNode);
 
     /* Text nodes do not have an associated style. */
     if (!pElem) return;
 
-    if (p->pRestyle == pNode) {
+    /* A node that has never been styled is styled regardless of the
+     * restyle set. The parser only schedules a restyle of the node that
+     * is current when a chunk of input is parsed, so nodes added as its
+     * right-siblings (after it is implicitly closed) are found here.
+     */
+    doStyleIn = p->doStyle;
+    if (!p->doStyle && (
+        !pElem->pPropertyValues || 
+        Tcl_FindHashEntry(p->pRestyle, (char *)pNode)
+    )) {
         p->doStyle = 1;
     }
 
     if (p->doStyle) {
-        redrawmode = styleNode(pTree, pNode, (ClientData) ((size_t) p->isRoot));
+        redrawmode = styleNode(pTree, pNode, p);
 
         /* If there has been a style-callback configured (-stylecmd option to
          * the [nodeHandle replace] command) for this node, invoke it now.
@@ -592,7 +776,7 @@ styleApply (HtmlTree *pTree, HtmlNode *pNode, StyleApply *p)
         /* Destroy current generated content */
         if (pElem->pBefore || pElem->pAfter) {
             HtmlNodeClearGenerated(pTree, pElem);
-            redrawmode = MAX(redrawmode, 2);
+            redrawmode = MAX(redrawmode, HTML_STYLE_LAYOUT);
         }
 
         /* Generate :before content */
@@ -607,9 +791,15 @@ styleApply (HtmlTree *pTree, HtmlNode *pNode, StyleApply *p)
     }
 
     doStyle = p->doStyle;
+    memset(&sShare, 0, sizeof(StyleShare));
+    pShare = p->pShare;
+    p->pShare = &sShare;
+    HtmlCssFilterPush(&p->filter, pNode);
     for (i = 0; i < HtmlNodeNumChildren(pNode); i++) {
         styleApply(pTree, HtmlNodeChild(pNode, i), p);
     }
+    HtmlCssFilterPop(&p->filter);
+    p->pShare = pShare;
     p->doStyle = doStyle;
 
     if (p->doStyle || p->doContent) {
@@ -622,7 +812,7 @@ styleApply (HtmlTree *pTree, HtmlNode *pNode, StyleApply *p)
         }
 
         if (pElem->pBefore || pElem->pAfter) {
-            redrawmode = MAX(redrawmode, 2);
+            redrawmode = MAX(redrawmode, HTML_STYLE_LAYOUT);
         }
     } else if(pElem->pAfter) {
         HtmlStyleHandleCounters(pTree, HtmlNodeComputedValues(pElem->pAfter));
@@ -634,16 +824,42 @@ styleApply (HtmlTree *pTree, HtmlNode *pNode, StyleApply *p)
     p->nCounter = p->nCounterStartScope;
     p->nCounterStartScope = nCounterStartScope;
 
-    if (redrawmode == 3) {
-        HtmlCallbackLayout(pTree, pNode);
-        HtmlCallbackDamageNode(pTree, pNode);
-        p->doContent = 1;
-    } else if (redrawmode == 2) {
-        HtmlCallbackLayout(pTree, pNode);
-        HtmlCallbackDamageNode(pTree, pNode);
-    } else if (redrawmode == 1) {
-        /* HtmlCallbackLayout(pTree, pNode); */
-        HtmlCallbackDamageNode(pTree, pNode);
+    /* Unless there are sibling rules, restyling this node cannot change
+     * the style of its right-siblings. Restore the flag to the value it
+     * had when this node was entered.
+     */
+    if (!p->isSiblingRules) {
+        p->doStyle = doStyleIn;
+    }
+
+    /* Schedule whatever work is required by the change in computed 
+     * values. Changes that only affect painting (and the stacking order,
+     * which is recalculated by HtmlRestackNodes() if required) do not 
+     * invoke the layout engine at all. If only the position of the box
+     * within its parent has changed, the layout cache of this node is
+     * left intact so that it may be reused by the next layout.
+     */
+    switch (redrawmode) {
+        case HTML_STYLE_CONTENT:
+            p->doContent = 1;
+            /* Fall through */
+        case HTML_STYLE_LAYOUT:
+            HtmlCallbackLayout(pTree, pNode);
+            HtmlCallbackDamageNode(pTree, pNode);
+            break;
+        case HTML_STYLE_ANCESTORS: {
+            HtmlNode *pParent = HtmlNodeParent(pNode);
+            HtmlCallbackLayout(pTree, pParent ? pParent : pNode);
+            HtmlCallbackDamageNode(pTree, pNode);
+            break;
+        }
+        case HTML_STYLE_RESTACK:
+        case HTML_STYLE_REPAINT:
+            HtmlCallbackDamageNode(pTree, pNode);
+            break;
+    }
+    if (p->doStyle || redrawmode) {
+        p->aClass[redrawmode]++;
     }
 
     /* If this element was either the <body> or <html> nodes,
@@ -791,6 +1007,11 @@ HtmlStyleCounter (HtmlTree *pTree, const char *zName)
  *
  * HtmlStyleApply --
  *
+ *     Recalculate the computed style of each node in the set pRestyle
+ *     (a hash table keyed by HtmlNode pointer) and their descendants.
+ *     If the stylesheets contain sibling rules, the right-siblings of 
+ *     each member and their descendants are recalculated too.
+ *
  * Results:
  *     None.
  *
@@ -800,15 +1021,21 @@ HtmlStyleCounter (HtmlTree *pTree, const char *zName)
  *---------------------------------------------------------------------------
  */
 int 
-HtmlStyleApply (HtmlTree *pTree, HtmlNode *pNode)
+HtmlStyleApply (HtmlTree *pTree, Tcl_HashTable *pRestyle)
 {
     StyleApply sApply;
-    int isRoot = ((pNode == pTree->pRoot) ? 1 : 0);
-    HtmlLog(pTree, "STYLEENGINE", "START");
+    int isRoot = 0;
+    if (Tcl_FindHashEntry(pRestyle, (char *)pTree->pRoot)) {
+        isRoot = 1;
+    }
+    HtmlLog(pTree, "STYLEENGINE", "START: %d restyle roots", 
+        pRestyle->numEntries
+    );
 
     memset(&sApply, 0, sizeof(StyleApply));
-    sApply.pRestyle = pNode;
+    sApply.pRestyle = pRestyle;
     sApply.isRoot = isRoot;
+    sApply.isSiblingRules = HtmlCssHasSiblingRules(pTree);
 
     assert(pTree->pStyleApply == 0);
     pTree->pStyleApply = (void *)&sApply;
@@ -816,6 +1043,23 @@ HtmlStyleApply (HtmlTree *pTree, HtmlNode *pNode)
     pTree->pStyleApply = 0;
     pTree->isFixed = sApply.isFixed;
     HtmlFree(sApply.apCounter);
+
+    assert(sApply.filter.nStack == 0);
+    HtmlLog(pTree, "STYLEENGINE", 
+        "FINISH: ancestor filter rejected %d/%d rules tested, "
+        "%d/%d nodes shared computed values with a sibling",
+        sApply.filter.nReject, sApply.filter.nTest,
+        sApply.nShareHit, sApply.nShareTest
+    );
+    HtmlLog(pTree, "CALLBACK", 
+        "Restyle: repaint=%d restack=%d relayout-ancestors=%d "
+        "relayout-self=%d (unchanged=%d)",
+        sApply.aClass[HTML_STYLE_REPAINT], sApply.aClass[HTML_STYLE_RESTACK],
+        sApply.aClass[HTML_STYLE_ANCESTORS],
+        sApply.aClass[HTML_STYLE_LAYOUT] + sApply.aClass[HTML_STYLE_CONTENT],
+        sApply.aClass[HTML_STYLE_SAME]
+    );
+    HtmlCssFilterClear(&sApply.filter);
     return TCL_OK;
 }
 
@@ -50,44 +50,20 @@ static const char rcsid[] = "$Id: htmltagdb.c,v 1.11 2007/11/11 11:00:48 danielk
  *     HtmlMarkupName()
  *     HtmlMarkupFlags()
  *     HtmlMarkup()
+ *     HtmlHashLookup()
+ *     HtmlHashString()
+ *     HtmlAttrAtom()
+ *     HtmlMarkupArgAtom()
  */
 
 extern HtmlTokenMap HtmlMarkupMap[];
 
-
-/* The hash table for HTML markup names.
-**
-** If an HTML markup name hashes to H, then apMap[H] will point to
-** a linked list of sgMap structure, one of which will describe the
-** the particular markup (if it exists.)
-*/
-static HtmlTokenMap *apMap[HTML_MARKUP_HASH_SIZE];
-
-/* Hash a markup name
-**
-** HTML markup is case insensitive, so this function will give the
-** same hash regardless of the case of the markup name.
-**
-** The value returned is an integer between 0 and HTML_MARKUP_HASH_SIZE-1,
-** inclusive.
+/* The minimal perfect hash for HTML markup names. These arrays are
+** generated along with HtmlMarkupMap[] from tokenlist.txt (see the
+** comments in mkhash.tcl and function HtmlHashLookup() below).
 */
-static int 
-HtmlHash (void *htmlPtr, const char *zName)
-{
-    int h = 0;
-    char c;
-    while ((c = *zName) != 0) {
-        if (isupper(c)) {
-            c = tolower(c);
-        }
-        h = h << 5 ^ h ^ c;
-        zName++;
-    }
-    if (h < 0) {
-        h = -h;
-    }
-    return h % HTML_MARKUP_HASH_SIZE;
-}
+extern const unsigned short HtmlMarkupHashSeed[];
+extern const unsigned char HtmlMarkupHashSlot[];
 
 /*
 ** Convert a string to all lower-case letters.
@@ -132,8 +108,7 @@ HtmlMarkup (int markup)
             "text",
             Html_Text,
             HTMLTAG_INLINE,
-            textContent,
-            0
+            textContent
         };
         return &textmapentry;
     } else if (markup > 0) {
@@ -204,20 +179,58 @@ HtmlMarkupName(int markup)
 }
 
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlHashString --
+ *
+ *     Compute the 32-bit FNV-1a hash of the first n bytes of string z
+ *     (or of the whole of z, if n is less than zero), starting from the
+ *     offset basis XORed with seed. If isFold is true, ASCII upper-case 
+ *     characters are hashed as if they were lower-case.
+ *
+ *     This is the hash function used by the minimal perfect hashes
+ *     generated at build time. It must produce the same values as 
+ *     [HashString] in mkhash.tcl.
+ *
+ * Results:
+ *     Hash value.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+unsigned int 
+HtmlHashString (const char *z, int n, int isFold, unsigned int seed)
+{
+    const unsigned char *zU = (const unsigned char *)z;
+    unsigned int h = (seed ^ 2166136261U);
+    int i;
+    for (i = 0; (n < 0) ? zU[i] : (i < n); i++) {
+        unsigned int c = zU[i];
+        if (isFold && c >= 'A' && c <= 'Z') c += ('a' - 'A');
+        h = (h ^ c) * 16777619U;
+    }
+    return (h & 0xFFFFFFFF);
+}
+
 /*
  *---------------------------------------------------------------------------
  *
  * HtmlHashLookup --
  *
- *     Look up an HTML tag name in the hash-table.
+ *     Look up an HTML tag name (case-insensitive). The minimal perfect
+ *     hash generated from tokenlist.txt maps each known tag name to a 
+ *     unique slot, so at most one entry of HtmlMarkupMap[] needs to
+ *     be compared with zType.
  *
  * Results: 
  *     Return the corresponding HtmlTokenMap if the tag name is recognized,
  *     or NULL otherwise.
  *
  * Side effects:
- *     May initialise the hash table from the autogenerated array
- *     in htmltokens.c (generated from tokenlist.txt).
+ *     None.
  *
  *---------------------------------------------------------------------------
  */
@@ -227,48 +240,104 @@ HtmlHashLookup (
     const char *zType          /* Null terminated tag name. eg. "br" */
 )
 {
-    HtmlTokenMap *pMap;         /* For searching the markup name hash table */
-    int h;                      /* The hash on zType */
-    char buf[256];
-    HtmlHashInit(htmlPtr, 0);
-
-    h = HtmlHash(htmlPtr, zType);
-    for (pMap = apMap[h]; pMap; pMap = pMap->pCollide) {
-        if (stricmp(pMap->zName, zType) == 0) {
-            return pMap;
-        }
-    }
-    strncpy(buf, zType, 255);
-    buf[255] = 0;
+    HtmlTokenMap *pMap;
+    unsigned int iBucket;
+    unsigned int iSlot;
 
+    iBucket = HtmlHashString(zType, -1, 1, 0) % HTML_MARKUP_HASH_BUCKETS;
+    iSlot = HtmlHashString(zType, -1, 1, HtmlMarkupHashSeed[iBucket]);
+    pMap = &HtmlMarkupMap[HtmlMarkupHashSlot[iSlot % HTML_MARKUP_COUNT]];
+
+    if (stricmp(pMap->zName, zType) == 0) {
+        return pMap;
+    }
     return NULL;
 }
 
-/* Initialize the escape sequence hash table
-*/
-void 
-HtmlHashInit (void *htmlPtr, int start)
-{
-    static int isInit = 0;
 
-    int i;         /* For looping thru the list of markup names */
-    int h;         /* The hash on a markup name */
+/*
+ * Attribute names are interned in the following table, so that each
+ * HtmlAttributes.a[].zName value is an atom and names may be compared by
+ * pointer (see HtmlMarkupArgAtom()). Unlike the tables used by HtmlAtom(), 
+ * this one is global (not per-widget), as HtmlAttributes structures are 
+ * created and queried without reference to a widget. Keys are 
+ * case-sensitive, as attribute name comparisons always have been (the 
+ * tokenizer folds names to lower case).
+ */
+static Tcl_HashTable aAttrAtom;
+static int isAttrAtomInit = 0;
+TCL_DECLARE_MUTEX(attrAtomMutex)
 
-    if (isInit) return;
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlAttrAtom --
+ *
+ *     Return the atom for attribute name zName. If the atom does not exist
+ *     and isCreate is true, create it. 
+ *
+ * Results:
+ *     Atom string, or NULL if there is no such atom and isCreate is false.
+ *     In the latter case no node attribute has the name zName.
+ *
+ * Side effects:
+ *     May add an entry to the attribute name table.
+ *
+ *---------------------------------------------------------------------------
+ */
+const char *
+HtmlAttrAtom (const char *zName, int isCreate)
+{
+    Tcl_HashEntry *pEntry;
+    const char *zAtom = 0;
 
-    for (i = start; i < HTML_MARKUP_COUNT; i++) {
-        h = HtmlHash(htmlPtr, HtmlMarkupMap[i].zName);
-        HtmlMarkupMap[i].pCollide = apMap[h];
-        apMap[h] = &HtmlMarkupMap[i];
+    Tcl_MutexLock(&attrAtomMutex);
+    if (!isAttrAtomInit) {
+        Tcl_InitHashTable(&aAttrAtom, TCL_STRING_KEYS);
+        isAttrAtomInit = 1;
+    }
+    if (isCreate) {
+        int dummy;
+        pEntry = Tcl_CreateHashEntry(&aAttrAtom, zName, &dummy);
+    } else {
+        pEntry = Tcl_FindHashEntry(&aAttrAtom, zName);
+    }
+    if (pEntry) {
+        zAtom = (const char *)Tcl_GetHashKey(&aAttrAtom, pEntry);
     }
-#ifdef TEST
-    HtmlHashStats(htmlPtr);
-#endif
+    Tcl_MutexUnlock(&attrAtomMutex);
 
-    isInit = 1;
+    return zAtom;
 }
 
+/*
+ * Elements with more than ATTR_INDEX_MIN attributes get a hash index of 
+ * the HtmlAttributes.a[] array keyed by name atom. See HtmlAttributesNew()
+ * and HtmlMarkupArgAtom().
+ */
+#define ATTR_INDEX_MIN 8
+#define ATTR_INDEX_HASH(zAtom, nIndex) \
+    ((int)(((size_t)(zAtom)) >> 3) & ((nIndex) - 1))
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlAttributesNew --
+ *
+ *     Allocate a new HtmlAttributes structure containing the argc/2 
+ *     name/value pairs in argv (the length of each string is in arglen).
+ *     If doEscape is true, translate escape sequences in names and values
+ *     and fold names to lower case. Each name is replaced with its atom
+ *     (see HtmlAttrAtom()).
+ *
+ * Results:
+ *     New structure (free with HtmlFree()), or NULL if argc < 2.
+ *
+ * Side effects:
+ *     May add entries to the attribute name table.
+ *
+ *---------------------------------------------------------------------------
+ */
 HtmlAttributes *
 HtmlAttributesNew (int argc, char const **argv, int *arglen, int doEscape)
 {
@@ -280,33 +349,56 @@ HtmlAttributesNew (int argc, char const **argv, int *arglen, int doEscape)
         char *zBuf;
 
         int nAttr = argc / 2;
+        int nIndex = 0;
+
+        if (nAttr > ATTR_INDEX_MIN) {
+            for (nIndex = 1; nIndex < nAttr * 2; nIndex = nIndex * 2);
+        }
 
         nByte = sizeof(HtmlAttributes);
         for (j = 0; j < argc; j++) {
             nByte += arglen[j] + 1;
         }
         nByte += sizeof(struct HtmlAttribute) * (argc - 1);
+        nByte += sizeof(int) * nIndex;
 
         pMarkup = (HtmlAttributes *)HtmlAlloc("HtmlAttributes", nByte);
         pMarkup->nAttr = nAttr;
+        pMarkup->nIndex = nIndex;
+        pMarkup->aIndex = 0;
         zBuf = (char *)(&pMarkup->a[nAttr]);
+        if (nIndex) {
+            pMarkup->aIndex = (int *)zBuf;
+            memset(pMarkup->aIndex, 0, sizeof(int) * nIndex);
+            zBuf += sizeof(int) * nIndex;
+        }
 
         for (j=0; j < nAttr; j++) {
             int idx = (j * 2);
 
-            pMarkup->a[j].zName = zBuf;
+            /* Copy the name into zBuf to translate and intern it. The
+             * space is then reused for the value.
+             */
             memcpy(zBuf, argv[idx], arglen[idx]);
             zBuf[arglen[idx]] = '\0';
             if (doEscape) {
                 HtmlTranslateEscapes(zBuf);
                 ToLower(zBuf);
             }
-            zBuf += (arglen[idx] + 1);
+            pMarkup->a[j].zName = (char *)HtmlAttrAtom(zBuf, 1);
+
+            if (nIndex) {
+                int iSlot = ATTR_INDEX_HASH(pMarkup->a[j].zName, nIndex);
+                while (pMarkup->aIndex[iSlot]) {
+                    iSlot = (iSlot + 1) & (nIndex - 1);
+                }
+                pMarkup->aIndex[iSlot] = j + 1;
+            }
 
             pMarkup->a[j].zValue = zBuf;
             memcpy(zBuf, argv[idx+1], arglen[idx+1]);
             zBuf[arglen[idx+1]] = '\0';
-            if (doEscape) HtmlTranslateEscapes(zBuf);
+            if (doEscape) HtmlTranslateAttrEscapes(zBuf);
             zBuf += (arglen[idx+1] + 1);
         }
     }
@@ -314,6 +406,48 @@ HtmlAttributesNew (int argc, char const **argv, int *arglen, int doEscape)
     return pMarkup;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlMarkupArgAtom --
+ *
+ *     Return the value of the attribute named by atom zAtom (see 
+ *     HtmlAttrAtom()), or zDefault if there is no such attribute. Names
+ *     are compared by pointer, using the hash index for elements with 
+ *     many attributes.
+ *
+ * Results:
+ *     See above.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+char *
+HtmlMarkupArgAtom (HtmlAttributes *pAttr, const char *zAtom, char *zDefault)
+{
+    int i;
+    if (pAttr) {
+        if (pAttr->aIndex) {
+            int iSlot = ATTR_INDEX_HASH(zAtom, pAttr->nIndex);
+            while ((i = pAttr->aIndex[iSlot])) {
+                if (pAttr->a[i - 1].zName == zAtom) {
+                    return pAttr->a[i - 1].zValue;
+                }
+                iSlot = (iSlot + 1) & (pAttr->nIndex - 1);
+            }
+        } else {
+            for (i = 0; i < pAttr->nAttr; i++) {
+                if (pAttr->a[i].zName == zAtom) {
+                    return pAttr->a[i].zValue;
+                }
+            }
+        }
+    }
+    return zDefault;
+}
+
 /*
 ** Convert a markup name into a type integer
 */
@@ -49,6 +49,9 @@ static char const rcsid[] = "@(#) $Id: htmltcl.c,v 1.207 2008/01/16 06:29:27 dan
 
 #define LOG if (pTree->options.logcmd)
 
+/* Key for the HtmlSharedData interpreter associated-data. */
+#define HTML_SHARED_KEY "tkhtml3_shared"
+
 #define SafeCheck(interp,str) if (Tcl_IsSafe(interp)) { \
     Tcl_AppendResult(interp, str, " invalid in safe interp", 0); \
     return TCL_ERROR; \
@@ -122,6 +125,64 @@ hashstatsCmd(
 }
 #endif
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * arenastatsCmd --
+ *
+ *         $html _arenastats
+ *
+ *     Return a key-value list (suitable for passing to [array set])
+ *     describing the node arena of the current document. i.e:
+ *
+ *         [list "blocks" 3 "live" 2310 "allocations" 2402 ....]
+ *
+ *     Unlike [::tkhtml::htmlalloc], this command is available in all
+ *     builds.
+ *
+ * Results:
+ *     Always TCL_OK.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int 
+arenastatsCmd(
+    ClientData clientData,             /* The HTML widget data structure */
+    Tcl_Interp *interp,                /* Current interpreter. */
+    int objc,                          /* Number of arguments. */
+    Tcl_Obj *CONST objv[]              /* Argument strings. */ 
+    )
+{
+    HtmlTree *pTree = (HtmlTree *)clientData;
+    HtmlNodeArena *pArena = &pTree->arena;
+    Tcl_Obj *pRet;
+    int i;
+
+    static const char *azName[] = {
+        "blocks", "bytes", "live", "allocations", "reused", "large arrays", 0
+    };
+    int aValue[6];
+
+    aValue[0] = pArena->nBlock;
+    aValue[1] = pArena->nBlock * HTML_ARENA_BLOCKSIZE;
+    aValue[2] = pArena->nLive;
+    aValue[3] = pArena->nAlloc;
+    aValue[4] = pArena->nReuse;
+    aValue[5] = pArena->nLarge;
+
+    pRet = Tcl_NewObj();
+    for (i = 0; azName[i]; i++) {
+        Tcl_Obj *pName = Tcl_NewStringObj(azName[i], -1);
+        Tcl_ListObjAppendElement(interp, pRet, pName);
+        Tcl_ListObjAppendElement(interp, pRet, Tcl_NewIntObj(aValue[i]));
+    }
+    Tcl_SetObjResult(interp, pRet);
+    return TCL_OK;
+}
+
 struct SubCmd {
     const char *zName;
     Tcl_ObjCmdProc *xFunc;
@@ -220,7 +281,8 @@ HtmlLog(HtmlTree *pTree, CONST char *zSubject, CONST char *zFormat, ...) {
  *     option.
  *
  *     This function is called once when the widget is created and each time
- *     [.html reset] is called thereafter.
+ *     [.html reset] is called thereafter. The parsed stylesheet is shared
+ *     between widgets (see HtmlCssLoadDefaultStyle()).
  *
  * Results:
  *     None.
@@ -234,11 +296,8 @@ static void
 doLoadDefaultStyle (HtmlTree *pTree)
 {
     Tcl_Obj *pObj = pTree->options.defaultstyle;
-    Tcl_Obj *pId = Tcl_NewStringObj("agent", 5);
     assert(pObj);
-    Tcl_IncrRefCount(pId);
-    HtmlStyleParse(pTree, pObj, pId, 0, 0, 0);
-    Tcl_DecrRefCount(pId);
+    HtmlCssLoadDefaultStyle(pTree, pObj);
 }
 
 /*
@@ -345,9 +404,9 @@ doScrollCallback (HtmlTree *pTree)
  *
  *       1. The node is a text node, or
  *       2. The node has a computed style (HtmlElementNode.pComputed!=0), or
- *       3. The node is HtmlTree.cb.pRestyle, or
- *       4. The node is a descendant of a pRestyle or a descendent of
- *          a right-sibling of pRestyle.
+ *       3. The node is a member of the HtmlTree.cb.aRestyle set, or
+ *       4. The node is a descendant of a member of aRestyle or a
+ *          descendent of a right-sibling of a member of aRestyle.
  *
  * Results:
  *     None.
@@ -364,8 +423,8 @@ checkRestylePointCb(
     ClientData clientData
 )
 {
-    HtmlNode *pParent;
     HtmlNode *p;
+    Tcl_HashTable *pRestyle = &pTree->cb.aRestyle;
 
     /* Condition 1 */
     if (HtmlNodeIsText(pNode)) goto ok_out;
@@ -373,16 +432,14 @@ checkRestylePointCb(
     /* Condition 2 */
     if (HtmlNodeComputedValues(pNode)) goto ok_out;
 
-    /* Condition 3 */
-    if (pNode==pTree->cb.pRestyle) goto ok_out;
-
-    /* Condition 4 */
-    assert(pTree->cb.pRestyle);
-    pParent = HtmlNodeParent(pTree->cb.pRestyle);
-    for (p = pNode; p && HtmlNodeParent(p) != pParent; p = HtmlNodeParent(p));
-    assert(p);
-    for ( ; p && p != pTree->cb.pRestyle; p = HtmlNodeLeftSibling(p));
-    assert(p);
+    /* Conditions 3 and 4 */
+    for (p = pNode; p; p = HtmlNodeParent(p)) {
+        HtmlNode *pSibling;
+        for (pSibling = p; pSibling; pSibling = HtmlNodeLeftSibling(pSibling)){
+            if (Tcl_FindHashEntry(pRestyle, (char *)pSibling)) goto ok_out;
+        }
+    }
+    assert(!"Node has no computed style and is not scheduled for restyle");
 
 ok_out:
     return HTML_WALK_DESCEND;
@@ -416,20 +473,49 @@ static void runLayoutEngine(ClientData clientData);
 INSTRUMENTED(runDynamicStyleEngine, HTML_INSTRUMENT_DYNAMIC_STYLE_ENGINE)
 {
     HtmlTree *pTree = (HtmlTree *)clientData;
-    assert(pTree->cb.pDynamic);
     HtmlCssCheckDynamic(pTree);
 }
 
 INSTRUMENTED(runStyleEngine, HTML_INSTRUMENT_STYLE_ENGINE)
 {
     HtmlTree *pTree = (HtmlTree *)clientData;
-    HtmlNode *pRestyle = pTree->cb.pRestyle;
+    Tcl_HashTable aRestyle;
+    Tcl_HashEntry *pEntry;
+    Tcl_HashSearch search;
+    int isNew;
 
-    pTree->cb.pRestyle = 0;
+    /* Move the set of restyle roots to a local table before running the
+     * style engine. Any calls to HtmlCallbackRestyle() made while styling
+     * (i.e. from a -stylecmd script) are then handled by the next
+     * callback, as they were when a single restyle point was stored.
+     *
+     * Members with an ancestor that is also a member are not copied. 
+     * addRestyleRoot() does not add such nodes, but a node may have been
+     * added before one of its ancestors was.
+     */
     assert(pTree->cb.pSnapshot);
-    assert(pRestyle);
+    assert(pTree->cb.aRestyle.numEntries > 0);
+    Tcl_InitHashTable(&aRestyle, TCL_ONE_WORD_KEYS);
+    for (
+        pEntry = Tcl_FirstHashEntry(&pTree->cb.aRestyle, &search);
+        pEntry;
+        pEntry = Tcl_NextHashEntry(&search)
+    ) {
+        HtmlNode *pNode;
+        HtmlNode *p;
+        pNode = (HtmlNode *)Tcl_GetHashKey(&pTree->cb.aRestyle, pEntry);
+        for (p = HtmlNodeParent(pNode); p; p = HtmlNodeParent(p)) {
+            if (Tcl_FindHashEntry(&pTree->cb.aRestyle, (char *)p)) break;
+        }
+        if (!p) {
+            Tcl_CreateHashEntry(&aRestyle, (char *)pNode, &isNew);
+        }
+    }
+    Tcl_DeleteHashTable(&pTree->cb.aRestyle);
+    Tcl_InitHashTable(&pTree->cb.aRestyle, TCL_ONE_WORD_KEYS);
 
-    HtmlStyleApply(pTree, pRestyle);
+    HtmlStyleApply(pTree, &aRestyle);
+    Tcl_DeleteHashTable(&aRestyle);
     HtmlRestackNodes(pTree);
     HtmlCheckRestylePoint(pTree);
 
@@ -494,19 +580,19 @@ INSTRUMENTED(callbackHandler, HTML_INSTRUMENT_CALLBACK)
     assert(
         !pTree->pRoot ||
         HtmlNodeComputedValues(pTree->pRoot) ||
-        pTree->cb.pRestyle==pTree->pRoot
+        Tcl_FindHashEntry(&pTree->cb.aRestyle, (char *)pTree->pRoot)
     );
     HtmlCheckRestylePoint(pTree);
 
     HtmlLog(pTree, "CALLBACK", 
-        "flags=( %s%s%s%s%s) pDynamic=%s pRestyle=%s scroll=(+%d+%d) ",
+        "flags=( %s%s%s%s%s) nDynamic=%d nRestyle=%d scroll=(+%d+%d) ",
         (p->flags & HTML_DYNAMIC ? "Dynamic " : ""),
         (p->flags & HTML_RESTYLE ? "Style " : ""),
         (p->flags & HTML_LAYOUT ? "Layout " : ""),
         (p->flags & HTML_DAMAGE ? "Damage " : ""),
         (p->flags & HTML_SCROLL ? "Scroll " : ""),
-        (p->pDynamic?Tcl_GetString(HtmlNodeCommand(pTree,p->pDynamic)):"N/A"),
-        (p->pRestyle?Tcl_GetString(HtmlNodeCommand(pTree,p->pRestyle)):"N/A"),
+        p->aDynamic.numEntries,
+        p->aRestyle.numEntries,
          p->iScrollX, p->iScrollY
     );
 
@@ -514,8 +600,8 @@ INSTRUMENTED(callbackHandler, HTML_INSTRUMENT_CALLBACK)
     pTree->cb.inProgress = 1;
 
     /* If the HTML_DYNAMIC flag is set, then call HtmlCssCheckDynamic()
-     * to recalculate all the dynamic CSS rules that may apply to 
-     * the sub-tree rooted at HtmlCallback.pDynamic. CssCheckDynamic() 
+     * to recalculate the dynamic CSS rules that may be affected by the
+     * flag changes in HtmlCallback.aDynamic. CssCheckDynamic() 
      * calls HtmlCallbackRestyle() if any computed style values are 
      * modified (setting the HTML_RESTYLE flag). 
      */
@@ -525,9 +611,9 @@ INSTRUMENTED(callbackHandler, HTML_INSTRUMENT_CALLBACK)
     HtmlCheckRestylePoint(pTree);
     pTree->cb.flags &= ~HTML_DYNAMIC;
 
-    /* If the HtmlCallback.pRestyle variable is set, then recalculate 
-     * style information for the sub-tree rooted at HtmlCallback.pRestyle,
-     * and the sub-trees rooted at all right-siblings of pRestyle. 
+    /* If the HTML_RESTYLE flag is set, then recalculate style information
+     * for the sub-trees rooted at each node in HtmlCallback.aRestyle, and
+     * the sub-trees rooted at all right-siblings of those nodes. 
      * Note that restyling a node may invoke the -imagecmd callback.
      *
      * Todo: This seems dangerous.  What happens if the -imagecmd calls
@@ -678,52 +764,50 @@ HtmlCallbackForce (HtmlTree *pTree)
 /*
  *---------------------------------------------------------------------------
  *
- * upgradeRestylePoint --
+ * addRestyleRoot --
+ *
+ *     Add node pNode to the set of nodes to restyle during the next 
+ *     callback (HtmlCallback.aRestyle). Nothing is added if pNode or one 
+ *     of its ancestors is already a member of the set, as the style 
+ *     engine restyles the entire sub-tree below each member anyway. 
+ *     Members that are descendants of a member added later are dropped
+ *     by runStyleEngine() before the style engine is run.
+ *
+ *     Unlike a single restyle point, which had to be hoisted to the 
+ *     common ancestor of all modified nodes, a set of roots means that
+ *     two unrelated changes in a large document do not cause everything
+ *     between them to be restyled. If the stylesheets contain sibling
+ *     rules, the style engine also restyles the right-siblings of each
+ *     member (see HtmlStyleApply()).
  *
  * Results:
  *     True if argument pNode is located in the document tree, or false
  *     if it is located in some orphan tree.
  *
  * Side effects:
- *     None.
+ *     May add an entry to HtmlCallback.aRestyle.
  *
  *---------------------------------------------------------------------------
  */
 static int 
-upgradeRestylePoint (HtmlNode **ppRestyle, HtmlNode *pNode)
+addRestyleRoot (HtmlTree *pTree, HtmlNode *pNode)
 {
-    HtmlNode *pA;
-    HtmlNode *pB;
-    assert(pNode && ppRestyle);
+    Tcl_HashTable *pRestyle = &pTree->cb.aRestyle;
+    HtmlNode *p;
+    int isNew;
+    assert(pNode);
 
     /* Do nothing if pNode is part of an orphan tree */
-    for (pA = pNode; pA; pA = HtmlNodeParent(pA)) {
-        if (pA->iNode == HTML_NODE_ORPHAN) return 0;
-    }
-
-    for (pA = *ppRestyle; pA; pA = HtmlNodeParent(pA)) {
-        HtmlNode *pParentA = HtmlNodeParent(pA);
-        for (pB = pNode; pB; pB = HtmlNodeParent(pB)) {
-            if (pB == pA) {
-                *ppRestyle = pB;
-                return 1;
-            }  
-            if (HtmlNodeParent(pB) == pParentA) {
-                int i;
-                for (i = 0; i < HtmlNodeNumChildren(pParentA); i++) {
-                    HtmlNode *pChild = HtmlNodeChild(pParentA, i);
-                    if (pChild == pB || pChild == pA) {
-                        *ppRestyle = pChild;
-                        return 1;
-                    }
-                }
-                assert(!"Cannot happen");
-            }
-        }
+    for (p = pNode; p; p = HtmlNodeParent(p)) {
+        if (p->iNode == HTML_NODE_ORPHAN) return 0;
     }
 
-    assert(!*ppRestyle);
-    *ppRestyle = pNode;
+    if (pRestyle->numEntries > 0) {
+        for (p = pNode; p; p = HtmlNodeParent(p)) {
+            if (Tcl_FindHashEntry(pRestyle, (char *)p)) return 1;
+        }
+    }
+    Tcl_CreateHashEntry(pRestyle, (char *)pNode, &isNew);
     return 1;
 }
 
@@ -771,7 +855,7 @@ HtmlCallbackRestyle (HtmlTree *pTree, HtmlNode *pNode)
 {
     if (pNode) {
         snapshotLayout(pTree);
-        if (upgradeRestylePoint(&pTree->cb.pRestyle, pNode)) {
+        if (addRestyleRoot(pTree, pNode)) {
             if (!pTree->cb.flags) {
                 Tcl_DoWhenIdle(callbackHandler, (ClientData)pTree);
             }
@@ -783,10 +867,10 @@ HtmlCallbackRestyle (HtmlTree *pTree, HtmlNode *pNode)
     /* This is also where the text-representation of the document is
      * invalidated. If the style of a node is to change, or a new node
      * that has no style is added, then the current text-representation
-     * is clearly suspect.
+     * is clearly suspect. Cached [search] results are not discarded
+     * here - see the HtmlCssSearchXXX() notifications in htmltree.c.
      */
     HtmlTextInvalidate(pTree);
-    HtmlCssSearchInvalidateCache(pTree);
 }
 
 /*
@@ -795,9 +879,9 @@ HtmlCallbackRestyle (HtmlTree *pTree, HtmlNode *pNode)
  * HtmlCallbackDynamic --
  *
  *     Next widget idle-callback, check if any dynamic CSS conditions
- *     attached to nodes that are part of the sub-tree rooted at pNode
- *     have changed. If so, restyle the affected nodes.  This function
- *     is a no-op if (pNode==0).
+ *     that depend on the dynamic flags in mask of node pNode have 
+ *     changed. If so, restyle the affected nodes. This function is a
+ *     no-op if (pNode==0) or if pNode is part of an orphan tree.
  *
  * Results:
  *     None.
@@ -809,15 +893,16 @@ HtmlCallbackRestyle (HtmlTree *pTree, HtmlNode *pNode)
  *---------------------------------------------------------------------------
  */
 void 
-HtmlCallbackDynamic (HtmlTree *pTree, HtmlNode *pNode)
+HtmlCallbackDynamic (HtmlTree *pTree, HtmlNode *pNode, int mask)
 {
-    if (pNode) {
-        if (upgradeRestylePoint(&pTree->cb.pDynamic, pNode)) {
-            if (!pTree->cb.flags) {
-                Tcl_DoWhenIdle(callbackHandler, (ClientData)pTree);
-            }
-            pTree->cb.flags |= HTML_DYNAMIC;
+    HtmlNode *p;
+    for (p = pNode; p && p->iNode != HTML_NODE_ORPHAN; p = HtmlNodeParent(p));
+    if (pNode && !p) {
+        HtmlCssDynamicChanged(pTree, HtmlNodeAsElement(pNode), mask);
+        if (!pTree->cb.flags) {
+            Tcl_DoWhenIdle(callbackHandler, (ClientData)pTree);
         }
+        pTree->cb.flags |= HTML_DYNAMIC;
     }
 }
 
@@ -1018,6 +1103,97 @@ cleanupHandlerTable(Tcl_HashTable *pHash)
     Tcl_DeleteHashTable(pHash);
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * sharedDataRelease --
+ *
+ *     Decrement the reference count of the HtmlSharedData structure
+ *     passed as the only argument. If it reaches zero, free the shared
+ *     default stylesheet and atoms table and the structure itself.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May free memory.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+sharedDataRelease (HtmlSharedData *pShared)
+{
+    pShared->nRef--;
+    assert(pShared->nRef >= 0);
+    if (pShared->nRef == 0) {
+        /* The stylesheet holds pointers into the atoms table, so free
+         * it first. 
+         */
+        HtmlCssStyleSheetFree(pShared->pAgentStyle);
+        if (pShared->pAgentText) {
+            Tcl_DecrRefCount(pShared->pAgentText);
+        }
+        Tcl_DeleteHashTable(&pShared->aAtom);
+        HtmlFree(pShared);
+    }
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * sharedDataDelete --
+ *
+ *     Interpreter associated-data delete proc for HtmlSharedData. Invoked
+ *     when the interpreter is deleted.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Drops the interpreter reference to the HtmlSharedData structure.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void
+sharedDataDelete (ClientData clientData, Tcl_Interp *interp)
+{
+    sharedDataRelease((HtmlSharedData *)clientData);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * sharedDataGet --
+ *
+ *     Return the HtmlSharedData structure associated with interpreter
+ *     interp, creating it if this is the first widget created in interp.
+ *
+ * Results:
+ *     Pointer to HtmlSharedData. The caller owns one reference and 
+ *     should release it with sharedDataRelease().
+ *
+ * Side effects:
+ *     May allocate and register interpreter associated-data.
+ *
+ *---------------------------------------------------------------------------
+ */
+static HtmlSharedData *
+sharedDataGet (Tcl_Interp *interp)
+{
+    HtmlSharedData *pShared;
+
+    pShared = (HtmlSharedData *)Tcl_GetAssocData(interp, HTML_SHARED_KEY, 0);
+    if (!pShared) {
+        Tcl_HashKeyType *pType = HtmlCaseInsenstiveHashType();
+        pShared = HtmlNew(HtmlSharedData);
+        Tcl_InitCustomHashTable(&pShared->aAtom, TCL_CUSTOM_TYPE_KEYS, pType);
+        pShared->nRef = 1;
+        Tcl_SetAssocData(interp, HTML_SHARED_KEY, sharedDataDelete, pShared);
+    }
+    pShared->nRef++;
+    return pShared;
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -1039,6 +1215,9 @@ deleteWidget(ClientData clientData)
     HtmlDamage *pDamage;
     HtmlTree *pTree = (HtmlTree *)clientData;
     HtmlTreeClear(pTree);
+    Tcl_DeleteHashTable(&pTree->aDynamicDep);
+    Tcl_DeleteHashTable(&pTree->cb.aDynamic);
+    Tcl_DeleteHashTable(&pTree->cb.aRestyle);
 
     /* Delete the contents of the three "handler" hash tables */
     cleanupHandlerTable(&pTree->aNodeHandler);
@@ -1070,9 +1249,14 @@ deleteWidget(ClientData clientData)
         HtmlFree(pDamage);
     }
 
-    /* Atoms table */
+    /* Atoms table. The stylesheets and nodes that use atoms have been 
+     * freed by HtmlTreeClear().
+     */
     Tcl_DeleteHashTable(&pTree->aAtom);
 
+    /* Per-interpreter data (shared atoms and default stylesheet) */
+    sharedDataRelease(pTree->pShared);
+
     /* Delete the structure itself */
     HtmlFree(pTree);
 }
@@ -1306,6 +1490,9 @@ configureCmd(
     #define DOUBLE(v, s1, s2, s3, f) \
         {TK_OPTION_DOUBLE, "-" #v, s1, s2, s3, -1, \
          Tk_Offset(HtmlOptions, v), 0, 0, f}
+    #define INT(v, s1, s2, s3, f) \
+        {TK_OPTION_INT, "-" #v, s1, s2, s3, -1, \
+         Tk_Offset(HtmlOptions, v), 0, 0, f}
     
     /* Option table definition for the html widget. */
     static Tk_OptionSpec htmlOptionSpec[] = {
@@ -1319,6 +1506,7 @@ STRING  (xscrollcommand, "xScrollCommand", "ScrollCommand", ""),
 STRING  (yscrollcommand, "yScrollCommand", "ScrollCommand", ""),
 
 /* Non-debugging, non-standard options in alphabetical order. */
+BOOLEAN (asyncparse, "asyncParse", "AsyncParse", "0", 0),
 OBJ     (defaultstyle, "defaultStyle", "DefaultStyle", HTML_DEFAULT_CSS, 0),
 DOUBLE  (fontscale, "fontScale", "FontScale", "1.0", F_MASK),
 OBJ     (fonttable, "fontTable", "FontTable", "8 9 10 11 13 15 17", FT_MASK),
@@ -1327,8 +1515,10 @@ BOOLEAN (forcewidth, "forceWidth", "ForceWidth", "0", L_MASK),
 BOOLEAN (imagecache, "imageCache", "ImageCache", "1", S_MASK),
 BOOLEAN (imagepixmapify, "imagePixmapify", "ImagePixmapify", "0", 0),
 STRING  (imagecmd, "imageCmd", "ImageCmd", ""),
+STRING  (preloadcmd, "preloadCmd", "PreloadCmd", ""),
 STRING  (drawcleanupcrashcmd, "drawcleanupcrashCmd", "DrawCleanupCrashCmd", ""),
 STRINGT (mode, "mode", "Mode", "standards", azModes),
+INT     (parsebudget, "parseBudget", "ParseBudget", "0", 0),
 STRINGT (parsemode, "parsemode", "Parsemode", "html", azParseModes),
 BOOLEAN (shrink, "shrink", "Shrink", "0", S_MASK),
 DOUBLE  (zoom, "zoom", "Zoom", "1.0", F_MASK),
@@ -1344,6 +1534,7 @@ STRING  (timercmd, "timerCmd", "TimerCmd", ""),
     #undef PIXELS
     #undef STRING
     #undef BOOLEAN
+    #undef INT
 
     HtmlTree *pTree = (HtmlTree *)clientData;
     char *pOptions = (char *)&pTree->options;
@@ -1608,11 +1799,15 @@ relayoutCmd(
  *
  * parseCmd --
  *
- *         $widget parse ?-final? HTML-TEXT
+ *         $widget parse ?-final? ?-discard? HTML-TEXT
+ *         $widget parse ?-final? ?-discard? -file PATH
  * 
  *     Appends the given HTML text to the end of any HTML text that may have
- *     been inserted by prior calls to this command. See Tkhtml man page for
- *     further details.
+ *     been inserted by prior calls to this command. If -discard is 
+ *     specified, the text tokenized so far is then released (see
+ *     HtmlTokenizerDiscard()). If -file is specified, the text is read
+ *     from file PATH (see HtmlTokenizerAppendFile()). See Tkhtml man page
+ *     for further details.
  *
  * Results:
  *     None.
@@ -1632,28 +1827,44 @@ parseCmd(
     HtmlTree *pTree = (HtmlTree *)clientData;
 
     int isFinal;
-    char *zHtml;
-    int nHtml;
+    int isDiscard;
+    char *zHtml = 0;
+    int nHtml = 0;
+    const char *zFile = 0;
+    int nSwitch = objc - 2;
     int eWriteState;
 
-    Tcl_Obj *aObj[2];
-    SwprocConf aConf[3] = {
+    Tcl_Obj *aObj[3];
+    SwprocConf aConf[4] = {
         {SWPROC_SWITCH, "final", "0", "1"},   /* -final */
+        {SWPROC_SWITCH, "discard", "0", "1"}, /* -discard */
         {SWPROC_ARG, 0, 0, 0},                /* HTML-TEXT */
         {SWPROC_END, 0, 0, 0}
     };
 
+    /* If the last two arguments are "-file PATH", the document text is 
+     * read from a file instead of the HTML-TEXT argument.
+     */
+    if (objc >= 4 && 0 == strcmp(Tcl_GetString(objv[objc - 2]), "-file")) {
+        zFile = Tcl_GetString(objv[objc - 1]);
+        aConf[2].eType = SWPROC_END;
+        nSwitch -= 2;
+    }
+
     if (
-        SwprocRt(interp, (objc - 2), &objv[2], aConf, aObj) ||
-        Tcl_GetBooleanFromObj(interp, aObj[0], &isFinal)
+        SwprocRt(interp, nSwitch, &objv[2], aConf, aObj) ||
+        Tcl_GetBooleanFromObj(interp, aObj[0], &isFinal) ||
+        Tcl_GetBooleanFromObj(interp, aObj[1], &isDiscard)
     ) {
         return TCL_ERROR;
     }
 
-    /* zHtml = Tcl_GetByteArrayFromObj(aObj[1], &nHtml); */
-    zHtml = Tcl_GetStringFromObj(aObj[1], &nHtml);
-
-    assert(Tcl_IsShared(aObj[1]));
+    if (!zFile) {
+        /* zHtml = Tcl_GetByteArrayFromObj(aObj[2], &nHtml); */
+        zHtml = Tcl_GetStringFromObj(aObj[2], &nHtml);
+        assert(Tcl_IsShared(aObj[2]));
+        Tcl_DecrRefCount(aObj[2]);
+    }
     Tcl_DecrRefCount(aObj[0]);
     Tcl_DecrRefCount(aObj[1]);
 
@@ -1669,7 +1880,13 @@ parseCmd(
 
     /* Add the new text to the internal cache of the document. */
     eWriteState = pTree->eWriteState;
-    HtmlTokenizerAppend(pTree, zHtml, nHtml, isFinal);
+    if (zFile) {
+        if (HtmlTokenizerAppendFile(pTree, zFile, isFinal)) {
+            return TCL_ERROR;
+        }
+    } else {
+        HtmlTokenizerAppend(pTree, zHtml, nHtml, isFinal);
+    }
     assert(eWriteState == HTML_WRITE_NONE || pTree->eWriteState == eWriteState);
 
     if (
@@ -1684,7 +1901,7 @@ parseCmd(
         while (pTree->eWriteState == HTML_WRITE_INHANDLERRESET && nCount<100) {
             assert(pTree->nParsed == 0);
             pTree->eWriteState = HTML_WRITE_NONE;
-            if (pTree->pDocument) {
+            if (HtmlTokenizerHasDocument(pTree)) {
                 HtmlTokenizerAppend(pTree, "", 0, pTree->isParseFinished);
             }
             nCount++;
@@ -1699,11 +1916,23 @@ parseCmd(
         isFinal = pTree->isParseFinished;
     }
 
+    /* If -discard was specified, release the tokenized document text. */
+    if (isDiscard) {
+        HtmlTokenizerDiscard(pTree);
+    }
+
+    /* If a background tokenizer job is running (see -asyncparse), or the
+     * tokenizer yielded before the end of the document (-parsebudget), 
+     * the tree is completed and the outstanding node handlers run when 
+     * the remainder of the document is tokenized, not here.
+     */
     if (isFinal) {
-        HtmlInitTree(pTree);
         pTree->isParseFinished = 1;
-        if (pTree->eWriteState == HTML_WRITE_NONE) {
-            HtmlFinishNodeHandlers(pTree);
+        if (!pTree->pParseJob && !pTree->isParseYield) {
+            HtmlInitTree(pTree);
+            if (pTree->eWriteState == HTML_WRITE_NONE) {
+                HtmlFinishNodeHandlers(pTree);
+            }
         }
     }
  
@@ -2471,6 +2700,18 @@ styleconfigCmd(
 {
     return HtmlCssStyleConfigDump(clientData, interp, objc, objv);
 }
+#ifndef NDEBUG
+static int 
+selectorbenchCmd(
+    ClientData clientData,             /* The HTML widget data structure */
+    Tcl_Interp *interp,                /* Current interpreter. */
+    int objc,                          /* Number of arguments. */
+    Tcl_Obj *CONST objv[]              /* Argument strings. */ 
+    )
+{
+    return HtmlCssSelectorBench(clientData, interp, objc, objv);
+}
+#endif
 static int 
 stylereportCmd(
     ClientData clientData,             /* The HTML widget data structure */
@@ -2584,6 +2825,7 @@ int widgetCmd(
         /* The following are for debugging only. May change at any time.
 	 * They are not included in the documentation. Just don't touch Ok? :)
          */
+        {"_arenastats",  arenastatsCmd},
         {"_delay",       delayCmd},
         {"_force",       forceCmd},
         {"_images",      imagesCmd},
@@ -2593,6 +2835,7 @@ int widgetCmd(
         {"_stylereport", stylereportCmd},
 #ifndef NDEBUG
         {"_hashstats",  hashstatsCmd},
+        {"_selectorbench", selectorbenchCmd},
 #endif
         { 0, 0}
     };
@@ -2666,9 +2909,13 @@ newWidget(
     Tcl_InitHashTable(&pTree->aNodeHandler, TCL_ONE_WORD_KEYS);
     Tcl_InitHashTable(&pTree->aAttributeHandler, TCL_ONE_WORD_KEYS);
     Tcl_InitHashTable(&pTree->aOrphan, TCL_ONE_WORD_KEYS);
+    Tcl_InitHashTable(&pTree->aDynamicDep, TCL_ONE_WORD_KEYS);
+    Tcl_InitHashTable(&pTree->cb.aDynamic, TCL_ONE_WORD_KEYS);
+    Tcl_InitHashTable(&pTree->cb.aRestyle, TCL_ONE_WORD_KEYS);
     Tcl_InitHashTable(&pTree->aTag, TCL_STRING_KEYS);
     pTree->cmd = Tcl_CreateObjCommand(interp,zCmd,widgetCmd,pTree,widgetCmdDel);
 
+    pTree->pShared = sharedDataGet(interp);
     pType = HtmlCaseInsenstiveHashType();
     Tcl_InitCustomHashTable(&pTree->aAtom, TCL_CUSTOM_TYPE_KEYS, pType);
 
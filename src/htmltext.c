@@ -36,6 +36,11 @@
 #include <stdlib.h>
 #include "html.h"
 
+#if defined(__SSE2__) && defined(__GNUC__)
+# include <emmintrin.h>
+# define ESCAPE_SCAN_SSE2 1
+#endif
+
 #define ISNEWLINE(x) ((x) == '\n' || (x) == '\r')
 #define ISTAB(x) ((x) == '\t')
 #define ISSPACE(x) isspace((unsigned char)(x))
@@ -52,6 +57,7 @@
  * This file exports the following functions:
  *
  *     HtmlTranslateEscapes()
+ *     HtmlTranslateAttrEscapes()
  *         Translates Html escapes (i.e. "&nbsp;").
  *
  *     HtmlTagAddRemoveCmd()
@@ -90,372 +96,109 @@
 **         &nbsp;         nonbreakable space
 */
 
-/* Each escape sequence is recorded as an instance of the following
-** structure
+/* Each named character reference is recorded as an instance of the 
+** following structure. The table of all known references, aHtmlEntity[],
+** is generated from the file entities.txt by mkentities.tcl. It is 
+** stored in slot order for a minimal perfect hash (see mkhash.tcl), so
+** that a name is looked up by computing its slot and doing a single
+** comparison. See findEntity() below.
 */
-struct sgEsc {
-    char *zName;              /* The name of this escape sequence. ex: "amp" */
-    char value[8];            /* The value for this sequence. ex: "&" */
-    struct sgEsc *pNext;      /* Next sequence with the same hash on zName */
+struct HtmlEntity {
+    const char *zName;        /* The name of this reference. ex: "amp" */
+    int nName;                /* Length of zName in bytes */
+    const char *zValue;       /* UTF-8 value for this reference. ex: "&" */
+    int nValue;               /* Length of zValue in bytes */
+    int isLegacy;             /* True if the ';' may be omitted */
 };
 
-/* The following is a table of all escape sequences.  Add new sequences
-** by adding entries to this table.
-*/
-static struct sgEsc esc_sequences[] = {
-    {"nbsp", "\xC2\xA0", 0},            /* Unicode code-point 160 */
-    {"iexcl", "\xC2\xA1", 0},           /* Unicode code-point 161 */
-    {"cent", "\xC2\xA2", 0},            /* Unicode code-point 162 */
-    {"pound", "\xC2\xA3", 0},           /* Unicode code-point 163 */
-    {"curren", "\xC2\xA4", 0},          /* Unicode code-point 164 */
-    {"yen", "\xC2\xA5", 0},             /* Unicode code-point 165 */
-    {"brvbar", "\xC2\xA6", 0},          /* Unicode code-point 166 */
-    {"sect", "\xC2\xA7", 0},            /* Unicode code-point 167 */
-    {"uml", "\xC2\xA8", 0},             /* Unicode code-point 168 */
-    {"copy", "\xC2\xA9", 0},            /* Unicode code-point 169 */
-    {"ordf", "\xC2\xAA", 0},            /* Unicode code-point 170 */
-    {"laquo", "\xC2\xAB", 0},           /* Unicode code-point 171 */
-    {"not", "\xC2\xAC", 0},             /* Unicode code-point 172 */
-    {"shy", "\xC2\xAD", 0},             /* Unicode code-point 173 */
-    {"reg", "\xC2\xAE", 0},             /* Unicode code-point 174 */
-    {"macr", "\xC2\xAF", 0},            /* Unicode code-point 175 */
-    {"deg", "\xC2\xB0", 0},             /* Unicode code-point 176 */
-    {"plusmn", "\xC2\xB1", 0},          /* Unicode code-point 177 */
-    {"sup2", "\xC2\xB2", 0},            /* Unicode code-point 178 */
-    {"sup3", "\xC2\xB3", 0},            /* Unicode code-point 179 */
-    {"acute", "\xC2\xB4", 0},           /* Unicode code-point 180 */
-    {"micro", "\xC2\xB5", 0},           /* Unicode code-point 181 */
-    {"para", "\xC2\xB6", 0},            /* Unicode code-point 182 */
-    {"middot", "\xC2\xB7", 0},          /* Unicode code-point 183 */
-    {"cedil", "\xC2\xB8", 0},           /* Unicode code-point 184 */
-    {"sup1", "\xC2\xB9", 0},            /* Unicode code-point 185 */
-    {"ordm", "\xC2\xBA", 0},            /* Unicode code-point 186 */
-    {"raquo", "\xC2\xBB", 0},           /* Unicode code-point 187 */
-    {"frac14", "\xC2\xBC", 0},          /* Unicode code-point 188 */
-    {"frac12", "\xC2\xBD", 0},          /* Unicode code-point 189 */
-    {"frac34", "\xC2\xBE", 0},          /* Unicode code-point 190 */
-    {"iquest", "\xC2\xBF", 0},          /* Unicode code-point 191 */
-    {"Agrave", "\xC3\x80", 0},          /* Unicode code-point 192 */
-    {"Aacute", "\xC3\x81", 0},          /* Unicode code-point 193 */
-    {"Acirc", "\xC3\x82", 0},           /* Unicode code-point 194 */
-    {"Atilde", "\xC3\x83", 0},          /* Unicode code-point 195 */
-    {"Auml", "\xC3\x84", 0},            /* Unicode code-point 196 */
-    {"Aring", "\xC3\x85", 0},           /* Unicode code-point 197 */
-    {"AElig", "\xC3\x86", 0},           /* Unicode code-point 198 */
-    {"Ccedil", "\xC3\x87", 0},          /* Unicode code-point 199 */
-    {"Egrave", "\xC3\x88", 0},          /* Unicode code-point 200 */
-    {"Eacute", "\xC3\x89", 0},          /* Unicode code-point 201 */
-    {"Ecirc", "\xC3\x8A", 0},           /* Unicode code-point 202 */
-    {"Euml", "\xC3\x8B", 0},            /* Unicode code-point 203 */
-    {"Igrave", "\xC3\x8C", 0},          /* Unicode code-point 204 */
-    {"Iacute", "\xC3\x8D", 0},          /* Unicode code-point 205 */
-    {"Icirc", "\xC3\x8E", 0},           /* Unicode code-point 206 */
-    {"Iuml", "\xC3\x8F", 0},            /* Unicode code-point 207 */
-    {"ETH", "\xC3\x90", 0},             /* Unicode code-point 208 */
-    {"Ntilde", "\xC3\x91", 0},          /* Unicode code-point 209 */
-    {"Ograve", "\xC3\x92", 0},          /* Unicode code-point 210 */
-    {"Oacute", "\xC3\x93", 0},          /* Unicode code-point 211 */
-    {"Ocirc", "\xC3\x94", 0},           /* Unicode code-point 212 */
-    {"Otilde", "\xC3\x95", 0},          /* Unicode code-point 213 */
-    {"Ouml", "\xC3\x96", 0},            /* Unicode code-point 214 */
-    {"times", "\xC3\x97", 0},           /* Unicode code-point 215 */
-    {"Oslash", "\xC3\x98", 0},          /* Unicode code-point 216 */
-    {"Ugrave", "\xC3\x99", 0},          /* Unicode code-point 217 */
-    {"Uacute", "\xC3\x9A", 0},          /* Unicode code-point 218 */
-    {"Ucirc", "\xC3\x9B", 0},           /* Unicode code-point 219 */
-    {"Uuml", "\xC3\x9C", 0},            /* Unicode code-point 220 */
-    {"Yacute", "\xC3\x9D", 0},          /* Unicode code-point 221 */
-    {"THORN", "\xC3\x9E", 0},           /* Unicode code-point 222 */
-    {"szlig", "\xC3\x9F", 0},           /* Unicode code-point 223 */
-    {"agrave", "\xC3\xA0", 0},          /* Unicode code-point 224 */
-    {"aacute", "\xC3\xA1", 0},          /* Unicode code-point 225 */
-    {"acirc", "\xC3\xA2", 0},           /* Unicode code-point 226 */
-    {"atilde", "\xC3\xA3", 0},          /* Unicode code-point 227 */
-    {"auml", "\xC3\xA4", 0},            /* Unicode code-point 228 */
-    {"aring", "\xC3\xA5", 0},           /* Unicode code-point 229 */
-    {"aelig", "\xC3\xA6", 0},           /* Unicode code-point 230 */
-    {"ccedil", "\xC3\xA7", 0},          /* Unicode code-point 231 */
-    {"egrave", "\xC3\xA8", 0},          /* Unicode code-point 232 */
-    {"eacute", "\xC3\xA9", 0},          /* Unicode code-point 233 */
-    {"ecirc", "\xC3\xAA", 0},           /* Unicode code-point 234 */
-    {"euml", "\xC3\xAB", 0},            /* Unicode code-point 235 */
-    {"igrave", "\xC3\xAC", 0},          /* Unicode code-point 236 */
-    {"iacute", "\xC3\xAD", 0},          /* Unicode code-point 237 */
-    {"icirc", "\xC3\xAE", 0},           /* Unicode code-point 238 */
-    {"iuml", "\xC3\xAF", 0},            /* Unicode code-point 239 */
-    {"eth", "\xC3\xB0", 0},             /* Unicode code-point 240 */
-    {"ntilde", "\xC3\xB1", 0},          /* Unicode code-point 241 */
-    {"ograve", "\xC3\xB2", 0},          /* Unicode code-point 242 */
-    {"oacute", "\xC3\xB3", 0},          /* Unicode code-point 243 */
-    {"ocirc", "\xC3\xB4", 0},           /* Unicode code-point 244 */
-    {"otilde", "\xC3\xB5", 0},          /* Unicode code-point 245 */
-    {"ouml", "\xC3\xB6", 0},            /* Unicode code-point 246 */
-    {"divide", "\xC3\xB7", 0},          /* Unicode code-point 247 */
-    {"oslash", "\xC3\xB8", 0},          /* Unicode code-point 248 */
-    {"ugrave", "\xC3\xB9", 0},          /* Unicode code-point 249 */
-    {"uacute", "\xC3\xBA", 0},          /* Unicode code-point 250 */
-    {"ucirc", "\xC3\xBB", 0},           /* Unicode code-point 251 */
-    {"uuml", "\xC3\xBC", 0},            /* Unicode code-point 252 */
-    {"yacute", "\xC3\xBD", 0},          /* Unicode code-point 253 */
-    {"thorn", "\xC3\xBE", 0},           /* Unicode code-point 254 */
-    {"yuml", "\xC3\xBF", 0},            /* Unicode code-point 255 */
-    {"quot", "\x22", 0},                /* Unicode code-point 34 */
-    {"amp", "\x26", 0},                 /* Unicode code-point 38 */
-    {"lt", "\x3C", 0},                  /* Unicode code-point 60 */
-    {"gt", "\x3E", 0},                  /* Unicode code-point 62 */
-    {"OElig", "\xC5\x92", 0},           /* Unicode code-point 338 */
-    {"oelig", "\xC5\x93", 0},           /* Unicode code-point 339 */
-    {"Scaron", "\xC5\xA0", 0},          /* Unicode code-point 352 */
-    {"scaron", "\xC5\xA1", 0},          /* Unicode code-point 353 */
-    {"Yuml", "\xC5\xB8", 0},            /* Unicode code-point 376 */
-    {"circ", "\xCB\x86", 0},            /* Unicode code-point 710 */
-    {"tilde", "\xCB\x9C", 0},           /* Unicode code-point 732 */
-    {"ensp", "\xE2\x80\x82", 0},        /* Unicode code-point 8194 */
-    {"emsp", "\xE2\x80\x83", 0},        /* Unicode code-point 8195 */
-    {"thinsp", "\xE2\x80\x89", 0},      /* Unicode code-point 8201 */
-    {"zwnj", "\xE2\x80\x8C", 0},        /* Unicode code-point 8204 */
-    {"zwj", "\xE2\x80\x8D", 0},         /* Unicode code-point 8205 */
-    {"lrm", "\xE2\x80\x8E", 0},         /* Unicode code-point 8206 */
-    {"rlm", "\xE2\x80\x8F", 0},         /* Unicode code-point 8207 */
-    {"ndash", "\xE2\x80\x93", 0},       /* Unicode code-point 8211 */
-    {"mdash", "\xE2\x80\x94", 0},       /* Unicode code-point 8212 */
-    {"lsquo", "\xE2\x80\x98", 0},       /* Unicode code-point 8216 */
-    {"rsquo", "\xE2\x80\x99", 0},       /* Unicode code-point 8217 */
-    {"sbquo", "\xE2\x80\x9A", 0},       /* Unicode code-point 8218 */
-    {"ldquo", "\xE2\x80\x9C", 0},       /* Unicode code-point 8220 */
-    {"rdquo", "\xE2\x80\x9D", 0},       /* Unicode code-point 8221 */
-    {"bdquo", "\xE2\x80\x9E", 0},       /* Unicode code-point 8222 */
-    {"dagger", "\xE2\x80\xA0", 0},      /* Unicode code-point 8224 */
-    {"Dagger", "\xE2\x80\xA1", 0},      /* Unicode code-point 8225 */
-    {"permil", "\xE2\x80\xB0", 0},      /* Unicode code-point 8240 */
-    {"lsaquo", "\xE2\x80\xB9", 0},      /* Unicode code-point 8249 */
-    {"rsaquo", "\xE2\x80\xBA", 0},      /* Unicode code-point 8250 */
-    {"euro", "\xE2\x82\xAC", 0},        /* Unicode code-point 8364 */
-    {"fnof", "\xC6\x92", 0},            /* Unicode code-point 402 */
-    {"Alpha", "\xCE\x91", 0},           /* Unicode code-point 913 */
-    {"Beta", "\xCE\x92", 0},            /* Unicode code-point 914 */
-    {"Gamma", "\xCE\x93", 0},           /* Unicode code-point 915 */
-    {"Delta", "\xCE\x94", 0},           /* Unicode code-point 916 */
-    {"Epsilon", "\xCE\x95", 0},         /* Unicode code-point 917 */
-    {"Zeta", "\xCE\x96", 0},            /* Unicode code-point 918 */
-    {"Eta", "\xCE\x97", 0},             /* Unicode code-point 919 */
-    {"Theta", "\xCE\x98", 0},           /* Unicode code-point 920 */
-    {"Iota", "\xCE\x99", 0},            /* Unicode code-point 921 */
-    {"Kappa", "\xCE\x9A", 0},           /* Unicode code-point 922 */
-    {"Lambda", "\xCE\x9B", 0},          /* Unicode code-point 923 */
-    {"Mu", "\xCE\x9C", 0},              /* Unicode code-point 924 */
-    {"Nu", "\xCE\x9D", 0},              /* Unicode code-point 925 */
-    {"Xi", "\xCE\x9E", 0},              /* Unicode code-point 926 */
-    {"Omicron", "\xCE\x9F", 0},         /* Unicode code-point 927 */
-    {"Pi", "\xCE\xA0", 0},              /* Unicode code-point 928 */
-    {"Rho", "\xCE\xA1", 0},             /* Unicode code-point 929 */
-    {"Sigma", "\xCE\xA3", 0},           /* Unicode code-point 931 */
-    {"Tau", "\xCE\xA4", 0},             /* Unicode code-point 932 */
-    {"Upsilon", "\xCE\xA5", 0},         /* Unicode code-point 933 */
-    {"Phi", "\xCE\xA6", 0},             /* Unicode code-point 934 */
-    {"Chi", "\xCE\xA7", 0},             /* Unicode code-point 935 */
-    {"Psi", "\xCE\xA8", 0},             /* Unicode code-point 936 */
-    {"Omega", "\xCE\xA9", 0},           /* Unicode code-point 937 */
-    {"alpha", "\xCE\xB1", 0},           /* Unicode code-point 945 */
-    {"beta", "\xCE\xB2", 0},            /* Unicode code-point 946 */
-    {"gamma", "\xCE\xB3", 0},           /* Unicode code-point 947 */
-    {"delta", "\xCE\xB4", 0},           /* Unicode code-point 948 */
-    {"epsilon", "\xCE\xB5", 0},         /* Unicode code-point 949 */
-    {"zeta", "\xCE\xB6", 0},            /* Unicode code-point 950 */
-    {"eta", "\xCE\xB7", 0},             /* Unicode code-point 951 */
-    {"theta", "\xCE\xB8", 0},           /* Unicode code-point 952 */
-    {"iota", "\xCE\xB9", 0},            /* Unicode code-point 953 */
-    {"kappa", "\xCE\xBA", 0},           /* Unicode code-point 954 */
-    {"lambda", "\xCE\xBB", 0},          /* Unicode code-point 955 */
-    {"mu", "\xCE\xBC", 0},              /* Unicode code-point 956 */
-    {"nu", "\xCE\xBD", 0},              /* Unicode code-point 957 */
-    {"xi", "\xCE\xBE", 0},              /* Unicode code-point 958 */
-    {"omicron", "\xCE\xBF", 0},         /* Unicode code-point 959 */
-    {"pi", "\xCF\x80", 0},              /* Unicode code-point 960 */
-    {"rho", "\xCF\x81", 0},             /* Unicode code-point 961 */
-    {"sigmaf", "\xCF\x82", 0},          /* Unicode code-point 962 */
-    {"sigma", "\xCF\x83", 0},           /* Unicode code-point 963 */
-    {"tau", "\xCF\x84", 0},             /* Unicode code-point 964 */
-    {"upsilon", "\xCF\x85", 0},         /* Unicode code-point 965 */
-    {"phi", "\xCF\x86", 0},             /* Unicode code-point 966 */
-    {"chi", "\xCF\x87", 0},             /* Unicode code-point 967 */
-    {"psi", "\xCF\x88", 0},             /* Unicode code-point 968 */
-    {"omega", "\xCF\x89", 0},           /* Unicode code-point 969 */
-    {"thetasym", "\xCF\x91", 0},        /* Unicode code-point 977 */
-    {"upsih", "\xCF\x92", 0},           /* Unicode code-point 978 */
-    {"piv", "\xCF\x96", 0},             /* Unicode code-point 982 */
-    {"bull", "\xE2\x80\xA2", 0},        /* Unicode code-point 8226 */
-    {"hellip", "\xE2\x80\xA6", 0},      /* Unicode code-point 8230 */
-    {"prime", "\xE2\x80\xB2", 0},       /* Unicode code-point 8242 */
-    {"Prime", "\xE2\x80\xB3", 0},       /* Unicode code-point 8243 */
-    {"oline", "\xE2\x80\xBE", 0},       /* Unicode code-point 8254 */
-    {"frasl", "\xE2\x81\x84", 0},       /* Unicode code-point 8260 */
-    {"weierp", "\xE2\x84\x98", 0},      /* Unicode code-point 8472 */
-    {"image", "\xE2\x84\x91", 0},       /* Unicode code-point 8465 */
-    {"real", "\xE2\x84\x9C", 0},        /* Unicode code-point 8476 */
-    {"trade", "\xE2\x84\xA2", 0},       /* Unicode code-point 8482 */
-    {"alefsym", "\xE2\x84\xB5", 0},     /* Unicode code-point 8501 */
-    {"larr", "\xE2\x86\x90", 0},        /* Unicode code-point 8592 */
-    {"uarr", "\xE2\x86\x91", 0},        /* Unicode code-point 8593 */
-    {"rarr", "\xE2\x86\x92", 0},        /* Unicode code-point 8594 */
-    {"darr", "\xE2\x86\x93", 0},        /* Unicode code-point 8595 */
-    {"harr", "\xE2\x86\x94", 0},        /* Unicode code-point 8596 */
-    {"crarr", "\xE2\x86\xB5", 0},       /* Unicode code-point 8629 */
-    {"lArr", "\xE2\x87\x90", 0},        /* Unicode code-point 8656 */
-    {"uArr", "\xE2\x87\x91", 0},        /* Unicode code-point 8657 */
-    {"rArr", "\xE2\x87\x92", 0},        /* Unicode code-point 8658 */
-    {"dArr", "\xE2\x87\x93", 0},        /* Unicode code-point 8659 */
-    {"hArr", "\xE2\x87\x94", 0},        /* Unicode code-point 8660 */
-    {"forall", "\xE2\x88\x80", 0},      /* Unicode code-point 8704 */
-    {"part", "\xE2\x88\x82", 0},        /* Unicode code-point 8706 */
-    {"exist", "\xE2\x88\x83", 0},       /* Unicode code-point 8707 */
-    {"empty", "\xE2\x88\x85", 0},       /* Unicode code-point 8709 */
-    {"nabla", "\xE2\x88\x87", 0},       /* Unicode code-point 8711 */
-    {"isin", "\xE2\x88\x88", 0},        /* Unicode code-point 8712 */
-    {"notin", "\xE2\x88\x89", 0},       /* Unicode code-point 8713 */
-    {"ni", "\xE2\x88\x8B", 0},          /* Unicode code-point 8715 */
-    {"prod", "\xE2\x88\x8F", 0},        /* Unicode code-point 8719 */
-    {"sum", "\xE2\x88\x91", 0},         /* Unicode code-point 8721 */
-    {"minus", "\xE2\x88\x92", 0},       /* Unicode code-point 8722 */
-    {"lowast", "\xE2\x88\x97", 0},      /* Unicode code-point 8727 */
-    {"radic", "\xE2\x88\x9A", 0},       /* Unicode code-point 8730 */
-    {"prop", "\xE2\x88\x9D", 0},        /* Unicode code-point 8733 */
-    {"infin", "\xE2\x88\x9E", 0},       /* Unicode code-point 8734 */
-    {"ang", "\xE2\x88\xA0", 0},         /* Unicode code-point 8736 */
-    {"and", "\xE2\x88\xA7", 0},         /* Unicode code-point 8743 */
-    {"or", "\xE2\x88\xA8", 0},          /* Unicode code-point 8744 */
-    {"cap", "\xE2\x88\xA9", 0},         /* Unicode code-point 8745 */
-    {"cup", "\xE2\x88\xAA", 0},         /* Unicode code-point 8746 */
-    {"int", "\xE2\x88\xAB", 0},         /* Unicode code-point 8747 */
-    {"there4", "\xE2\x88\xB4", 0},      /* Unicode code-point 8756 */
-    {"sim", "\xE2\x88\xBC", 0},         /* Unicode code-point 8764 */
-    {"cong", "\xE2\x89\x85", 0},        /* Unicode code-point 8773 */
-    {"asymp", "\xE2\x89\x88", 0},       /* Unicode code-point 8776 */
-    {"ne", "\xE2\x89\xA0", 0},          /* Unicode code-point 8800 */
-    {"equiv", "\xE2\x89\xA1", 0},       /* Unicode code-point 8801 */
-    {"le", "\xE2\x89\xA4", 0},          /* Unicode code-point 8804 */
-    {"ge", "\xE2\x89\xA5", 0},          /* Unicode code-point 8805 */
-    {"sub", "\xE2\x8A\x82", 0},         /* Unicode code-point 8834 */
-    {"sup", "\xE2\x8A\x83", 0},         /* Unicode code-point 8835 */
-    {"nsub", "\xE2\x8A\x84", 0},        /* Unicode code-point 8836 */
-    {"sube", "\xE2\x8A\x86", 0},        /* Unicode code-point 8838 */
-    {"supe", "\xE2\x8A\x87", 0},        /* Unicode code-point 8839 */
-    {"oplus", "\xE2\x8A\x95", 0},       /* Unicode code-point 8853 */
-    {"otimes", "\xE2\x8A\x97", 0},      /* Unicode code-point 8855 */
-    {"perp", "\xE2\x8A\xA5", 0},        /* Unicode code-point 8869 */
-    {"sdot", "\xE2\x8B\x85", 0},        /* Unicode code-point 8901 */
-    {"lceil", "\xE2\x8C\x88", 0},       /* Unicode code-point 8968 */
-    {"rceil", "\xE2\x8C\x89", 0},       /* Unicode code-point 8969 */
-    {"lfloor", "\xE2\x8C\x8A", 0},      /* Unicode code-point 8970 */
-    {"rfloor", "\xE2\x8C\x8B", 0},      /* Unicode code-point 8971 */
-    {"lang", "\xE2\x8C\xA9", 0},        /* Unicode code-point 9001 */
-    {"rang", "\xE2\x8C\xAA", 0},        /* Unicode code-point 9002 */
-    {"loz", "\xE2\x97\x8A", 0},         /* Unicode code-point 9674 */
-    {"spades", "\xE2\x99\xA0", 0},      /* Unicode code-point 9824 */
-    {"clubs", "\xE2\x99\xA3", 0},       /* Unicode code-point 9827 */
-    {"hearts", "\xE2\x99\xA5", 0},      /* Unicode code-point 9829 */
-    {"diams", "\xE2\x99\xA6", 0},       /* Unicode code-point 9830 */
-  
-    /* Non-standard. But very common. */
-    {"quote", "\"", 0},
-    {"apos", "'", 0},
-};
-
-/* The size of the handler hash table.  For best results this should
-** be a prime number which is about the same size as the number of
-** escape sequences known to the system. */
-#define ESC_HASH_SIZE (sizeof(esc_sequences)/sizeof(esc_sequences[0])+7)
-
-/* The hash table 
-**
-** If the name of an escape sequences hashes to the value H, then
-** apEscHash[H] will point to a linked list of Esc structures, one of
-** which will be the Esc structure for that escape sequence.
-*/
-static struct sgEsc *apEscHash[ESC_HASH_SIZE];
+#include "htmlentities.c"
 
-/* Hash a escape sequence name.  The value returned is an integer
-** between 0 and ESC_HASH_SIZE-1, inclusive.
-*/
-static int 
-EscHash (const char *zName)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * findEntity --
+ *
+ *     Search for the named character reference with the n byte name 
+ *     at z. Names are case-sensitive.
+ *
+ * Results:
+ *     Pointer to the entry for the reference in aHtmlEntity[], or NULL 
+ *     if z is not the name of a known reference.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static const struct HtmlEntity *
+findEntity (const char *z, int n)
 {
-    int h = 0;                         /* The hash value to be returned */
-    char c;                            /* The next character in the name
-                                        * being hashed */
-
-    while ((c = *zName) != 0) {
-        h = h << 5 ^ h ^ c;
-        zName++;
-    }
-    if (h < 0) {
-        h = -h;
-    }
-    else {
-    }
-    return h % ESC_HASH_SIZE;
-}
+    const struct HtmlEntity *p;
+    unsigned int iBucket;
+    unsigned int iSlot;
 
-#ifdef TEST
+    iBucket = HtmlHashString(z, n, 0, 0) % HTML_ENTITY_BUCKETS;
+    iSlot = HtmlHashString(z, n, 0, aHtmlEntitySeed[iBucket]);
+    p = &aHtmlEntity[iSlot % HTML_ENTITY_COUNT];
 
-/* 
-** Compute the longest and average collision chain length for the
-** escape sequence hash table
-*/
-static void
-EscHashStats(void)
-{
-    int i;
-    int sum = 0;
-    int max = 0;
-    int cnt;
-    int notempty = 0;
-    struct sgEsc *p;
-
-    for (i = 0; i < sizeof(esc_sequences) / sizeof(esc_sequences[0]); i++) {
-        cnt = 0;
-        p = apEscHash[i];
-        if (p)
-            notempty++;
-        while (p) {
-            cnt++;
-            p = p->pNext;
-        }
-        sum += cnt;
-        if (cnt > max)
-            max = cnt;
+    if (p->nName == n && memcmp(p->zName, z, n) == 0) {
+        return p;
     }
-    printf("Longest chain=%d  avg=%g  slots=%d  empty=%d (%g%%)\n",
-           max, (double) sum / (double) notempty, i, i - notempty,
-           100.0 * (i - notempty) / (double) i);
+    return 0;
 }
-#endif
 
-/* Initialize the escape sequence hash table
-*/
-static void 
-EscInit (void)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * escapeScan --
+ *
+ *     Return the offset of the first byte in the n byte string z that
+ *     may need to be modified by translateEscapes(), or n if there is 
+ *     no such byte. Since most text contains no escapes at all, this
+ *     lets the common case skip the translation loop entirely.
+ *
+ *     The bytes searched for are '&' and, because code-points 0x80 to
+ *     0x9F are mapped to printable ASCII on Unix (see acMsChar[] below),
+ *     0xC2 (the UTF-8 lead byte for these code-points) and 0x80 to 0x9F
+ *     (these are returned by Tcl_UtfToUniChar() for invalid UTF-8). This
+ *     is conservative - text with many multi-byte characters will often
+ *     stop early and take the slow path.
+ *
+ *     Where SSE2 is available, 16 bytes are tested at a time.
+ *
+ * Results:
+ *     Byte offset.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+escapeScan (const char *z, int n)
 {
-    int i;                             /* For looping thru the list of escape 
-                                        * sequences */
-    int h;                             /* The hash on a sequence */
-
-    for (i = 0; i < sizeof(esc_sequences) / sizeof(esc_sequences[i]); i++) {
-
-/* #ifdef TCL_UTF_MAX */
-#if 0
-        {
-            int c = esc_sequences[i].value[0];
-            Tcl_UniCharToUtf(c, esc_sequences[i].value);
+    int i = 0;
+#ifdef ESCAPE_SCAN_SSE2
+    const __m128i amp = _mm_set1_epi8('&');
+    const __m128i c2 = _mm_set1_epi8((char)0xC2);
+    const __m128i a0 = _mm_set1_epi8((char)0xA0);
+
+    for ( ; (i + 16) <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&z[i]);
+        unsigned int mask = _mm_movemask_epi8(_mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, amp), _mm_cmpeq_epi8(v, c2)),
+            _mm_cmplt_epi8(v, a0)    /* Signed: true for 0x80..0x9F only */
+        ));
+        if (mask) {
+            return i + __builtin_ctz(mask);
         }
-#endif
-        h = EscHash(esc_sequences[i].zName);
-        esc_sequences[i].pNext = apEscHash[h];
-        apEscHash[h] = &esc_sequences[i];
     }
-#ifdef TEST
-    EscHashStats();
 #endif
+    for ( ; i < n; i++) {
+        unsigned char c = (unsigned char)z[i];
+        if (c == '&' || c == 0xC2 || (c >= 0x80 && c < 0xA0)) break;
+    }
+    return i;
 }
 
 /*
@@ -592,33 +335,49 @@ translateNumericEscape (
     return iRet;
 }
 
-/* Translate escape sequences in the string "z".  "z" is overwritten
-** with the translated sequence.
-**
-** Unrecognized escape sequences are unaltered.
-**
-** Example:
-**
-**      input =    "AT&amp;T &gt MCI"
-**      output =   "AT&T > MCI"
-*/
-void 
-HtmlTranslateEscapes (char *z)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * translateEscapes --
+ *
+ *     Translate escape sequences in the string "z".  "z" is overwritten
+ *     with the translated sequence.
+ *
+ *     Named character references are matched as described by HTML5. A
+ *     reference terminated by ';' may be any of the names in 
+ *     entities.txt. Otherwise, the longest prefix of the name that is a 
+ *     "legacy" reference (i.e. "&amp", "&copy") is used. If isAttr is
+ *     true, z is an attribute value, and a legacy reference with no ';' 
+ *     is not translated if it is followed by an alphanumeric or '=' 
+ *     character (so that URIs like "a.cgi?x=1&copy=2" are not mangled).
+ *
+ *     Unrecognized escape sequences are unaltered.
+ *
+ *     Example:
+ *
+ *         input =    "AT&amp;T &gt MCI"
+ *         output =   "AT&T > MCI"
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Modifies string z.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+translateEscapes (char *z, int isAttr)
 {
     int from;                          /* Read characters from this position
                                         * in z[] */
     int to;                            /* Write characters into this position 
                                         * in z[] */
-    int h;                             /* A hash on the escape sequence */
-    struct sgEsc *p;                   /* For looping down the escape
-                                        * sequence collision chain */
-    static int isInit = 0;             /* True after initialization */
 
-    from = to = 0;
-    if (!isInit) {
-        EscInit();
-        isInit = 1;
-    }
+    /* Skip over the prefix of the string that needs no translation. If
+     * that is the whole string (the usual case), return early.
+     */
+    from = to = escapeScan(z, strlen(z));
     while (z[from]) {
         if (z[from] == '&') {
             if (z[from + 1] == '#') {
@@ -655,29 +414,47 @@ HtmlTranslateEscapes (char *z)
                 from = i;
             }
             else {
+                const struct HtmlEntity *p = 0;
                 int i = from + 1;
-                int c;
-                while (z[i] && isalnum(z[i])) {
+                int nName;
+                while (z[i] && isalnum((unsigned char)z[i])) {
                     i++;
                 }
-                c = z[i];
-                z[i] = 0;
-                h = EscHash(&z[from + 1]);
-                p = apEscHash[h];
-                while (p && strcmp(p->zName, &z[from + 1]) != 0) {
-                    p = p->pNext;
+                nName = i - (from + 1);
+
+                if (z[i] == ';') {
+                    p = findEntity(&z[from + 1], nName);
+                    if (p) i++;
                 }
-                z[i] = c;
-                if (p) {
-                    int j;
-                    for (j = 0; p->value[j]; j++) {
-                        z[to++] = p->value[j];
+                if (!p) {
+                    /* No ';'. Look for the longest legacy reference that
+                     * is a prefix of the name. 
+                     */
+                    int n = MIN(nName, HTML_ENTITY_MAXLEGACY);
+                    for ( ; n > 0 && !p; n--) {
+                        p = findEntity(&z[from + 1], n);
+                        if (p && !p->isLegacy) p = 0;
                     }
-                    from = i;
-                    if (c == ';') {
-                        from++;
+                    if (p) {
+                        char c;
+                        i = from + 1 + p->nName;
+                        c = z[i];
+                        if (isAttr && (isalnum((unsigned char)c) || c == '=')) {
+                            p = 0;
+                        }
                     }
                 }
+
+                /* Since z[] is translated in place, the value may not be
+                 * longer than the reference it replaces. This is only
+                 * a problem for a few (2 code-point) values. Such
+                 * references are left untranslated.
+                 */
+                if (p && p->nValue <= (i - from)) {
+                    memcpy(&z[to], p->zValue, p->nValue);
+                    to += p->nValue;
+                    from = i;
+                }
                 else {
                     z[to++] = z[from++];
                 }
@@ -719,6 +496,36 @@ HtmlTranslateEscapes (char *z)
     z[to] = 0;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlTranslateEscapes --
+ * HtmlTranslateAttrEscapes --
+ *
+ *     Translate escape sequences in nul-terminated string z in place. 
+ *     HtmlTranslateEscapes() is used for text and 
+ *     HtmlTranslateAttrEscapes() for attribute values. See 
+ *     translateEscapes() for details.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     Modifies string z.
+ *
+ *---------------------------------------------------------------------------
+ */
+void 
+HtmlTranslateEscapes (char *z)
+{
+    translateEscapes(z, 0);
+}
+void 
+HtmlTranslateAttrEscapes (char *z)
+{
+    translateEscapes(z, 1);
+}
+
 static HtmlWidgetTag *
 getWidgetTag (HtmlTree *pTree, const char *zTag, int *pIsNew)
 {
@@ -1980,7 +1787,7 @@ populateTextNode (
 void 
 HtmlTextSet (HtmlTextNode *pText, int n, const char *z, int isTrimEnd, int isTrimStart)
 {
-    char *z2;
+    char *z2 = 0;
     HtmlTextToken *pFinal;
 
     int nText = 0;
@@ -1991,17 +1798,22 @@ HtmlTextSet (HtmlTextNode *pText, int n, const char *z, int isTrimEnd, int isTri
         HtmlFree(pText->aToken);
     }
 
-    /* Make a temporary copy of the text and translate any embedded html 
-     * escape characters (i.e. "&nbsp;"). Todo: Avoid this copy by changing
-     * populateTextNode() so that it deals with escapes.
+    /* If there are any embedded html escape characters (i.e. "&nbsp;"), 
+     * make a temporary copy of the text and translate them. Todo: Avoid 
+     * this copy by changing populateTextNode() so that it deals with 
+     * escapes. Most text nodes contain no escapes, and are used as is.
      */
-    z2 = (char *)HtmlAlloc("temp", n + 1);
-    memcpy(z2, z, n);
-    z2[n] = '\0';
-    HtmlTranslateEscapes(z2);
+    if (escapeScan(z, n) < n) {
+        z2 = (char *)HtmlAlloc("temp", n + 1);
+        memcpy(z2, z, n);
+        z2[n] = '\0';
+        HtmlTranslateEscapes(z2);
+        z = z2;
+        n = strlen(z2);
+    }
 
     /* Figure out how much space is required for this HtmlTextNode. */
-    populateTextNode(strlen(z2), z2, 0, &nToken, &nText);
+    populateTextNode(n, z, 0, &nToken, &nText);
     assert(nText >= 0 && nToken > 0);
 
     /* Allocate space for HtmlTextNode.aToken and HtmlTextNode.zText */
@@ -2015,7 +1827,7 @@ HtmlTextSet (HtmlTextNode *pText, int n, const char *z, int isTrimEnd, int isTri
     }
 
     /* Populate the HtmlTextNode.aToken and zText arrays. */
-    populateTextNode(strlen(z2), z2, pText, 0, 0);
+    populateTextNode(n, z, pText, 0, 0);
     HtmlFree(z2);
 
     assert(pText->aToken[nToken-1].eType == HTML_TEXT_TOKEN_END);
@@ -8,97 +8,117 @@
  */
 
 HtmlTokenMap HtmlMarkupMap[] = {
-  {"a",            Html_A,            HTMLTAG_INLINE, HtmlAnchorContent, 0},
-  {"address",      Html_ADDRESS,      0, 0, 0},
-  {"applet",       Html_APPLET,       HTMLTAG_INLINE, 0, 0},
-  {"area",         Html_AREA,         0|HTMLTAG_EMPTY, 0, 0},
-  {"base",         Html_BASE,         0|HTMLTAG_EMPTY, 0, 0},
-  {"basefont",     Html_BASEFONT,     0, 0, 0},
-  {"b",            Html_B,            HTMLTAG_INLINE, 0, 0},
-  {"big",          Html_BIG,          HTMLTAG_INLINE, 0, 0},
-  {"blockquote",   Html_BLOCKQUOTE,   HTMLTAG_BLOCK, 0, 0},
-  {"body",         Html_BODY,         0, 0, 0},
-  {"br",           Html_BR,           HTMLTAG_INLINE|HTMLTAG_EMPTY, 0, 0},
-  {"button",       Html_BUTTON,       0, 0, 0},
-  {"caption",      Html_CAPTION,      0, 0, 0},
-  {"center",       Html_CENTER,       HTMLTAG_BLOCK, 0, 0},
-  {"cite",         Html_CITE,         HTMLTAG_INLINE, 0, 0},
-  {"code",         Html_CODE,         HTMLTAG_INLINE, 0, 0},
-  {"dd",           Html_DD,           0, HtmlLiContent, 0},
-  {"dfn",          Html_DFN,          HTMLTAG_INLINE, 0, 0},
-  {"dir",          Html_DIR,          HTMLTAG_BLOCK, HtmlUlContent, 0},
-  {"div",          Html_DIV,          HTMLTAG_BLOCK, 0, 0},
-  {"dl",           Html_DL,           HTMLTAG_BLOCK, HtmlDlContent, 0},
-  {"dt",           Html_DT,           0, HtmlLiContent, 0},
-  {"em",           Html_EM,           HTMLTAG_INLINE, 0, 0},
-  {"fieldset",     Html_FIELDSET,     HTMLTAG_INLINE, 0, 0},
-  {"font",         Html_FONT,         HTMLTAG_INLINE, 0, 0},
-  {"form",         Html_FORM,         HTMLTAG_BLOCK, HtmlFormContent, 0},
-  {"frame",        Html_FRAME,        0|HTMLTAG_EMPTY, 0, 0},
-  {"frameset",     Html_FRAMESET,     0, 0, 0},
-  {"h1",           Html_H1,           HTMLTAG_BLOCK, 0, 0},
-  {"h2",           Html_H2,           HTMLTAG_BLOCK, 0, 0},
-  {"h3",           Html_H3,           HTMLTAG_BLOCK, 0, 0},
-  {"h4",           Html_H4,           HTMLTAG_BLOCK, 0, 0},
-  {"h5",           Html_H5,           HTMLTAG_BLOCK, 0, 0},
-  {"h6",           Html_H6,           HTMLTAG_BLOCK, 0, 0},
-  {"head",         Html_HEAD,         0, HtmlHeadContent, 0},
-  {"hr",           Html_HR,           HTMLTAG_BLOCK|HTMLTAG_EMPTY, 0, 0},
-  {"html",         Html_HTML,         0, 0, 0},
-  {"i",            Html_I,            HTMLTAG_INLINE, 0, 0},
-  {"iframe",       Html_IFRAME,       0, 0, 0},
-  {"img",          Html_IMG,          HTMLTAG_INLINE|HTMLTAG_EMPTY, 0, 0},
-  {"input",        Html_INPUT,        HTMLTAG_INLINE|HTMLTAG_EMPTY, 0, 0},
-  {"isindex",      Html_ISINDEX,      HTMLTAG_BLOCK|HTMLTAG_EMPTY, 0, 0},
-  {"kbd",          Html_KBD,          HTMLTAG_INLINE, 0, 0},
-  {"label",        Html_LABEL,        HTMLTAG_INLINE, 0, 0},
-  {"legend",       Html_LEGEND,       HTMLTAG_INLINE, 0, 0},
-  {"li",           Html_LI,           0, HtmlLiContent, 0},
-  {"link",         Html_LINK,         0|HTMLTAG_EMPTY, 0, 0},
-  {"map",          Html_MAP,          HTMLTAG_INLINE, 0, 0},
-  {"menu",         Html_MENU,         HTMLTAG_BLOCK, HtmlUlContent, 0},
-  {"meta",         Html_META,         0|HTMLTAG_EMPTY, 0, 0},
-  {"noframes",     Html_NOFRAMES,     0, 0, 0},
-  {"noscript",     Html_NOSCRIPT,     0, 0, 0},
-  {"object",       Html_OBJECT,       0, 0, 0},
-  {"ol",           Html_OL,           HTMLTAG_BLOCK, HtmlUlContent, 0},
-  {"option",       Html_OPTION,       HTMLTAG_INLINE, HtmlPcdataContent, 0},
-  {"p",            Html_P,            HTMLTAG_BLOCK, HtmlInlineContent, 0},
-  {"param",        Html_PARAM,        0|HTMLTAG_EMPTY, 0, 0},
-  {"pre",          Html_PRE,          HTMLTAG_BLOCK, 0, 0},
-  {"s",            Html_S,            HTMLTAG_INLINE, 0, 0},
-  {"samp",         Html_SAMP,         HTMLTAG_INLINE, 0, 0},
-  {"script",       Html_SCRIPT,       HTMLTAG_INLINE|HTMLTAG_EMPTY, 0, 0},
-  {"select",       Html_SELECT,       HTMLTAG_INLINE, 0, 0},
-  {"small",        Html_SMALL,        HTMLTAG_INLINE, 0, 0},
-  {"span",         Html_SPAN,         HTMLTAG_INLINE, 0, 0},
-  {"strike",       Html_STRIKE,       HTMLTAG_INLINE, 0, 0},
-  {"strong",       Html_STRONG,       HTMLTAG_INLINE, 0, 0},
-  {"style",        Html_STYLE,        0|HTMLTAG_EMPTY, 0, 0},
-  {"sub",          Html_SUB,          HTMLTAG_INLINE, 0, 0},
-  {"sup",          Html_SUP,          HTMLTAG_INLINE, 0, 0},
-  {"table",        Html_TABLE,        HTMLTAG_BLOCK, HtmlTableContent, 0},
-  {"tbody",        Html_TBODY,        0, 0, 0},
-  {"td",           Html_TD,           0, HtmlTableCellContent, 0},
-  {"textarea",     Html_TEXTAREA,     HTMLTAG_INLINE|HTMLTAG_PCDATA, 0, 0},
-  {"tfoot",        Html_TFOOT,        0, 0, 0},
-  {"th",           Html_TH,           0, HtmlTableCellContent, 0},
-  {"thead",        Html_THEAD,        0, 0, 0},
-  {"title",        Html_TITLE,        0, 0, 0},
-  {"tr",           Html_TR,           0, HtmlTableRowContent, 0},
-  {"tt",           Html_TT,           HTMLTAG_INLINE, 0, 0},
-  {"u",            Html_U,            HTMLTAG_INLINE, 0, 0},
-  {"ul",           Html_UL,           HTMLTAG_BLOCK, HtmlUlContent, 0},
-  {"var",          Html_VAR,          HTMLTAG_INLINE, 0, 0},
-  {"comment",      Html_COMMENT,      0, 0, 0},
-  {"embed",        Html_EMBED,        0|HTMLTAG_EMPTY, 0, 0},
-  {"listing",      Html_LISTING,      0, 0, 0},
-  {"marquee",      Html_MARQUEE,      0, 0, 0},
-  {"nextid",       Html_NEXTID,       0|HTMLTAG_EMPTY, 0, 0},
-  {"nobr",         Html_NOBR,         HTMLTAG_INLINE, 0, 0},
-  {"noembed",      Html_NOEMBED,      0, 0, 0},
-  {"plaintext",    Html_PLAINTEXT,    0, HtmlInlineContent, 0},
-  {"wbr",          Html_WBR,          HTMLTAG_INLINE|HTMLTAG_EMPTY, 0, 0},
-  {"xmp",          Html_XMP,          0, 0, 0},
-  {"bgsound",      Html_BGSOUND,      0|HTMLTAG_EMPTY, 0, 0},
+  {"a",            Html_A,            HTMLTAG_INLINE, HtmlAnchorContent},
+  {"address",      Html_ADDRESS,      0, 0},
+  {"applet",       Html_APPLET,       HTMLTAG_INLINE, 0},
+  {"area",         Html_AREA,         0|HTMLTAG_EMPTY, 0},
+  {"base",         Html_BASE,         0|HTMLTAG_EMPTY, 0},
+  {"basefont",     Html_BASEFONT,     0, 0},
+  {"b",            Html_B,            HTMLTAG_INLINE, 0},
+  {"big",          Html_BIG,          HTMLTAG_INLINE, 0},
+  {"blockquote",   Html_BLOCKQUOTE,   HTMLTAG_BLOCK, 0},
+  {"body",         Html_BODY,         0, 0},
+  {"br",           Html_BR,           HTMLTAG_INLINE|HTMLTAG_EMPTY, 0},
+  {"button",       Html_BUTTON,       0, 0},
+  {"caption",      Html_CAPTION,      0, 0},
+  {"center",       Html_CENTER,       HTMLTAG_BLOCK, 0},
+  {"cite",         Html_CITE,         HTMLTAG_INLINE, 0},
+  {"code",         Html_CODE,         HTMLTAG_INLINE, 0},
+  {"dd",           Html_DD,           0, HtmlLiContent},
+  {"dfn",          Html_DFN,          HTMLTAG_INLINE, 0},
+  {"dir",          Html_DIR,          HTMLTAG_BLOCK, HtmlUlContent},
+  {"div",          Html_DIV,          HTMLTAG_BLOCK, 0},
+  {"dl",           Html_DL,           HTMLTAG_BLOCK, HtmlDlContent},
+  {"dt",           Html_DT,           0, HtmlLiContent},
+  {"em",           Html_EM,           HTMLTAG_INLINE, 0},
+  {"fieldset",     Html_FIELDSET,     HTMLTAG_INLINE, 0},
+  {"font",         Html_FONT,         HTMLTAG_INLINE, 0},
+  {"form",         Html_FORM,         HTMLTAG_BLOCK, HtmlFormContent},
+  {"frame",        Html_FRAME,        0|HTMLTAG_EMPTY, 0},
+  {"frameset",     Html_FRAMESET,     0, 0},
+  {"h1",           Html_H1,           HTMLTAG_BLOCK, 0},
+  {"h2",           Html_H2,           HTMLTAG_BLOCK, 0},
+  {"h3",           Html_H3,           HTMLTAG_BLOCK, 0},
+  {"h4",           Html_H4,           HTMLTAG_BLOCK, 0},
+  {"h5",           Html_H5,           HTMLTAG_BLOCK, 0},
+  {"h6",           Html_H6,           HTMLTAG_BLOCK, 0},
+  {"head",         Html_HEAD,         0, HtmlHeadContent},
+  {"hr",           Html_HR,           HTMLTAG_BLOCK|HTMLTAG_EMPTY, 0},
+  {"html",         Html_HTML,         0, 0},
+  {"i",            Html_I,            HTMLTAG_INLINE, 0},
+  {"iframe",       Html_IFRAME,       0, 0},
+  {"img",          Html_IMG,          HTMLTAG_INLINE|HTMLTAG_EMPTY, 0},
+  {"input",        Html_INPUT,        HTMLTAG_INLINE|HTMLTAG_EMPTY, 0},
+  {"isindex",      Html_ISINDEX,      HTMLTAG_BLOCK|HTMLTAG_EMPTY, 0},
+  {"kbd",          Html_KBD,          HTMLTAG_INLINE, 0},
+  {"label",        Html_LABEL,        HTMLTAG_INLINE, 0},
+  {"legend",       Html_LEGEND,       HTMLTAG_INLINE, 0},
+  {"li",           Html_LI,           0, HtmlLiContent},
+  {"link",         Html_LINK,         0|HTMLTAG_EMPTY, 0},
+  {"map",          Html_MAP,          HTMLTAG_INLINE, 0},
+  {"menu",         Html_MENU,         HTMLTAG_BLOCK, HtmlUlContent},
+  {"meta",         Html_META,         0|HTMLTAG_EMPTY, 0},
+  {"noframes",     Html_NOFRAMES,     0, 0},
+  {"noscript",     Html_NOSCRIPT,     0, 0},
+  {"object",       Html_OBJECT,       0, 0},
+  {"ol",           Html_OL,           HTMLTAG_BLOCK, HtmlUlContent},
+  {"option",       Html_OPTION,       HTMLTAG_INLINE, HtmlPcdataContent},
+  {"p",            Html_P,            HTMLTAG_BLOCK, HtmlInlineContent},
+  {"param",        Html_PARAM,        0|HTMLTAG_EMPTY, 0},
+  {"pre",          Html_PRE,          HTMLTAG_BLOCK, 0},
+  {"s",            Html_S,            HTMLTAG_INLINE, 0},
+  {"samp",         Html_SAMP,         HTMLTAG_INLINE, 0},
+  {"script",       Html_SCRIPT,       HTMLTAG_INLINE|HTMLTAG_EMPTY, 0},
+  {"select",       Html_SELECT,       HTMLTAG_INLINE, 0},
+  {"small",        Html_SMALL,        HTMLTAG_INLINE, 0},
+  {"span",         Html_SPAN,         HTMLTAG_INLINE, 0},
+  {"strike",       Html_STRIKE,       HTMLTAG_INLINE, 0},
+  {"strong",       Html_STRONG,       HTMLTAG_INLINE, 0},
+  {"style",        Html_STYLE,        0|HTMLTAG_EMPTY, 0},
+  {"sub",          Html_SUB,          HTMLTAG_INLINE, 0},
+  {"sup",          Html_SUP,          HTMLTAG_INLINE, 0},
+  {"table",        Html_TABLE,        HTMLTAG_BLOCK, HtmlTableContent},
+  {"tbody",        Html_TBODY,        0, 0},
+  {"td",           Html_TD,           0, HtmlTableCellContent},
+  {"textarea",     Html_TEXTAREA,     HTMLTAG_INLINE|HTMLTAG_PCDATA, 0},
+  {"tfoot",        Html_TFOOT,        0, 0},
+  {"th",           Html_TH,           0, HtmlTableCellContent},
+  {"thead",        Html_THEAD,        0, 0},
+  {"title",        Html_TITLE,        0, 0},
+  {"tr",           Html_TR,           0, HtmlTableRowContent},
+  {"tt",           Html_TT,           HTMLTAG_INLINE, 0},
+  {"u",            Html_U,            HTMLTAG_INLINE, 0},
+  {"ul",           Html_UL,           HTMLTAG_BLOCK, HtmlUlContent},
+  {"var",          Html_VAR,          HTMLTAG_INLINE, 0},
+  {"comment",      Html_COMMENT,      0, 0},
+  {"embed",        Html_EMBED,        0|HTMLTAG_EMPTY, 0},
+  {"listing",      Html_LISTING,      0, 0},
+  {"marquee",      Html_MARQUEE,      0, 0},
+  {"nextid",       Html_NEXTID,       0|HTMLTAG_EMPTY, 0},
+  {"nobr",         Html_NOBR,         HTMLTAG_INLINE, 0},
+  {"noembed",      Html_NOEMBED,      0, 0},
+  {"plaintext",    Html_PLAINTEXT,    0, HtmlInlineContent},
+  {"wbr",          Html_WBR,          HTMLTAG_INLINE|HTMLTAG_EMPTY, 0},
+  {"xmp",          Html_XMP,          0, 0},
+  {"bgsound",      Html_BGSOUND,      0|HTMLTAG_EMPTY, 0},
+};
+
+const unsigned short HtmlMarkupHashSeed[47] = {
+        5,    13,     1,     6,     2,     5,     6,     7,     1,     3,
+        1,     1,     4,     3,     3,    20,    10,     0,    10,     1,
+        5,     0,     6,     2,     4,     2,     1,    24,    11,    22,
+       41,     9,     9,    13,     8,    11,    45,    31,    31,     0,
+       26,    11,     5,     0,   110,     2,    15,
+};
+const unsigned char HtmlMarkupHashSlot[93] = {
+       69,    87,     4,    10,     5,    21,    14,    60,     8,    65,
+       36,    75,    32,    16,    23,     9,    91,    46,    68,    25,
+       51,    81,    61,    11,    80,    19,    44,    71,    70,    35,
+        0,    86,    76,    31,    85,    78,    74,    38,    20,    47,
+       83,    56,    52,    58,    89,    40,     3,    50,    27,    28,
+       30,    62,    15,    42,    53,    92,     7,    54,    82,    57,
+       43,    88,    64,    63,    34,    29,    48,    33,    73,    77,
+        2,    45,    66,     1,    84,    72,    12,     6,    41,    24,
+       67,    37,    18,    79,    55,    39,    90,    22,    49,    26,
+       17,    13,    59,
 };
@@ -107,5 +107,5 @@
 #define Html_XMP             96
 #define Html_BGSOUND         97
 #define Html_TypeCount 98
-#define HTML_MARKUP_HASH_SIZE 109
 #define HTML_MARKUP_COUNT 93
+#define HTML_MARKUP_HASH_BUCKETS 47
@@ -48,6 +48,7 @@ struct HtmlFragmentContext {
   HtmlNode *pRoot;
   HtmlElementNode *pCurrent;
   Tcl_Obj *pNodeList;
+  HtmlElementNode *pTarget;    /* Parent for [$node replace -html] or NULL */
 };
 
 /*
@@ -224,7 +225,7 @@ HtmlNodeClearStyle (HtmlTree *pTree, HtmlElementNode *pElem)
         HtmlComputedValuesRelease(pTree, pElem->pPropertyValues);
         HtmlComputedValuesRelease(pTree, pElem->pPreviousValues);
         HtmlCssInlineFree(pElem->pStyle);
-        HtmlCssFreeDynamics(pElem);
+        HtmlCssFreeDynamics(pTree, pElem);
         pElem->pStyle = 0;
         pElem->pPropertyValues = 0;
         pElem->pPreviousValues = 0;
@@ -248,6 +249,283 @@ HtmlNodeDeleteCommand (HtmlTree *pTree, HtmlNode *pNode)
 }
 
 
+/*
+ * Header at the start of each block of memory allocated for an
+ * HtmlNodeArena. The usable space begins ARENA_HDRSIZE bytes after the
+ * start of the block (rounded up so that it is suitably aligned).
+ */
+struct HtmlArenaBlock {
+    HtmlArenaBlock *pNext;       /* Next (older) block in arena */
+};
+#define ARENA_ROUND8(x) (((x) + 7) & ~7)
+#define ARENA_HDRSIZE ARENA_ROUND8(sizeof(HtmlArenaBlock))
+
+/* Largest apChildren[] array allocated from the arena (in entries). */
+#define ARENA_MAXCHILDREN (1 << (HTML_ARENA_NCLASS - 2))
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * arenaSize --
+ *
+ *     Return the number of bytes in an allocation of size class iClass.
+ *     See the comments above struct HtmlNodeArena in html.h.
+ *
+ * Results:
+ *     Size in bytes.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int 
+arenaSize (int iClass)
+{
+    if (iClass == 0) {
+        return ARENA_ROUND8(sizeof(HtmlElementNode));
+    }
+    return ARENA_ROUND8((1 << (iClass - 1)) * sizeof(HtmlNode *));
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * arenaAlloc --
+ *
+ *     Allocate a zeroed chunk of memory of size class iClass from the
+ *     arena. If the free-list for iClass is not empty, the first entry
+ *     is reused. Otherwise the allocation is carved from the current
+ *     block, allocating a new block first if required.
+ *
+ * Results:
+ *     Pointer to allocated memory.
+ *
+ * Side effects:
+ *     May allocate a new block from the heap.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void *
+arenaAlloc (HtmlNodeArena *pArena, int iClass)
+{
+    int nByte = arenaSize(iClass);
+    void *pRet = pArena->apFree[iClass];
+
+    assert(iClass >= 0 && iClass < HTML_ARENA_NCLASS);
+
+    if (pRet) {
+        pArena->apFree[iClass] = *(void **)pRet;
+        pArena->nReuse++;
+    } else {
+        if (!pArena->pBlock || pArena->iFree + nByte > HTML_ARENA_BLOCKSIZE) {
+            HtmlArenaBlock *pNew = (HtmlArenaBlock *)HtmlAlloc(
+                "HtmlArenaBlock", ARENA_HDRSIZE + HTML_ARENA_BLOCKSIZE
+            );
+            pNew->pNext = pArena->pBlock;
+            pArena->pBlock = pNew;
+            pArena->iFree = 0;
+            pArena->nBlock++;
+        }
+        pRet = &((char *)pArena->pBlock)[ARENA_HDRSIZE + pArena->iFree];
+        pArena->iFree += nByte;
+    }
+
+    pArena->nAlloc++;
+    pArena->nLive++;
+    memset(pRet, 0, nByte);
+    return pRet;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * arenaFree --
+ *
+ *     Return an allocation of size class iClass, obtained from 
+ *     arenaAlloc(), to the free-list for that class.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+arenaFree (HtmlNodeArena *pArena, int iClass, void *p)
+{
+    assert(iClass >= 0 && iClass < HTML_ARENA_NCLASS);
+    assert(pArena->nLive > 0);
+    *(void **)p = pArena->apFree[iClass];
+    pArena->apFree[iClass] = p;
+    pArena->nLive--;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * arenaClear --
+ *
+ *     Release all blocks allocated by an arena back to the heap. This is
+ *     called by HtmlTreeClear() after all nodes have been freed.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     All memory allocated from the arena becomes invalid.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+arenaClear (HtmlNodeArena *pArena)
+{
+    HtmlArenaBlock *pBlock = pArena->pBlock;
+    assert(pArena->nLive == 0);
+    while (pBlock) {
+        HtmlArenaBlock *pNext = pBlock->pNext;
+        HtmlFree(pBlock);
+        pBlock = pNext;
+    }
+    memset(pArena, 0, sizeof(HtmlNodeArena));
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlElementNew --
+ *
+ *     Allocate a new, zeroed, HtmlElementNode structure from the arena
+ *     belonging to tree pTree. The structure is freed by freeNode().
+ *
+ * Results:
+ *     Pointer to new element node.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+HtmlElementNode *
+HtmlElementNew (HtmlTree *pTree)
+{
+    return (HtmlElementNode *)arenaAlloc(&pTree->arena, 0);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * childArrayClass --
+ *
+ *     Return the arena size class used for an apChildren[] array with
+ *     space for nAlloc entries, or 0 if such an array is allocated from
+ *     the heap. nAlloc must be a power of two.
+ *
+ * Results:
+ *     Size class.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int 
+childArrayClass (int nAlloc)
+{
+    int iClass = 1;
+    if (nAlloc > ARENA_MAXCHILDREN) return 0;
+    while ((1 << (iClass - 1)) < nAlloc) iClass++;
+    return iClass;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * nodeFreeChildArray --
+ *
+ *     Free the HtmlElementNode.apChildren[] array of element pElem.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     None.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+nodeFreeChildArray (HtmlTree *pTree, HtmlElementNode *pElem)
+{
+    if (pElem->apChildren) {
+        int iClass = childArrayClass(pElem->nChildAlloc);
+        if (iClass) {
+            arenaFree(&pTree->arena, iClass, pElem->apChildren);
+        } else {
+            HtmlFree(pElem->apChildren);
+        }
+    }
+    pElem->apChildren = 0;
+    pElem->nChildAlloc = 0;
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * nodeGrowChildArray --
+ *
+ *     Make sure the HtmlElementNode.apChildren[] array of element pElem
+ *     has space for at least nReq entries. The array grows by doubling.
+ *     Small arrays are allocated from the tree arena, larger ones from
+ *     the heap.
+ *
+ * Results:
+ *     None.
+ *
+ * Side effects:
+ *     May reallocate pElem->apChildren.
+ *
+ *---------------------------------------------------------------------------
+ */
+static void 
+nodeGrowChildArray (HtmlTree *pTree, HtmlElementNode *pElem, int nReq)
+{
+    int nAlloc;
+    int iClass;
+    HtmlNode **apNew;
+
+    if (nReq <= pElem->nChildAlloc) return;
+
+    nAlloc = (pElem->nChildAlloc ? pElem->nChildAlloc : 1);
+    while (nAlloc < nReq) nAlloc = nAlloc * 2;
+    iClass = childArrayClass(nAlloc);
+
+    if (iClass == 0 && childArrayClass(pElem->nChildAlloc) == 0) {
+        /* Both the old and new arrays are (or will be) heap allocations. */
+        apNew = (HtmlNode **)HtmlRealloc(
+            "HtmlNode.apChildren", pElem->apChildren, 
+            nAlloc * sizeof(HtmlNode *)
+        );
+    } else {
+        if (iClass) {
+            apNew = (HtmlNode **)arenaAlloc(&pTree->arena, iClass);
+        } else {
+            apNew = (HtmlNode **)HtmlAlloc(
+                "HtmlNode.apChildren", nAlloc * sizeof(HtmlNode *)
+            );
+            pTree->arena.nLarge++;
+        }
+        if (pElem->nChild > 0) {
+            memcpy(apNew, pElem->apChildren, pElem->nChild*sizeof(HtmlNode *));
+        }
+        nodeFreeChildArray(pTree, pElem);
+    }
+
+    pElem->apChildren = apNew;
+    pElem->nChildAlloc = nAlloc;
+}
+
 /*
  *---------------------------------------------------------------------------
  *
@@ -270,6 +548,7 @@ freeNode (HtmlTree *pTree, HtmlNode *pNode)
 {
     if( pNode ){
         int i;
+        Tcl_HashEntry *hRestyle;
 
         /* Invalidate the cache of the parent node before deleting any
          * child nodes. This is because invalidating a cache may involve
@@ -281,11 +560,13 @@ freeNode (HtmlTree *pTree, HtmlNode *pNode)
         if (!HtmlNodeIsText(pNode)) {
             /* Do HtmlElementNode specific destruction */
             HtmlElementNode *pElem = (HtmlElementNode *)pNode;
+            HtmlCssSearchFreeNode(pTree, pNode);
             HtmlFree(pElem->pAttributes);
+            HtmlFree(pElem->pAtoms);
 
             /* Delete the computed values caches. */
             HtmlNodeClearStyle(pTree, pElem);
-            HtmlCssFreeDynamics(pElem);
+            HtmlCssFreeDynamics(pTree, pElem);
 
             if (pElem->pOverride) {
                 Tcl_DecrRefCount(pElem->pOverride);
@@ -296,7 +577,7 @@ freeNode (HtmlTree *pTree, HtmlNode *pNode)
             for(i=0; i < pElem->nChild; i++){
                 freeNode(pTree, pElem->apChildren[i]);
             }
-            HtmlFree(pElem->apChildren);
+            nodeFreeChildArray(pTree, pElem);
 
             clearReplacement(pTree, pElem);
 
@@ -312,9 +593,19 @@ freeNode (HtmlTree *pTree, HtmlNode *pNode)
         /* Delete the computed values caches. */
         HtmlDelScrollbars(pTree, pNode);
 
+        /* If this node is a pending restyle root, remove it from the set. */
+        hRestyle = Tcl_FindHashEntry(&pTree->cb.aRestyle, (char *)pNode);
+        if (hRestyle) {
+            Tcl_DeleteHashEntry(hRestyle);
+        }
+
         HtmlNodeDeleteCommand(pTree, pNode);
 
-        HtmlFree(pNode);
+        if (HtmlNodeIsText(pNode)) {
+            HtmlFree(pNode);
+        } else {
+            arenaFree(&pTree->arena, 0, pNode);
+        }
     }
 }
 
@@ -618,7 +909,6 @@ HtmlNodeIndexOfChild (HtmlNode *pParent, HtmlNode *pChild)
 static void 
 nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, HtmlNode *pAfter, HtmlNode *pChild)
 {
-    int n;                  /* Number of bytes to alloc for pNode->apChildren */
     int ii;
     int iBefore;
 
@@ -642,6 +932,7 @@ nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, Htm
          * moved to the orphan tree has all style/layout info cleared.
          */
         HtmlNodeClearRecursive(pTree, pChild);
+        HtmlCssSearchRemove(pTree, pChild);
         nodeRemoveChild(HtmlNodeAsElement(pParent), pChild);
     }
 
@@ -658,11 +949,8 @@ nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, Htm
 
     /* Extend the size of the HtmlElementNode.apChildren[] array */
     assert(pElem);
+    nodeGrowChildArray(pTree, pElem, pElem->nChild + 1);
     pElem->nChild++;
-    n = (pElem->nChild) * sizeof(HtmlNode*);
-    pElem->apChildren = (HtmlNode **)HtmlRealloc(
-        "HtmlNode.apChildren", (char *)pElem->apChildren, n
-    );
 
     for (ii = (pElem->nChild - 1); ii > iBefore; ii--) {
         pElem->apChildren[ii] = pElem->apChildren[ii - 1];
@@ -671,6 +959,7 @@ nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, Htm
 
     /* Link pChild into the new parent node */
     pChild->pParent = (HtmlNode *)pElem;
+    HtmlCssSearchInsert(pTree, pChild);
 }
 
 
@@ -683,7 +972,7 @@ nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, Htm
  *     token for the new node. The value returned is the index of the new
  *     child. So the call:
  *
- *          HtmlNodeChild(pNode, HtmlNodeAddChild(pNode, pToken))
+ *          HtmlNodeChild(pNode, HtmlNodeAddChild(pTree, pNode, pToken))
  *
  *     returns the new child node.
  *
@@ -697,44 +986,45 @@ nodeInsertChild (HtmlTree *pTree, HtmlElementNode *pElem, HtmlNode *pBefore, Htm
  */
 int 
 HtmlNodeAddChild (
+    HtmlTree *pTree,
     HtmlElementNode *pElem,
     int eTag,
     const char *zTag,               /* Atom for tag name */
     HtmlAttributes *pAttributes
 )
 {
-    int n;                  /* Number of bytes to alloc for pNode->apChildren */
     int r;                  /* Return value */
     HtmlElementNode *pNew;  /* New child node */
 
     assert(pElem);
     
+    nodeGrowChildArray(pTree, pElem, pElem->nChild + 1);
     r = pElem->nChild++;
-    n = (r+1) * sizeof(HtmlNode*);
-    pElem->apChildren = (HtmlNode **)HtmlRealloc(
-        "HtmlNode.apChildren", (char *)pElem->apChildren, n
-    );
 
     if (!zTag) {
         zTag = HtmlTypeToName(0, eTag);
     }
     assert(zTag);
 
-    pNew = HtmlNew(HtmlElementNode);
+    pNew = HtmlElementNew(pTree);
     pNew->pAttributes = pAttributes;
     pNew->node.pParent = (HtmlNode *)pElem;
     pNew->node.eTag = eTag;
     pNew->node.zTag = zTag;
     pElem->apChildren[r] = (HtmlNode *)pNew;
+    HtmlCssSearchInsert(pTree, (HtmlNode *)pNew);
 
     assert(r < pElem->nChild);
     return r;
 }
 
 int 
-HtmlNodeAddTextChild (HtmlNode *pNode, HtmlTextNode *pTextNode)
+HtmlNodeAddTextChild (
+    HtmlTree *pTree,
+    HtmlNode *pNode,
+    HtmlTextNode *pTextNode
+)
 {
-    int n;             /* Number of bytes to alloc for pNode->apChildren */
     int r;             /* Return value */
     HtmlNode *pNew;    /* New child node */
 
@@ -743,11 +1033,8 @@ HtmlNodeAddTextChild (HtmlNode *pNode, HtmlTextNode *pTextNode)
     assert(pElem);
     assert(pTextNode);
     
+    nodeGrowChildArray(pTree, pElem, pElem->nChild + 1);
     r = pElem->nChild++;
-    n = (r+1) * sizeof(HtmlNode*);
-    pElem->apChildren = (HtmlNode **)HtmlRealloc(
-        "HtmlNode.apChildren", (char *)pElem->apChildren, n
-    );
 
     pNew = (HtmlNode *)pTextNode;
     memset(pNew, 0, sizeof(HtmlNode));
@@ -777,7 +1064,12 @@ HtmlNodeAddTextChild (HtmlNode *pNode, HtmlTextNode *pTextNode)
  *---------------------------------------------------------------------------
  */
 static void 
-setNodeAttribute (HtmlNode *pNode, const char *zAttrName, const char *zAttrVal)
+setNodeAttribute (
+    HtmlTree *pTree,
+    HtmlNode *pNode, 
+    const char *zAttrName, 
+    const char *zAttrVal
+)
 {
     #define MAX_NUM_ATTRIBUTES 100
     char const *azPtr[MAX_NUM_ATTRIBUTES * 2];
@@ -788,14 +1080,18 @@ setNodeAttribute (HtmlNode *pNode, const char *zAttrName, const char *zAttrVal)
     int nArgs;
     HtmlElementNode *pElem;
     HtmlAttributes *pAttr;
+    HtmlNodeAtoms *pAtoms;
+    const char *zAtom;
 
     pElem = HtmlNodeAsElement(pNode);
     if (!pElem) return;
     pAttr = pElem->pAttributes;
 
+    /* Attribute names are atoms, so they may be compared by pointer */
+    zAtom = HtmlAttrAtom(zAttrName, 1);
     for (i = 0; pAttr && i < pAttr->nAttr && i < MAX_NUM_ATTRIBUTES; i++) {
         azPtr[i*2] = pAttr->a[i].zName;
-        if (0 != strcmp(pAttr->a[i].zName, zAttrName)) {
+        if (pAttr->a[i].zName != zAtom) {
             azPtr[i*2+1] = pAttr->a[i].zValue;
         } else {
             azPtr[i*2+1] = zAttrVal;
@@ -804,7 +1100,7 @@ setNodeAttribute (HtmlNode *pNode, const char *zAttrName, const char *zAttrVal)
     }
 
     if (!isDone && i < MAX_NUM_ATTRIBUTES) {
-        azPtr[i*2] = zAttrName;
+        azPtr[i*2] = zAtom;
         azPtr[i*2+1] = zAttrVal;
         i++;
     }
@@ -817,6 +1113,20 @@ setNodeAttribute (HtmlNode *pNode, const char *zAttrName, const char *zAttrVal)
     pElem->pAttributes = HtmlAttributesNew(nArgs, azPtr, aLen, 0);
     HtmlFree(pAttr);
 
+    /* If the class or id attribute was modified, discard the interned 
+     * class and id names. They are rebuilt the next time HtmlNodeGetAtoms()
+     * is called. The old names are passed to the [search] module so that 
+     * it can update its indexes.
+     */
+    pAtoms = pElem->pAtoms;
+    if (!stricmp(zAttrName, "id") || !stricmp(zAttrName, "class")) {
+        pElem->pAtoms = 0;
+    }
+    HtmlCssSearchAttribute(pTree, pNode, zAttrName, pAtoms);
+    if (pAtoms != pElem->pAtoms) {
+        HtmlFree(pAtoms);
+    }
+
     /* If this was a call to set the "style" attribute, discard the
      * compiled version at version HtmlElementNode.pStyle.
      */
@@ -827,11 +1137,11 @@ setNodeAttribute (HtmlNode *pNode, const char *zAttrName, const char *zAttrVal)
 }
 
 static void 
-mergeAttributes (HtmlNode *pNode, HtmlAttributes *pAttr)
+mergeAttributes (HtmlTree *pTree, HtmlNode *pNode, HtmlAttributes *pAttr)
 {
     int ii;
     for (ii = 0; pAttr && ii < pAttr->nAttr; ii++) {
-        setNodeAttribute(pNode, pAttr->a[ii].zName, pAttr->a[ii].zValue);
+        setNodeAttribute(pTree, pNode, pAttr->a[ii].zName, pAttr->a[ii].zValue);
     }
     HtmlFree(pAttr);
 }
@@ -884,7 +1194,8 @@ doParseHandler (HtmlTree *pTree, int eType, HtmlNode *pNode, int iOffset)
             Tcl_ListObjAppendElement(0, pScript, Tcl_NewStringObj("", -1));
         }
         Tcl_ListObjAppendElement(
-            0, pScript, Tcl_NewIntObj(iOffset + pTree->nParsed)
+            0, pScript, 
+            Tcl_NewIntObj(iOffset + pTree->nParsed + pTree->nDiscarded)
         );
 
         rc = Tcl_EvalObjEx(pTree->interp, pScript, TCL_EVAL_GLOBAL);
@@ -933,15 +1244,19 @@ HtmlInitTree (HtmlTree *pTree)
          *      <body>
          */
         HtmlElementNode *pRoot;
+        const char *zHead;
+        const char *zBody;
 
-        pRoot = HtmlNew(HtmlElementNode);
+        pRoot = HtmlElementNew(pTree);
         pRoot->node.eTag = Html_HTML;
         pRoot->node.zTag = HtmlTypeToName(pTree, Html_HTML);
         pTree->pRoot = (HtmlNode *)pRoot;
+        HtmlCssSearchInsert(pTree, pTree->pRoot);
 
-
-        HtmlNodeAddChild(pRoot, Html_HEAD, HtmlTypeToName(pTree, Html_HEAD), 0);
-        HtmlNodeAddChild(pRoot, Html_BODY, HtmlTypeToName(pTree, Html_BODY), 0);
+        zHead = HtmlTypeToName(pTree, Html_HEAD);
+        zBody = HtmlTypeToName(pTree, Html_BODY);
+        HtmlNodeAddChild(pTree, pRoot, Html_HEAD, zHead, 0);
+        HtmlNodeAddChild(pTree, pRoot, Html_BODY, zBody, 0);
         HtmlCallbackRestyle(pTree, (HtmlNode *)pRoot);
     }
 
@@ -994,8 +1309,13 @@ treeCloseFosterTree (HtmlTree *pTree)
 static void 
 treeAddFosterText (HtmlTree *pTree, HtmlTextNode *pTextNode)
 {
+    /* Foster-parented nodes are inserted before the <table>, not at the 
+     * end of the document, so the HtmlNode.iNode values assigned in
+     * parse order are no longer in tree order.
+     */
+    pTree->isSequenceOk = 0;
     if (pTree->state.pFoster) {
-        HtmlNodeAddTextChild(pTree->state.pFoster, pTextNode);
+        HtmlNodeAddTextChild(pTree, pTree->state.pFoster, pTextNode);
     } else {
         HtmlNode *pFosterParent;
         HtmlNode *pBefore = 0;
@@ -1024,6 +1344,9 @@ treeAddFosterElement (
     /* Find the parent of the <TABLE> element (the foster-parent) */
     pFosterParent = findFosterParent(pTree, &pBefore);
 
+    /* See the comment in treeAddFosterText() */
+    pTree->isSequenceOk = 0;
+
     if (pFoster) {
         int nClose;
         int ii;
@@ -1039,10 +1362,11 @@ treeAddFosterElement (
     }
 
     if (pFoster) {
-        int n = HtmlNodeAddChild((HtmlElementNode *)pFoster, eTag, zTag, pAttr);
+        HtmlElementNode *pFosterElem = (HtmlElementNode *)pFoster;
+        int n = HtmlNodeAddChild(pTree, pFosterElem, eTag, zTag, pAttr);
         pNew = HtmlNodeChild(pFoster, n);
     } else {
-        pNew = (HtmlNode *)HtmlNew(HtmlElementNode);
+        pNew = (HtmlNode *)HtmlElementNew(pTree);
         ((HtmlElementNode *)pNew)->pAttributes = pAttr;
         pNew->eTag = eTag;
         if (!zTag) {
@@ -1135,7 +1459,8 @@ treeAddTableComponent (HtmlTree *pTree, int eTag, HtmlAttributes *pAttr)
         eParentTag == Html_TABLE && 
         (eTag == Html_TR || eTag == Html_TD || eTag == Html_TH)
     ) {
-        int n2 = HtmlNodeAddChild((HtmlElementNode *)pParent, Html_TBODY, 0, 0);
+        HtmlElementNode *pP = (HtmlElementNode *)pParent;
+        int n2 = HtmlNodeAddChild(pTree, pP, Html_TBODY, 0, 0);
         pParent = HtmlNodeChild(pParent, n2);
         pParent->iNode = pTree->iNextNode++;
         eParentTag = Html_TBODY;
@@ -1143,14 +1468,15 @@ treeAddTableComponent (HtmlTree *pTree, int eTag, HtmlAttributes *pAttr)
 
     /* See if we need to add an implicit <TR> node */
     if (eParentTag != Html_TR && (eTag == Html_TD || eTag == Html_TH)) {
-        int n2 = HtmlNodeAddChild((HtmlElementNode *)pParent, Html_TR, 0, 0);
+        HtmlElementNode *pP = (HtmlElementNode *)pParent;
+        int n2 = HtmlNodeAddChild(pTree, pP, Html_TR, 0, 0);
         pParent = HtmlNodeChild(pParent, n2);
         pParent->iNode = pTree->iNextNode++;
         eParentTag = Html_TR;
     }
     
     /* Add the new node to pParent */
-    n = HtmlNodeAddChild((HtmlElementNode *)pParent, eTag, 0, pAttr);
+    n = HtmlNodeAddChild(pTree, (HtmlElementNode *)pParent, eTag, 0, pAttr);
     pNew = HtmlNodeChild(pParent, n);
     pNew->iNode = pTree->iNextNode++;
     pTree->state.pCurrent = pNew;
@@ -1219,17 +1545,17 @@ HtmlTreeAddElement (HtmlTree *pTree, int eType, const char *zType, HtmlAttribute
     switch (eType) {
         case Html_HTML:
             pParsed = pTree->pRoot;
-            mergeAttributes(pParsed, pAttr);
+            mergeAttributes(pTree, pParsed, pAttr);
             HtmlCallbackRestyle(pTree, pParsed);
             break;
         case Html_HEAD:
             pParsed = pHeadNode;
-            mergeAttributes(pParsed, pAttr);
+            mergeAttributes(pTree, pParsed, pAttr);
             HtmlCallbackRestyle(pTree, pParsed);
             break;
         case Html_BODY:
             pParsed = pBodyNode;
-            mergeAttributes(pParsed, pAttr);
+            mergeAttributes(pTree, pParsed, pAttr);
             HtmlCallbackRestyle(pTree, pParsed);
             break;
 
@@ -1242,7 +1568,7 @@ HtmlTreeAddElement (HtmlTree *pTree, int eType, const char *zType, HtmlAttribute
          * section.
          */
         case Html_TITLE: {
-            int n = HtmlNodeAddChild(pHeadElem, eType, 0, pAttr);
+            int n = HtmlNodeAddChild(pTree, pHeadElem, eType, 0, pAttr);
             HtmlNode *p = HtmlNodeChild(pHeadNode, n);
             pTree->state.isCdataInHead = 1;
             p->iNode = pTree->iNextNode++;
@@ -1255,7 +1581,7 @@ HtmlTreeAddElement (HtmlTree *pTree, int eType, const char *zType, HtmlAttribute
         case Html_META:
         case Html_LINK:
         case Html_BASE: {
-            int n = HtmlNodeAddChild(pHeadElem, eType, 0, pAttr);
+            int n = HtmlNodeAddChild(pTree, pHeadElem, eType, 0, pAttr);
             HtmlNode *p = HtmlNodeChild(pHeadNode, n);
             p->iNode = pTree->iNextNode++;
             nodeHandlerCallbacks(pTree, p);
@@ -1305,7 +1631,7 @@ HtmlTreeAddElement (HtmlTree *pTree, int eType, const char *zType, HtmlAttribute
 
                 pC = HtmlNodeAsElement(pCurrent);
                 assert(!HtmlNodeIsText(pTree->state.pCurrent));
-                N = HtmlNodeAddChild(pC, eType, zType, pAttr);
+                N = HtmlNodeAddChild(pTree, pC, eType, zType, pAttr);
                 pCurrent = HtmlNodeChild(pCurrent, N);
                 pCurrent->iNode = pTree->iNextNode++;
                 pParsed = pCurrent;
@@ -1358,7 +1684,7 @@ HtmlTreeAddText (HtmlTree *pTree, HtmlTextNode *pTextNode, int iOffset)
         int nChild = HtmlNodeNumChildren(pHeadNode) - 1;
         HtmlNode *pTitle = HtmlNodeChild(pHeadNode, nChild);
 
-        HtmlNodeAddTextChild(pTitle, pTextNode);
+        HtmlNodeAddTextChild(pTree, pTitle, pTextNode);
         pTextNode->node.iNode = pTree->iNextNode++;
         pTree->state.isCdataInHead = 0;
         nodeHandlerCallbacks(pTree, pTitle);
@@ -1371,7 +1697,7 @@ HtmlTreeAddText (HtmlTree *pTree, HtmlTextNode *pTextNode, int iOffset)
         pTextNode->node.iNode = pTree->iNextNode++;
         pTextNode->node.eTag = Html_Text;
     } else {
-        HtmlNodeAddTextChild(pCurrent, pTextNode);
+        HtmlNodeAddTextChild(pTree, pCurrent, pTextNode);
         pTextNode->node.iNode = pTree->iNextNode++;
     }
 
@@ -1740,6 +2066,130 @@ char CONST *HtmlNodeAttr(
     return 0;
 }
 
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlAtom --
+ * HtmlAtomFind --
+ *
+ *     Return the atom for string zString (compared case-insensitively). 
+ *     Atoms may be compared by pointer.
+ *
+ *     If the atom is in the HtmlSharedData.aAtom table, that copy is
+ *     returned. Otherwise the atom is taken from (or, for HtmlAtom() 
+ *     only, created in) the HtmlTree.aAtom table of the widget. While
+ *     the shared default stylesheet is being parsed (HtmlTree.isSharedAtom
+ *     is true), HtmlAtom() creates atoms in the shared table instead.
+ *
+ * Results:
+ *     Atom string, valid for the lifetime of the widget. HtmlAtomFind()
+ *     returns NULL if there is no such atom.
+ *
+ * Side effects:
+ *     HtmlAtom() may add an entry to HtmlTree.aAtom or 
+ *     HtmlSharedData.aAtom.
+ *
+ *---------------------------------------------------------------------------
+ */
+const char *
+HtmlAtom (HtmlTree *pTree, const char *zString)
+{
+    Tcl_HashTable *pTable = &pTree->pShared->aAtom;
+    Tcl_HashEntry *pEntry;
+    int dummy;
+
+    if (!pTree->isSharedAtom) {
+        pEntry = Tcl_FindHashEntry(pTable, zString);
+        if (pEntry) {
+            return (const char *)Tcl_GetHashKey(pTable, pEntry);
+        }
+        pTable = &pTree->aAtom;
+    }
+    pEntry = Tcl_CreateHashEntry(pTable, zString, &dummy);
+    return (const char *)Tcl_GetHashKey(pTable, pEntry);
+}
+const char *
+HtmlAtomFind (HtmlTree *pTree, const char *zString)
+{
+    Tcl_HashTable *pTable = &pTree->pShared->aAtom;
+    Tcl_HashEntry *pEntry = Tcl_FindHashEntry(pTable, zString);
+    if (!pEntry) {
+        pTable = &pTree->aAtom;
+        pEntry = Tcl_FindHashEntry(pTable, zString);
+    }
+    return (pEntry ? (const char *)Tcl_GetHashKey(pTable, pEntry) : 0);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * HtmlNodeGetAtoms --
+ *
+ *     Return the interned "id" and "class" names of element node pNode
+ *     (see the HtmlNodeAtoms structure). The structure is built the first
+ *     time this is called for a node and cached until the node attributes
+ *     are modified by setNodeAttribute().
+ *
+ * Results:
+ *     Pointer to the HtmlNodeAtoms structure, or NULL for a text node.
+ *
+ * Side effects:
+ *     May add atoms (see HtmlAtom()).
+ *
+ *---------------------------------------------------------------------------
+ */
+HtmlNodeAtoms *
+HtmlNodeGetAtoms (HtmlTree *pTree, HtmlNode *pNode)
+{
+    HtmlElementNode *pElem = HtmlNodeAsElement(pNode);
+    HtmlNodeAtoms *pAtoms;
+    const char *zId;
+    const char *zClass;
+
+    if (!pElem) return 0;
+    if (pElem->pAtoms) return pElem->pAtoms;
+
+    zId = HtmlNodeAttr(pNode, "id");
+    zClass = HtmlNodeAttr(pNode, "class");
+
+    if (zClass) {
+        /* Class names are separated by white-space, so there may be at
+         * most (strlen(zClass)/2)+1 of them. 
+         */
+        const char *z = zClass;
+        int nAlloc = (strlen(zClass) / 2) + 1;
+        int n;
+        Tcl_DString str;
+
+        pAtoms = (HtmlNodeAtoms *)HtmlClearAlloc("HtmlNodeAtoms", 
+            sizeof(HtmlNodeAtoms) + nAlloc * sizeof(const char *)
+        );
+        pAtoms->azClass = (const char **)&pAtoms[1];
+
+        Tcl_DStringInit(&str);
+        while (
+            pAtoms->nClass < nAlloc &&
+            (z = HtmlCssGetNextListItem(z, strlen(z), &n))
+        ) {
+            Tcl_DStringSetLength(&str, 0);
+            Tcl_DStringAppend(&str, z, n);
+            pAtoms->azClass[pAtoms->nClass++] = 
+                HtmlAtom(pTree, Tcl_DStringValue(&str));
+            z += n;
+        }
+        Tcl_DStringFree(&str);
+    } else {
+        pAtoms = HtmlNew(HtmlNodeAtoms);
+    }
+
+    if (zId) {
+        pAtoms->zId = HtmlAtom(pTree, zId);
+    }
+
+    pElem->pAtoms = pAtoms;
+    return pAtoms;
+}
+
 static int 
 markWindowAsClipped(
     HtmlTree *pTree,
@@ -1900,6 +2350,9 @@ nodeRemoveCmd(
             int e;
             Tcl_Obj *pObj = apNode[jj];
             HtmlNode *pChild = HtmlNodeGetPointer(pTree, Tcl_GetString(pObj));
+            if (pChild && HtmlNodeParent(pChild) == pNode) {
+                HtmlCssSearchRemove(pTree, pChild);
+            }
             e = nodeRemoveChild((HtmlElementNode *)pNode, pChild);
             if (e) {
                 nodeOrphanize(pTree, pChild);
@@ -2047,6 +2500,95 @@ nodeInsertCmd(
     return TCL_OK;
 }
 
+static Tcl_Obj *fragmentParse(HtmlTree *, const char *, HtmlElementNode *);
+
+/*
+ * HtmlWalkTree() callback used by nodeReplaceHtml(). Abandon the walk
+ * if any node in the sub-tree has a Tcl command.
+ */
+static int
+hasCommandCb (HtmlTree *pTree, HtmlNode *pNode, ClientData clientData)
+{
+    return (pNode->pNodeCmd ? HTML_WALK_ABANDON : HTML_WALK_DESCEND);
+}
+
+/*
+ *---------------------------------------------------------------------------
+ *
+ * nodeReplaceHtml --
+ *
+ *         $node replace -html HTML-TEXT
+ *
+ *     Replace all children of element pElem with the nodes created by
+ *     parsing HTML-TEXT as a document fragment (the same way as the
+ *     [$html fragment] command). This is equivalent to removing each
+ *     child, calling [fragment] and then inserting the new nodes, but
+ *     the style and layout of pElem are invalidated once only, and the
+ *     new nodes are linked into the tree directly instead of being
+ *     passed through the orphan table and node commands.
+ *
+ *     Old child sub-trees are deleted outright unless a node command
+ *     exists for at least one of their nodes. In that case the script
+ *     may still hold a reference, so the sub-tree is made an orphan, as
+ *     for [$node remove].
+ *
+ * Results:
+ *     Standard Tcl result.
+ *
+ * Side effects:
+ *     Modifies the document tree. Node-handler scripts may be invoked.
+ *
+ *---------------------------------------------------------------------------
+ */
+static int
+nodeReplaceHtml (HtmlTree *pTree, HtmlElementNode *pElem, Tcl_Obj *pHtml)
+{
+    HtmlNode *pNode = (HtmlNode *)pElem;
+    Tcl_Obj *pList;
+    int ii;
+
+    /* The children of pNode may not be replaced if the document parser
+     * is still adding nodes to one of them, or from within a node-handler
+     * invoked while parsing a fragment.
+     */
+    for (ii = 0; ii < 2; ii++) {
+        HtmlNode *p = (ii ? pTree->state.pFoster : pTree->state.pCurrent);
+        p = (p ? HtmlNodeParent(p) : 0);
+        for ( ; p && p != pNode; p = HtmlNodeParent(p));
+        if (p) break;
+    }
+    if (ii < 2 || pTree->pFragment) {
+        Tcl_SetResult(pTree->interp, 
+            "cannot [replace -html] while children are being parsed", 
+            TCL_STATIC
+        );
+        return TCL_ERROR;
+    }
+
+    HtmlCallbackRestyle(pTree, pNode);
+    HtmlCallbackLayout(pTree, pNode);
+
+    for (ii = 0; ii < pElem->nChild; ii++) {
+        HtmlNode *pChild = pElem->apChildren[ii];
+        if (HtmlWalkTree(pTree, pChild, hasCommandCb, 0)) {
+            HtmlCssSearchRemove(pTree, pChild);
+            nodeOrphanize(pTree, pChild);
+            HtmlNodeClearRecursive(pTree, pChild);
+        } else {
+            freeNode(pTree, pChild);
+        }
+    }
+    pElem->nChild = 0;
+
+    pList = fragmentParse(pTree, Tcl_GetString(pHtml), pElem);
+    Tcl_IncrRefCount(pList);
+    Tcl_DecrRefCount(pList);
+
+    pTree->isSequenceOk = 0;
+    HtmlCheckRestylePoint(pTree);
+    return TCL_OK;
+}
+
 static CssPropertySet *
 nodeGetStyle (HtmlTree *pTree, HtmlNode *p)
 {
@@ -2361,7 +2903,7 @@ nodeCommand(
                 if (rc != TCL_OK) {
                     return rc;
                 }
-                setNodeAttribute(pNode, zAttrName, zAttrVal);
+                setNodeAttribute(pTree, pNode, zAttrName, zAttrVal);
                 HtmlCallbackRestyle(pTree, pNode);
             }
 
@@ -2550,6 +3092,11 @@ node_attr_usage:
          *         -configurecmd       <script>
          *         -deletecmd          <script>
          *         -stylecmd           <script>
+         *
+         * nodeHandle replace -html HTML-TEXT
+         *
+         *     Replace the children of the node with the result of
+         *     parsing HTML-TEXT. See nodeReplaceHtml() for details.
          */
         case NODE_REPLACE: {
 
@@ -2560,6 +3107,10 @@ node_attr_usage:
                 return TCL_ERROR;
             }
 
+            if (objc == 4 && 0 == strcmp(Tcl_GetString(objv[2]), "-html")) {
+                return nodeReplaceHtml(pTree, pElem, objv[3]);
+            }
+
             if (objc > 2) {
                 Tcl_Obj *aArgs[4];
                 HtmlNodeReplacement *pReplace = 0; /* New pNode->pReplacement */
@@ -2689,6 +3240,7 @@ node_attr_usage:
             } else {
                 pElem->flags &= ~(mask?mask:0xFF);
             }
+            HtmlCssSearchDynamic(pTree);
 
             if (zArg2) {
                 if (
@@ -2697,7 +3249,7 @@ node_attr_usage:
                 ) {
                     HtmlCallbackRestyle(pTree, pNode);
                 } else {
-                    HtmlCallbackDynamic(pTree, pNode);
+                    HtmlCallbackDynamic(pTree, pNode, mask);
                 }
             }
 
@@ -2947,15 +3499,29 @@ HtmlTreeClear (HtmlTree *pTree)
     Tcl_DeleteHashTable(&pTree->aOrphan);
     Tcl_InitHashTable(&pTree->aOrphan, TCL_ONE_WORD_KEYS);
 
+    /* All element nodes have now been freed. Release the arena blocks. */
+    arenaClear(&pTree->arena);
+
     /* Free the formatted text, if any (HtmlTree.pText) */
     HtmlTextInvalidate(pTree);
 
-    /* Free the plain text representation */
-    if (pTree->pDocument) {
-        Tcl_DecrRefCount(pTree->pDocument);
-    }
+    /* Stop any background tokenizer job, then free the plain text 
+     * representation.
+     */
+    HtmlTokenizerCancel(pTree);
+    HtmlTokenizerRelease(pTree);
     pTree->nParsed = 0;
-    pTree->pDocument = 0;
+    pTree->nDiscarded = 0;
+    pTree->iDocument++;
+
+    /* Forget the URIs reported to the -preloadcmd script */
+    pTree->nPreloaded = 0;
+    pTree->iPreloadResume = 0;
+    if (pTree->pPreload) {
+        Tcl_DeleteHashTable(pTree->pPreload);
+        HtmlFree(pTree->pPreload);
+        pTree->pPreload = 0;
+    }
 
     /* Free the stylesheets */
     HtmlCssStyleSheetFree(pTree->pStyle);
@@ -2966,8 +3532,10 @@ HtmlTreeClear (HtmlTree *pTree)
     pTree->iScrollY = 0;
 
     /* Deschedule any dynamic, style or layout callback. */
-    pTree->cb.pDynamic = 0;
-    pTree->cb.pRestyle = 0;
+    Tcl_DeleteHashTable(&pTree->cb.aDynamic);
+    Tcl_InitHashTable(&pTree->cb.aDynamic, TCL_ONE_WORD_KEYS);
+    Tcl_DeleteHashTable(&pTree->cb.aRestyle);
+    Tcl_InitHashTable(&pTree->cb.aRestyle, TCL_ONE_WORD_KEYS);
     pTree->cb.flags &= ~(HTML_DYNAMIC|HTML_RESTYLE|HTML_LAYOUT);
 
     pTree->iNextNode = 0;
@@ -3017,7 +3585,26 @@ fragmentOrphan (HtmlTree *pTree)
     HtmlFragmentContext *pFragment = pTree->pFragment;
     HtmlNode *pOrphan = pFragment->pRoot;
 
-    if (pOrphan) {
+    if (pOrphan && pFragment->pTarget) {
+        /* Parsing for [$node replace -html]. Append the completed sub-tree
+         * directly to the target node. No node command is created, and
+         * the caller has already invalidated the style and layout of
+         * the target, so there is no per-node bookkeeping to do.
+         */
+        HtmlElementNode *pTarget = pFragment->pTarget;
+        nodeGrowChildArray(pTree, pTarget, pTarget->nChild + 1);
+        pTarget->apChildren[pTarget->nChild++] = pOrphan;
+        pOrphan->pParent = (HtmlNode *)pTarget;
+        pOrphan->iNode = 0;
+        pFragment->pRoot = 0;
+        pFragment->pCurrent = 0;
+
+        /* Node handlers may run [search] before the caller is finished,
+         * so mark the node sequence as invalid here, not in the caller.
+         */
+        pTree->isSequenceOk = 0;
+        HtmlCssSearchInsert(pTree, pOrphan);
+    } else if (pOrphan) {
         Tcl_Obj *pCmd = HtmlNodeCommand(pTree, pOrphan);
         Tcl_ListObjAppendElement(0, pFragment->pNodeList, pCmd);
         nodeOrphanize(pTree, pOrphan);
@@ -3087,7 +3674,7 @@ fragmentAddElement (
         fragmentOrphan(pTree);
     }
 
-    pElem = HtmlNew(HtmlElementNode);
+    pElem = HtmlElementNew(pTree);
     pElem->pAttributes = pAttributes;
     pElem->node.eTag = eType;
     if (!zType) {
@@ -3130,8 +3717,27 @@ fragmentAddClosingTag (HtmlTree *pTree, int eType, const char *zType, int iOffse
     }
 }
 
-void 
-HtmlParseFragment (HtmlTree *pTree, const char *zHtml)
+/*
+ *---------------------------------------------------------------------------
+ *
+ * fragmentParse --
+ *
+ *     Parse the document fragment zHtml. If pTarget is NULL, each
+ *     top-level node of the fragment becomes an orphan and a list of
+ *     the node commands is returned. Otherwise the top-level nodes are
+ *     appended to the children of pTarget as they are completed.
+ *
+ * Results:
+ *     A list of node commands (empty if pTarget is not NULL). The
+ *     returned object has a ref-count of zero.
+ *
+ * Side effects:
+ *     Creates new nodes. Node-handler scripts may be invoked.
+ *
+ *---------------------------------------------------------------------------
+ */
+static Tcl_Obj *
+fragmentParse (HtmlTree *pTree, const char *zHtml, HtmlElementNode *pTarget)
 {
     HtmlFragmentContext sContext;
 
@@ -3139,6 +3745,7 @@ HtmlParseFragment (HtmlTree *pTree, const char *zHtml)
     sContext.pRoot = 0;
     sContext.pCurrent = 0;
     sContext.pNodeList = Tcl_NewObj();
+    sContext.pTarget = pTarget;
 
     pTree->pFragment = &sContext;
     HtmlTokenize(pTree, zHtml, 1,
@@ -3153,7 +3760,13 @@ HtmlParseFragment (HtmlTree *pTree, const char *zHtml)
 
     fragmentOrphan(pTree);
     pTree->pFragment = 0;
-    Tcl_SetObjResult(pTree->interp, sContext.pNodeList);
+    return sContext.pNodeList;
+}
+
+void 
+HtmlParseFragment (HtmlTree *pTree, const char *zHtml)
+{
+    Tcl_SetObjResult(pTree->interp, fragmentParse(pTree, zHtml, 0));
 }
 
 /*
@@ -26,6 +26,137 @@ proc VersionsToDefine {glob define} {
   return $ret
 }
 
+# CssToParseOps --
+#
+#     Translate the text of a stylesheet into the elements of a C array 
+#     initializer for an array of CssParseOp structures (see cssInt.h). 
+#     The terminating element is not included, so that the elements for
+#     two stylesheets may be concatenated. Each element of the
+#     array is a call to one of the parser callbacks in css.c, in the order
+#     that HtmlCssRunParser() would make them when parsing the same text.
+#     If the library is built with TKHTML_COMPILED_DEFAULTSTYLE defined,
+#     the default stylesheet is loaded by replaying the array instead of 
+#     parsing the text.
+#
+#     Only the subset of CSS used by the default stylesheets is supported
+#     (no at-rules, no comments within declaration values). An error is 
+#     thrown if anything else is encountered, so that the build fails 
+#     instead of producing a stylesheet that differs from the text.
+#
+proc CssToParseOps {file define} {
+  set fd [open $file]
+  set css [read $fd]
+  close $fd
+
+  regsub -all {/\*.*?\*/} $css " " css
+  if {[string first @ $css] >= 0} {
+    error "$file: at-rules are not supported by CssToParseOps"
+  }
+
+  # Each element of $ops is a list of four elements - the operation, the
+  # integer argument and the two string arguments (an empty string is 
+  # used for a NULL string argument).
+  set ops [list]
+  set ident {-?[_a-zA-Z][-_a-zA-Z0-9]*}
+  array set pseudo {
+    first-child  CSS_PSEUDOCLASS_FIRSTCHILD
+    last-child   CSS_PSEUDOCLASS_LASTCHILD
+    link         CSS_PSEUDOCLASS_LINK
+    visited      CSS_PSEUDOCLASS_VISITED
+    active       CSS_PSEUDOCLASS_ACTIVE
+    hover        CSS_PSEUDOCLASS_HOVER
+    focus        CSS_PSEUDOCLASS_FOCUS
+    after        CSS_PSEUDOELEMENT_AFTER
+    before       CSS_PSEUDOELEMENT_BEFORE
+    first-line   CSS_PSEUDOELEMENT_FIRSTLINE
+    first-letter CSS_PSEUDOELEMENT_FIRSTLETTER
+  }
+  array set attrop {
+    =  CSS_SELECTOR_ATTRVALUE
+    ~= CSS_SELECTOR_ATTRLISTVALUE
+    |= CSS_SELECTOR_ATTRHYPHEN
+  }
+
+  while {[string trim $css] ne ""} {
+    set iOpen [string first "\{" $css]
+    set iClose [string first "\}" $css]
+    if {$iOpen < 0 || $iClose < $iOpen} {
+      error "$file: cannot parse \"[string range [string trim $css] 0 40]\""
+    }
+    set sel  [string trim [string range $css 0 [expr {$iOpen-1}]]]
+    set body [string range $css [expr {$iOpen+1}] [expr {$iClose-1}]]
+    set css  [string range $css [expr {$iClose+1}] end]
+
+    # Selectors. Each iteration of this loop consumes one token.
+    while {$sel ne ""} {
+      if {[regexp {^\s+(.?)} $sel -> next]} {
+        if {[string first $next "+>,"] < 0} {
+          lappend ops [list SELECTOR CSS_SELECTORCHAIN_DESCENDANT {} {}]
+        }
+        regexp {^\s+(.*)$} $sel -> sel
+      } elseif {[regexp {^([>+,])\s*(.*)$} $sel -> c sel]} {
+        switch -- $c {
+          > { lappend ops [list SELECTOR CSS_SELECTORCHAIN_CHILD {} {}] }
+          + { lappend ops [list SELECTOR CSS_SELECTORCHAIN_ADJACENT {} {}] }
+          , { lappend ops [list COMMA 0 {} {}] }
+        }
+      } elseif {[regexp {^\*(.*)$} $sel -> sel]} {
+        lappend ops [list SELECTOR CSS_SELECTOR_UNIVERSAL {} {}]
+      } elseif {[regexp "^($ident)(.*)\$" $sel -> z sel]} {
+        lappend ops [list SELECTOR CSS_SELECTOR_TYPE {} $z]
+      } elseif {[regexp "^\\.($ident)(.*)\$" $sel -> z sel]} {
+        lappend ops [list SELECTOR CSS_SELECTOR_CLASS {} $z]
+      } elseif {[regexp "^#($ident)(.*)\$" $sel -> z sel]} {
+        lappend ops [list SELECTOR CSS_SELECTOR_ID {} $z]
+      } elseif {[regexp "^::?($ident)(.*)\$" $sel -> z sel]} {
+        if {![info exists pseudo($z)]} {
+          error "$file: unsupported pseudo-class or element :$z"
+        }
+        lappend ops [list SELECTOR $pseudo($z) {} {}]
+      } elseif {[regexp "^\\\[\\s*($ident)\\s*\\\](.*)\$" $sel -> a sel]} {
+        lappend ops [list SELECTOR CSS_SELECTOR_ATTR $a {}]
+      } elseif {[regexp [join [list \
+          "^\\\[\\s*($ident)\\s*(=|~=|\\|=)\\s*" \
+          "(\"\[^\"\]*\"|'\[^'\]*'|$ident)\\s*\\\](.*)\$" ] ""
+        ] $sel -> a op v sel]} {
+        lappend ops [list SELECTOR $attrop($op) $a $v]
+      } else {
+        error "$file: cannot parse selector \"$sel\""
+      }
+    }
+
+    # Declarations. 
+    foreach decl [split $body ";"] {
+      if {[string trim $decl] eq ""} continue
+      if {![regexp "^\\s*($ident)\\s*:\\s*(.*\\S)\\s*\$" $decl -> p v]} {
+        error "$file: cannot parse declaration \"$decl\""
+      }
+      set isImportant 0
+      if {[regexp -nocase {^(.*\S)\s*!\s*important$} $v -> v]} {
+        set isImportant 1
+      }
+      lappend ops [list DECLARATION $isImportant $p $v]
+    }
+    lappend ops [list RULE 1 {} {}]
+  }
+
+  set ret "#define $define"
+  foreach op $ops {
+    foreach {eOp iArg z1 z2} $op {}
+    set args [list CSS_PARSEOP_$eOp $iArg]
+    foreach z [list $z1 $z2] {
+      if {$z eq ""} {
+        lappend args 0
+      } else {
+        lappend args "\"[string map [list \" \\\" \\ \\\\ \n \\n] $z]\""
+      }
+    }
+    append ret " \\\n    \{[join $args {, }]\},"
+  }
+  append ret "\n\n"
+  return $ret
+}
+
 set css_file    [file join [file dirname [info script]] .. src html.css]
 set tcl_file    [file join [file dirname [info script]] .. src tkhtml.tcl]
 set quirks_file [file join [file dirname [info script]] .. src quirks.css]
@@ -35,5 +166,7 @@ puts ""
 puts [FileToDefine $tcl_file      HTML_DEFAULT_TCL]
 puts [FileToDefine $css_file      HTML_DEFAULT_CSS]
 puts [FileToDefine $quirks_file   HTML_DEFAULT_QUIRKS]
+puts [CssToParseOps $css_file     HTML_DEFAULT_CSS_OPS]
+puts [CssToParseOps $quirks_file  HTML_DEFAULT_QUIRKS_OPS]
 puts [VersionsToDefine $src_files HTML_SOURCE_FILES]
 
@@ -0,0 +1,119 @@
+#
+# mkentities.tcl --
+#
+#     Usage: tclsh mkentities.tcl ?entities.txt? > htmlentities.c
+#
+#     Generate the C source for the table of named character references
+#     (i.e. "&amp;") used by HtmlTranslateEscapes() in htmltext.c. The
+#     input is the file entities.txt (see the format description at the
+#     top of that file). The generated code contains the table itself,
+#     sorted into slot order for the minimal perfect hash built by
+#     [PerfectHash] (see mkhash.tcl), and the per-bucket seeds for the
+#     hash.
+#
+#     The generated file is #included by htmltext.c, which must declare
+#     struct HtmlEntity first.
+#
+
+set dir [file dirname [info script]]
+source [file join $dir mkhash.tcl]
+
+set infile [file join $dir entities.txt]
+if {$argc > 0} { set infile [lindex $argv 0] }
+
+# Utf8Literal CODEPOINTS
+#
+#     Return a C string literal containing the UTF-8 encoding of the
+#     list of Unicode code-points CODEPOINTS (hexadecimal integers).
+#     Every byte is written as a hex escape, so that there is no
+#     ambiguity about where an escape sequence ends.
+#
+proc Utf8Literal {codepoints} {
+  set bytes [list]
+  foreach cp $codepoints {
+    set c [expr {"0x$cp"}]
+    if {$c < 0x80} {
+      lappend bytes $c
+    } elseif {$c < 0x800} {
+      lappend bytes [expr {0xC0 | ($c >> 6)}]
+      lappend bytes [expr {0x80 | ($c & 0x3F)}]
+    } elseif {$c < 0x10000} {
+      lappend bytes [expr {0xE0 | ($c >> 12)}]
+      lappend bytes [expr {0x80 | (($c >> 6) & 0x3F)}]
+      lappend bytes [expr {0x80 | ($c & 0x3F)}]
+    } else {
+      lappend bytes [expr {0xF0 | ($c >> 18)}]
+      lappend bytes [expr {0x80 | (($c >> 12) & 0x3F)}]
+      lappend bytes [expr {0x80 | (($c >> 6) & 0x3F)}]
+      lappend bytes [expr {0x80 | ($c & 0x3F)}]
+    }
+  }
+  set ret "\""
+  foreach b $bytes { append ret [format "\\x%02X" $b] }
+  append ret "\""
+  return $ret
+}
+
+# Read the input file. Array aValue maps from entity name to the list
+# of code-points. Array aLegacy is set for each entity with the -legacy
+# flag.
+set names [list]
+set fd [open $infile]
+while {[gets $fd line] >= 0} {
+  set line [string trim $line]
+  if {$line == "" || [string index $line 0] == "#"} continue
+  set name [lindex $line 0]
+  if {[info exists aValue($name)]} {
+    error "$infile: duplicate entity \"$name\""
+  }
+  lappend names $name
+  set aValue($name) [list]
+  foreach field [lrange $line 1 end] {
+    if {$field == "-legacy"} {
+      set aLegacy($name) 1
+    } else {
+      lappend aValue($name) $field
+    }
+  }
+}
+close $fd
+
+# The longest name that may be used without a trailing ';'.
+set nMaxLegacy 0
+foreach name [array names aLegacy] {
+  if {[string length $name] > $nMaxLegacy} {
+    set nMaxLegacy [string length $name]
+  }
+}
+
+foreach {seeds slots} [PerfectHash $names 0] break
+
+puts {
+/*
+ * DO NOT EDIT!
+ *
+ * The code in this file was automatically generated. See the files
+ * src/entities.txt and src/mkentities.tcl from the tkhtml source
+ * distribution.
+ */
+}
+puts "#define HTML_ENTITY_COUNT [llength $names]"
+puts "#define HTML_ENTITY_BUCKETS [llength $seeds]"
+puts "#define HTML_ENTITY_MAXLEGACY $nMaxLegacy"
+puts ""
+
+puts "static const struct HtmlEntity aHtmlEntity\[HTML_ENTITY_COUNT\] = {"
+foreach k $slots {
+  set name [lindex $names $k]
+  set value [Utf8Literal $aValue($name)]
+  set nValue [expr {([string length $value] - 2) / 4}]  ;# Bytes in value
+  set isLegacy [info exists aLegacy($name)]
+  puts [format "  {%-34s %2d, %-26s %d, %d}," \
+      "\"$name\"," [string length $name] $value, $nValue $isLegacy
+  ]
+}
+puts "};"
+puts ""
+puts -nonewline [IntArray \
+    "static const unsigned short" aHtmlEntitySeed $seeds
+]
@@ -0,0 +1,116 @@
+#
+# mkhash.tcl --
+#
+#     This file is sourced by the scripts that generate C code for
+#     tables of fixed strings (tokenlist.txt and mkentities.tcl). It
+#     contains procs to construct a minimal perfect hash function for a
+#     set of keys, so that the generated tables may be searched at
+#     runtime without building a hash table first.
+#
+#     The hash used is a two-level "hash and displace" scheme. Each key
+#     is first hashed with a seed of 0 to select one of $nBucket buckets.
+#     Each bucket has a seed value stored in a generated array. The key
+#     is hashed a second time using the seed for its bucket, and the
+#     result modulo the number of keys is the slot that the key occupies
+#     in the generated table. The C equivalent of [HashString] is
+#     HtmlHashString() in htmltagdb.c. The two must be kept in sync.
+#
+#     Lookup therefore costs two passes over the key, two table reads
+#     and a single string comparison to confirm the match.
+#
+
+# HashString STRING SEED ISFOLD
+#
+#     Return the 32-bit FNV-1a hash of STRING, starting from an offset
+#     basis XORed with SEED. If ISFOLD is true, ASCII upper-case
+#     characters are folded to lower-case before they are hashed.
+#
+proc HashString {z seed isFold} {
+  set h [expr {($seed ^ 2166136261) & 0xFFFFFFFF}]
+  foreach c [split $z ""] {
+    scan $c %c v
+    if {$isFold && $v >= 65 && $v <= 90} {incr v 32}
+    set h [expr {(($h ^ $v) * 16777619) & 0xFFFFFFFF}]
+  }
+  return $h
+}
+
+# PerfectHash KEYS ISFOLD
+#
+#     Construct a minimal perfect hash for the list of unique strings
+#     KEYS. The return value is a list of two elements:
+#
+#         * A list of seeds, one for each bucket (the number of buckets
+#           is the length of this list).
+#         * A list the same length as KEYS. Element i is the index in
+#           KEYS of the key that occupies slot i of the table.
+#
+#     An error is thrown if no suitable seed can be found for a bucket
+#     (seeds must fit in an unsigned 16-bit integer).
+#
+proc PerfectHash {keys isFold} {
+  set nKey [llength $keys]
+  set nBucket [expr {($nKey + 1) / 2}]
+
+  # Assign each key to a bucket.
+  for {set i 0} {$i < $nBucket} {incr i} { set aBucket($i) [list] }
+  set i 0
+  foreach key $keys {
+    set b [expr {[HashString $key 0 $isFold] % $nBucket}]
+    lappend aBucket($b) $i
+    incr i
+  }
+
+  # Place the buckets with the most keys first, while the table is
+  # mostly empty.
+  set order [list]
+  for {set i 0} {$i < $nBucket} {incr i} {
+    lappend order [list $i [llength $aBucket($i)]]
+  }
+  set order [lsort -integer -decreasing -index 1 $order]
+
+  for {set i 0} {$i < $nKey} {incr i} { set aSlot($i) -1 }
+  for {set i 0} {$i < $nBucket} {incr i} { set aSeed($i) 0 }
+
+  foreach o $order {
+    set b [lindex $o 0]
+    if {[llength $aBucket($b)] == 0} break
+    for {set seed 1} {$seed < 65536} {incr seed} {
+      set slots [list]
+      foreach k $aBucket($b) {
+        set s [expr {[HashString [lindex $keys $k] $seed $isFold] % $nKey}]
+        if {$aSlot($s) >= 0 || [lsearch -exact $slots $s] >= 0} break
+        lappend slots $s
+      }
+      if {[llength $slots] == [llength $aBucket($b)]} break
+    }
+    if {$seed == 65536} {
+      error "PerfectHash: no seed found for bucket $b"
+    }
+    set aSeed($b) $seed
+    foreach k $aBucket($b) s $slots { set aSlot($s) $k }
+  }
+
+  set seeds [list]
+  for {set i 0} {$i < $nBucket} {incr i} { lappend seeds $aSeed($i) }
+  set slots [list]
+  for {set i 0} {$i < $nKey} {incr i} { lappend slots $aSlot($i) }
+  return [list $seeds $slots]
+}
+
+# IntArray TYPE NAME VALUES
+#
+#     Return the text of a C array definition named NAME, with elements
+#     of type TYPE, initialized with the integers in list VALUES.
+#
+proc IntArray {type name values} {
+  set ret "$type $name\[[llength $values]\] = {"
+  set i 0
+  foreach v $values {
+    if {($i % 10) == 0} { append ret "\n   " }
+    append ret [format " %5d," $v]
+    incr i
+  }
+  append ret "\n};\n"
+  return $ret
+}